@@ -299,3 +299,32 @@ MACRO (SETUP_TEST TEST_NAME)
 	)
 
 ENDMACRO (SETUP_TEST)
+
+#######################################################################################################
+#
+#  Macro for setting up a benchmark.
+#
+#  NOTE: it expects some variables to be set either within local CMakeLists or higher in the hierarchy.
+#
+#  TARGET_COMMON_LIBRARIES		- common internal libraries to link against
+#  TARGET_SRC					- source files of the target
+#
+##########################################################################################################
+
+MACRO (SETUP_BENCHMARK BENCHMARK_NAME)
+
+	SET (TARGET_NAME ${BENCHMARK_NAME})
+
+	# Benchmarks are always command line apps
+	SETUP_EXE (1)
+
+	# Put the generated project into a Benchmarks folder
+	SET_TARGET_PROPERTIES(${TARGET_TARGETNAME} PROPERTIES FOLDER "Benchmarks")
+
+	# Install the benchmark
+	INSTALL (
+		TARGETS ${TARGET_TARGETNAME}
+		RUNTIME DESTINATION share/benchmarks/bin
+	)
+
+ENDMACRO (SETUP_BENCHMARK)
@@ -0,0 +1,150 @@
+//
+//	Benchmark.cpp
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+// C++ headers
+#include <algorithm>
+#include <cstdio>
+
+// Boost headers
+#include <boost/chrono.hpp>
+
+// bumpBenchmark headers
+#include "Benchmark.h"
+
+namespace bumpBenchmark {
+
+// A single calibrated run must take at least this long
+static const double gMinimumRunSeconds = 0.1;
+
+// The number of measured runs of each benchmark
+static const unsigned int gRepetitions = 5;
+
+// Written through by doNotOptimize so the compiler must produce the value
+static const void* volatile gSink = NULL;
+
+namespace {
+
+/** Runs the benchmark once and returns the elapsed seconds. */
+double timeRun(BenchmarkFunction function, unsigned long long iterations)
+{
+	boost::chrono::steady_clock::time_point start = boost::chrono::steady_clock::now();
+	function(iterations);
+	boost::chrono::duration<double> elapsed = boost::chrono::steady_clock::now() - start;
+	return elapsed.count();
+}
+
+}	// End of anonymous namespace
+
+Registry* Registry::instance()
+{
+	static Registry registry;
+	return &registry;
+}
+
+void Registry::add(const std::string& name, BenchmarkFunction function)
+{
+	Entry entry;
+	entry.name = name;
+	entry.function = function;
+	_entries.push_back(entry);
+}
+
+int Registry::run(int argc, char** argv)
+{
+	std::string filter;
+	std::string jsonPath;
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string argument = argv[i];
+		if (argument == "--json" && i + 1 < argc)
+		{
+			jsonPath = argv[++i];
+		}
+		else
+		{
+			filter = argument;
+		}
+	}
+
+	std::vector<Measurement> measurements;
+	std::printf("%-40s %14s %12s %12s %14s\n", "Benchmark", "Iterations", "Min ns/op", "Median ns/op", "Ops/s");
+	for (unsigned int i = 0; i < _entries.size(); ++i)
+	{
+		const Entry& entry = _entries[i];
+		if (entry.name.find(filter) == std::string::npos)
+		{
+			continue;
+		}
+
+		// Run once untimed so one-time setup (e.g. filling lookup tables) does not skew the calibration
+		entry.function(1);
+
+		// Calibrate the iteration count, which also warms up the caches
+		unsigned long long iterations = 1;
+		while (timeRun(entry.function, iterations) < gMinimumRunSeconds)
+		{
+			iterations *= 2;
+		}
+
+		std::vector<double> nanoseconds;
+		for (unsigned int repetition = 0; repetition < gRepetitions; ++repetition)
+		{
+			nanoseconds.push_back(timeRun(entry.function, iterations) * 1.0e9 / iterations);
+		}
+		std::sort(nanoseconds.begin(), nanoseconds.end());
+
+		const double median = nanoseconds[nanoseconds.size() / 2];
+		std::printf("%-40s %14llu %12.2f %12.2f %14.0f\n", entry.name.c_str(), iterations, nanoseconds.front(),
+					median, 1.0e9 / median);
+		std::fflush(stdout);
+
+		Measurement measurement;
+		measurement.name = entry.name;
+		measurement.iterations = iterations;
+		measurement.minimumNanoseconds = nanoseconds.front();
+		measurement.medianNanoseconds = median;
+		measurements.push_back(measurement);
+	}
+
+	if (!jsonPath.empty() && !writeJson(jsonPath, measurements))
+	{
+		std::fprintf(stderr, "Could not write the results to %s\n", jsonPath.c_str());
+		return 1;
+	}
+
+	return 0;
+}
+
+bool Registry::writeJson(const std::string& path, const std::vector<Measurement>& measurements) const
+{
+	FILE* file = std::fopen(path.c_str(), "w");
+	if (file == NULL)
+	{
+		return false;
+	}
+
+	// Benchmark names are identifiers, so they never need escaping
+	std::fprintf(file, "{\n\t\"benchmarks\": [\n");
+	for (unsigned int i = 0; i < measurements.size(); ++i)
+	{
+		const Measurement& measurement = measurements[i];
+		std::fprintf(file, "\t\t{ \"name\": \"%s\", \"iterations\": %llu, \"min_ns\": %.3f, \"median_ns\": %.3f }%s\n",
+					 measurement.name.c_str(), measurement.iterations, measurement.minimumNanoseconds,
+					 measurement.medianNanoseconds, i + 1 < measurements.size() ? "," : "");
+	}
+	std::fprintf(file, "\t]\n}\n");
+
+	return std::fclose(file) == 0;
+}
+
+void doNotOptimize(const void* value)
+{
+	gSink = value;
+}
+
+}	// End of bumpBenchmark namespace
@@ -0,0 +1,111 @@
+//
+//	Benchmark.h
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+#ifndef BUMPBENCHMARK_BENCHMARK_H
+#define BUMPBENCHMARK_BENCHMARK_H
+
+// C++ headers
+#include <string>
+#include <vector>
+
+namespace bumpBenchmark {
+
+/**
+ * A benchmark body. It must run the measured operation the given number of times.
+ */
+typedef void (*BenchmarkFunction)(unsigned long long iterations);
+
+/**
+ * Holds every benchmark registered with BUMP_BENCHMARK and runs them. Each benchmark is
+ * first calibrated by doubling its iteration count until a single run takes long enough
+ * to time accurately, then it is run several times and the fastest and median times per
+ * iteration are reported.
+ *
+ * The results can also be written as JSON, which benchmarks/compare.py compares against a
+ * stored baseline to flag regressions.
+ */
+class Registry
+{
+public:
+
+	/** Returns the registry singleton. */
+	static Registry* instance();
+
+	/** Adds a benchmark to the registry. */
+	void add(const std::string& name, BenchmarkFunction function);
+
+	/**
+	 * Runs the benchmarks and prints the results.
+	 *
+	 * Usage: <benchmark executable> [name filter] [--json <file>]. Only the benchmarks whose names
+	 * contain the filter are run, and the results are also written to the JSON file if given.
+	 *
+	 * @return The process exit code.
+	 */
+	int run(int argc, char** argv);
+
+protected:
+
+	/** A registered benchmark. */
+	struct Entry
+	{
+		std::string name;
+		BenchmarkFunction function;
+	};
+
+	/** The measurements of a benchmark. */
+	struct Measurement
+	{
+		std::string name;
+		unsigned long long iterations;
+		double minimumNanoseconds;
+		double medianNanoseconds;
+	};
+
+	/** Writes the measurements to a JSON file, returning false if it could not be written. */
+	bool writeJson(const std::string& path, const std::vector<Measurement>& measurements) const;
+
+	// Instance member variables
+	std::vector<Entry> _entries;
+};
+
+/** Registers a benchmark at static initialization time. */
+struct Registrar
+{
+	Registrar(const char* name, BenchmarkFunction function)
+	{
+		Registry::instance()->add(name, function);
+	}
+};
+
+/**
+ * Prevents the compiler from optimizing away a result that is otherwise unused.
+ *
+ * @param value A pointer to the result.
+ */
+void doNotOptimize(const void* value);
+
+}	// End of bumpBenchmark namespace
+
+/**
+ * Defines and registers a benchmark. The body receives the number of iterations to run:
+ *
+ *   BUMP_BENCHMARK(Uuid, toString)
+ *   {
+ *       for (unsigned long long i = 0; i < iterations; ++i)
+ *       {
+ *           ...
+ *       }
+ *   }
+ */
+#define BUMP_BENCHMARK(group, name) \
+	static void group##_##name(unsigned long long iterations); \
+	static bumpBenchmark::Registrar group##_##name##_registrar(#group "." #name, group##_##name); \
+	static void group##_##name(unsigned long long iterations)
+
+#endif	// End of BUMPBENCHMARK_BENCHMARK_H
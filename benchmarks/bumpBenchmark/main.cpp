@@ -0,0 +1,19 @@
+//
+//	main.cpp
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+// bumpBenchmark headers
+#include "Benchmark.h"
+
+/**
+ * Runs every benchmark linked into the executable. Pass a name filter to only run the
+ * matching benchmarks, and --json <file> to also write the results for compare.py.
+ */
+int main(int argc, char **argv)
+{
+	return bumpBenchmark::Registry::instance()->run(argc, argv);
+}
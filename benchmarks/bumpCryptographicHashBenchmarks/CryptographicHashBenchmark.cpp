@@ -0,0 +1,136 @@
+//
+//	CryptographicHashBenchmark.cpp
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+// C++ headers
+#include <fstream>
+#include <vector>
+
+// Bump headers
+#include <bump/CryptographicHash.h>
+#include <bump/FileSystem.h>
+
+// bumpBenchmark headers
+#include "../bumpBenchmark/Benchmark.h"
+
+namespace {
+
+/** Eight temporary 1 MB files, removed when the benchmarks exit. */
+class SampleFiles
+{
+public:
+
+	SampleFiles()
+	{
+		const std::string contents(1024 * 1024, 'x');
+		for (unsigned int i = 0; i < 8; ++i)
+		{
+			const bump::String path = bump::FileSystem::join(bump::FileSystem::temporaryPath(),
+				bump::String("bumpCryptographicHashBenchmark") + bump::String(i) + ".bin");
+			std::ofstream file(path.c_str(), std::ios::binary);
+			file << i << contents;
+			paths.push_back(path);
+		}
+	}
+
+	~SampleFiles()
+	{
+		for (unsigned int i = 0; i < paths.size(); ++i)
+		{
+			bump::FileSystem::removeFile(paths[i]);
+		}
+	}
+
+	bump::StringList paths;
+};
+
+const bump::StringList& samplePaths()
+{
+	static SampleFiles files;
+	return files.paths;
+}
+
+/** Hashes the given number of bytes through setData and resultBytes. */
+void hashBytes(unsigned long long iterations, unsigned int size)
+{
+	const std::string data(size, 'x');
+	bump::CryptographicHash hash;
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		hash.setData(data.data(), static_cast<int>(data.size()));
+		bump::Sha1Digest digest = hash.resultBytes();
+		bumpBenchmark::doNotOptimize(&digest);
+	}
+}
+
+}	// End of anonymous namespace
+
+BUMP_BENCHMARK(CryptographicHash, hash64Bytes)
+{
+	hashBytes(iterations, 64);
+}
+
+BUMP_BENCHMARK(CryptographicHash, hash4Kilobytes)
+{
+	hashBytes(iterations, 4096);
+}
+
+BUMP_BENCHMARK(CryptographicHash, resultHex)
+{
+	const bump::String data("the quick brown fox jumps over the lazy dog");
+	bump::CryptographicHash hash;
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		hash.setData(data);
+		bump::String result = hash.result();
+		bumpBenchmark::doNotOptimize(&result);
+	}
+}
+
+BUMP_BENCHMARK(CryptographicHash, hashMessages)
+{
+	// 64 small messages such as cache keys, hashed in a single call
+	std::vector<std::string> keys;
+	std::vector<const char*> messages;
+	std::vector<int> lengths;
+	for (unsigned int i = 0; i < 64; ++i)
+	{
+		keys.push_back(std::string("cache/key/") + bump::String(i * 7919));
+	}
+	for (unsigned int i = 0; i < keys.size(); ++i)
+	{
+		messages.push_back(keys[i].data());
+		lengths.push_back(static_cast<int>(keys[i].size()));
+	}
+
+	std::vector<unsigned char> digests(20 * keys.size());
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bump::CryptographicHash::hashMessages(&messages[0], &lengths[0], static_cast<unsigned int>(keys.size()), &digests[0]);
+		bumpBenchmark::doNotOptimize(&digests[0]);
+	}
+}
+
+BUMP_BENCHMARK(CryptographicHash, hashFile)
+{
+	const bump::String& path = samplePaths()[0];
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bump::String result = bump::CryptographicHash::hashFile(path);
+		bumpBenchmark::doNotOptimize(&result);
+	}
+}
+
+BUMP_BENCHMARK(CryptographicHash, hashFiles)
+{
+	const bump::StringList& paths = samplePaths();
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bump::StringList results = bump::CryptographicHash::hashFiles(paths);
+		bumpBenchmark::doNotOptimize(&results);
+	}
+}
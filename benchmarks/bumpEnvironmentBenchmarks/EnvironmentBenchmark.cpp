@@ -0,0 +1,71 @@
+//
+//	EnvironmentBenchmark.cpp
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+// Bump headers
+#include <bump/Environment.h>
+#include <bump/EnvironmentSetting.h>
+
+// bumpBenchmark headers
+#include "../bumpBenchmark/Benchmark.h"
+
+//====================================================================================
+//                                    Environment
+//====================================================================================
+
+BUMP_BENCHMARK(Environment, environmentVariable)
+{
+	bump::Environment::setEnvironmentVariable("BUMP_BENCHMARK_VARIABLE", "a typical configuration value");
+	const bump::String name("BUMP_BENCHMARK_VARIABLE");
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bump::String value = bump::Environment::environmentVariable(name);
+		bumpBenchmark::doNotOptimize(&value);
+	}
+}
+
+BUMP_BENCHMARK(Environment, environmentVariableView)
+{
+	bump::Environment::setEnvironmentVariable("BUMP_BENCHMARK_VARIABLE", "a typical configuration value");
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		boost::string_ref value = bump::Environment::environmentVariableView("BUMP_BENCHMARK_VARIABLE");
+		bumpBenchmark::doNotOptimize(&value);
+	}
+}
+
+BUMP_BENCHMARK(Environment, setEnvironmentVariable)
+{
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bump::Environment::setEnvironmentVariable("BUMP_BENCHMARK_VARIABLE", (i & 1) ? "odd" : "even");
+	}
+}
+
+//====================================================================================
+//                                     Settings
+//====================================================================================
+
+BUMP_BENCHMARK(EnvironmentSetting, value)
+{
+	static const bump::IntSetting setting("BUMP_BENCHMARK_SETTING", 42, "A benchmark setting");
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		long long value = setting.value();
+		bumpBenchmark::doNotOptimize(&value);
+	}
+}
+
+BUMP_BENCHMARK(EnvironmentSetting, reload)
+{
+	static bump::DurationSetting setting("BUMP_BENCHMARK_SETTING", 1000000ULL, "A benchmark setting");
+	bump::Environment::setEnvironmentVariable("BUMP_BENCHMARK_SETTING", "250ms");
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		setting.reload();
+	}
+}
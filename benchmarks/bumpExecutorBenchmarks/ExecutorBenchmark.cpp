@@ -0,0 +1,103 @@
+//
+//	ExecutorBenchmark.cpp
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+// C++ headers
+#include <vector>
+
+// Boost headers
+#include <boost/bind.hpp>
+#include <boost/thread/thread.hpp>
+
+// Bump headers
+#include <bump/Executor.h>
+
+// bumpBenchmark headers
+#include "../bumpBenchmark/Benchmark.h"
+
+namespace {
+
+// The number of indices of each parallel loop
+const std::size_t INDEX_COUNT = 4096;
+
+/** Returns the value. */
+int identity(int value)
+{
+	return value;
+}
+
+/** Does a small amount of work that grows with the index, so the loop is unevenly balanced. */
+void unevenWork(std::vector<double>* results, std::size_t index)
+{
+	double sum = 0.0;
+	for (std::size_t i = 0; i < index % 256; ++i)
+	{
+		sum += i * 0.5;
+	}
+	(*results)[index] = sum;
+}
+
+/** Runs the uneven work on a thread of its own, as the ad hoc threads used to. */
+void unevenRange(std::vector<double>* results, std::size_t begin, std::size_t end)
+{
+	for (std::size_t i = begin; i < end; ++i)
+	{
+		unevenWork(results, i);
+	}
+}
+
+}	// End of anonymous namespace
+
+//====================================================================================
+//                                       Submit
+//====================================================================================
+
+BUMP_BENCHMARK(Executor, submitAndWait)
+{
+	bump::Executor* executor = bump::Executor::instance();
+	const boost::function<int ()> function(boost::bind(&identity, 42));
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		int result = executor->submit<int>(function).get();
+		bumpBenchmark::doNotOptimize(&result);
+	}
+}
+
+//====================================================================================
+//                                    Parallel For
+//====================================================================================
+
+BUMP_BENCHMARK(Executor, parallelForUneven)
+{
+	bump::Executor* executor = bump::Executor::instance();
+	std::vector<double> results(INDEX_COUNT);
+	const bump::Executor::IndexTask body(boost::bind(&unevenWork, &results, _1));
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		executor->parallelFor(0, results.size(), body, 64);
+		bumpBenchmark::doNotOptimize(&results[0]);
+	}
+}
+
+BUMP_BENCHMARK(Executor, threadPerChunkUneven)
+{
+	// The baseline of starting a thread for an equal share of the range on every core
+	const unsigned int threadCount = bump::Executor::instance()->threadCount();
+	std::vector<double> results(INDEX_COUNT);
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		boost::thread_group threads;
+		for (unsigned int t = 0; t < threadCount; ++t)
+		{
+			const std::size_t begin = results.size() * t / threadCount;
+			const std::size_t end = results.size() * (t + 1) / threadCount;
+			threads.create_thread(boost::bind(&unevenRange, &results, begin, end));
+		}
+		threads.join_all();
+		bumpBenchmark::doNotOptimize(&results[0]);
+	}
+}
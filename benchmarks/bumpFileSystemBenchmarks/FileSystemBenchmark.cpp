@@ -0,0 +1,175 @@
+//
+//	FileSystemBenchmark.cpp
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+// C++ headers
+#include <fstream>
+
+// Bump headers
+#include <bump/FileInfo.h>
+#include <bump/FileSystem.h>
+
+// bumpBenchmark headers
+#include "../bumpBenchmark/Benchmark.h"
+
+namespace {
+
+/** A temporary directory of 100 small files, removed when the benchmarks exit. */
+class SampleDirectory
+{
+public:
+
+	SampleDirectory() :
+		path(bump::FileSystem::join(bump::FileSystem::temporaryPath(), "bumpFileSystemBenchmark"))
+	{
+		bump::FileSystem::removeDirectoryAndContents(path);
+		bump::FileSystem::createDirectory(path);
+		for (unsigned int i = 0; i < 100; ++i)
+		{
+			std::ofstream file(bump::FileSystem::join(path, bump::String("file") + bump::String(i) + ".txt").c_str());
+			file << "sample file contents " << i << std::endl;
+		}
+
+		file = bump::FileSystem::join(path, "file0.txt");
+	}
+
+	~SampleDirectory()
+	{
+		bump::FileSystem::removeDirectoryAndContents(path);
+	}
+
+	bump::String path;
+	bump::String file;
+};
+
+const SampleDirectory& sampleDirectory()
+{
+	static SampleDirectory directory;
+	return directory;
+}
+
+}	// End of anonymous namespace
+
+//====================================================================================
+//                                    FileSystem
+//====================================================================================
+
+BUMP_BENCHMARK(FileSystem, join)
+{
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bump::String path = bump::FileSystem::join("/home/username", "projects", "bump", "file.txt");
+		bumpBenchmark::doNotOptimize(&path);
+	}
+}
+
+BUMP_BENCHMARK(FileSystem, exists)
+{
+	const bump::String& file = sampleDirectory().file;
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bool exists = bump::FileSystem::exists(file);
+		bumpBenchmark::doNotOptimize(&exists);
+	}
+}
+
+BUMP_BENCHMARK(FileSystem, isFile)
+{
+	const bump::String& file = sampleDirectory().file;
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bool isFile = bump::FileSystem::isFile(file);
+		bumpBenchmark::doNotOptimize(&isFile);
+	}
+}
+
+BUMP_BENCHMARK(FileSystem, directoryList)
+{
+	const bump::String& path = sampleDirectory().path;
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bump::StringList list = bump::FileSystem::directoryList(path);
+		bumpBenchmark::doNotOptimize(&list);
+	}
+}
+
+BUMP_BENCHMARK(FileSystem, createAndRemoveFile)
+{
+	const bump::String file = bump::FileSystem::join(sampleDirectory().path, "created.txt");
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bump::FileSystem::createFile(file);
+		bump::FileSystem::removeFile(file);
+	}
+}
+
+BUMP_BENCHMARK(FileSystem, copyFile)
+{
+	const bump::String& source = sampleDirectory().file;
+	const bump::String destination = bump::FileSystem::join(sampleDirectory().path, "copied.txt");
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bump::FileSystem::copyFile(source, destination);
+		bump::FileSystem::removeFile(destination);
+	}
+}
+
+//====================================================================================
+//                                     FileInfo
+//====================================================================================
+
+BUMP_BENCHMARK(FileInfo, fileSize)
+{
+	const bump::FileInfo info(sampleDirectory().file);
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		unsigned long long size = info.fileSize();
+		bumpBenchmark::doNotOptimize(&size);
+	}
+}
+
+BUMP_BENCHMARK(FileInfo, tryFileSizeMissing)
+{
+	const bump::FileInfo info(bump::FileSystem::join(sampleDirectory().path, "missing.txt"));
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bump::Expected<unsigned long long> size = info.tryFileSize();
+		bumpBenchmark::doNotOptimize(&size);
+	}
+}
+
+BUMP_BENCHMARK(FileInfo, modifiedDate)
+{
+	const bump::FileInfo info(sampleDirectory().file);
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		std::time_t date = info.modifiedDate();
+		bumpBenchmark::doNotOptimize(&date);
+	}
+}
+
+BUMP_BENCHMARK(FileInfo, decomposePath)
+{
+	const bump::FileInfo info("/home/username/projects/bump/archive.tar.gz");
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bump::String basename = info.basename();
+		bump::String extension = info.extension();
+		bumpBenchmark::doNotOptimize(&basename);
+		bumpBenchmark::doNotOptimize(&extension);
+	}
+}
+
+BUMP_BENCHMARK(FileInfo, directoryInfoList)
+{
+	const bump::String& path = sampleDirectory().path;
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bump::FileInfoList list = bump::FileSystem::directoryInfoList(path);
+		bumpBenchmark::doNotOptimize(&list);
+	}
+}
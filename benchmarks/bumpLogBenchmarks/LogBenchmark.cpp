@@ -0,0 +1,86 @@
+//
+//	LogBenchmark.cpp
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+// C++ headers
+#include <ostream>
+#include <streambuf>
+
+// Bump headers
+#include <bump/FileSystem.h>
+#include <bump/Log.h>
+
+// bumpBenchmark headers
+#include "../bumpBenchmark/Benchmark.h"
+
+namespace {
+
+/** Discards everything written to it, so the benchmarks measure the log rather than the terminal. */
+class NullBuffer : public std::streambuf
+{
+protected:
+
+	int overflow(int character) { return character; }
+	std::streamsize xsputn(const char*, std::streamsize count) { return count; }
+};
+
+/** Points the log at a stream that discards everything at the warning level. */
+void discardLog()
+{
+	static NullBuffer buffer;
+	static std::ostream stream(&buffer);
+	bump::Log::instance()->setLogStream(stream);
+	bump::Log::instance()->setLogLevel(bump::Log::WARNING_LVL);
+}
+
+}	// End of anonymous namespace
+
+BUMP_BENCHMARK(Log, disabledLevel)
+{
+	discardLog();
+	const bump::String message("this message is below the log level");
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bumpDEBUG(message);
+	}
+}
+
+BUMP_BENCHMARK(Log, warning)
+{
+	discardLog();
+	const bump::String message("this message is written to the log");
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bumpWARNING(message);
+	}
+}
+
+BUMP_BENCHMARK(Log, warningWithPrefix)
+{
+	discardLog();
+	const bump::String message("this message is written to the log");
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bumpWARNING_P(bumpPrefix, message);
+	}
+}
+
+BUMP_BENCHMARK(Log, warningToFile)
+{
+	const bump::String path = bump::FileSystem::join(bump::FileSystem::temporaryPath(), "bumpLogBenchmark.log");
+	bump::Log::instance()->setLogFile(path);
+	bump::Log::instance()->setLogLevel(bump::Log::WARNING_LVL);
+
+	const bump::String message("this message is written to the log");
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bumpWARNING(message);
+	}
+
+	discardLog();
+	bump::FileSystem::removeFile(path);
+}
@@ -0,0 +1,106 @@
+//
+//	NotificationBenchmark.cpp
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+// C++ headers
+#include <vector>
+
+// Bump headers
+#include <bump/NotificationCenter.h>
+
+// bumpBenchmark headers
+#include "../bumpBenchmark/Benchmark.h"
+
+namespace {
+
+/** Counts the notifications it receives. */
+class Counter
+{
+public:
+
+	Counter() : count(0), total(0) {}
+
+	void increment() { ++count; }
+	void add(unsigned int value) { total += value; }
+
+	unsigned long long count;
+	unsigned long long total;
+};
+
+/** Observes the benchmark notifications with the given number of counters. */
+class Observers
+{
+public:
+
+	Observers(unsigned int observerCount) : _counters(observerCount)
+	{
+		for (unsigned int i = 0; i < _counters.size(); ++i)
+		{
+			ADD_OBSERVER(new bump::KeyObserver<Counter>(&_counters[i], &Counter::increment, "BenchmarkKey"));
+			ADD_OBSERVER(new bump::ObjectObserver<Counter, unsigned int>(&_counters[i], &Counter::add, "BenchmarkObject"));
+		}
+	}
+
+	~Observers()
+	{
+		for (unsigned int i = 0; i < _counters.size(); ++i)
+		{
+			REMOVE_OBSERVER(&_counters[i]);
+		}
+	}
+
+protected:
+
+	std::vector<Counter> _counters;
+};
+
+}	// End of anonymous namespace
+
+BUMP_BENCHMARK(NotificationCenter, postToOneObserver)
+{
+	Observers observers(1);
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		POST_NOTIFICATION("BenchmarkKey");
+	}
+}
+
+BUMP_BENCHMARK(NotificationCenter, postToTenObservers)
+{
+	Observers observers(10);
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		POST_NOTIFICATION("BenchmarkKey");
+	}
+}
+
+BUMP_BENCHMARK(NotificationCenter, postWithObject)
+{
+	Observers observers(1);
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		POST_NOTIFICATION_WITH_OBJECT("BenchmarkObject", static_cast<unsigned int>(i));
+	}
+}
+
+BUMP_BENCHMARK(NotificationCenter, postWithoutObservers)
+{
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		POST_NOTIFICATION("BenchmarkUnobserved");
+	}
+}
+
+BUMP_BENCHMARK(NotificationCenter, addAndRemoveObserver)
+{
+	Counter counter;
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		ADD_OBSERVER(new bump::KeyObserver<Counter>(&counter, &Counter::increment, "BenchmarkKey"));
+		REMOVE_OBSERVER(&counter);
+	}
+}
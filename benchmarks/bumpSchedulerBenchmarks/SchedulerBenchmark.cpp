@@ -0,0 +1,75 @@
+//
+//	SchedulerBenchmark.cpp
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+// C++ headers
+#include <vector>
+
+// Bump headers
+#include <bump/Scheduler.h>
+
+// bumpBenchmark headers
+#include "../bumpBenchmark/Benchmark.h"
+
+namespace {
+
+// The number of callbacks waiting in the scheduler while benchmarking
+const unsigned int CALLBACK_COUNT = 10000;
+
+/** A callback that does nothing. */
+void doNothing()
+{
+	;
+}
+
+}	// End of anonymous namespace
+
+//====================================================================================
+//                                 Schedule and Cancel
+//====================================================================================
+
+BUMP_BENCHMARK(Scheduler, scheduleAndCancel)
+{
+	// Keep plenty of other callbacks waiting so the wheels are realistically full
+	static bump::Scheduler scheduler(1.0);
+	if (scheduler.size() == 0)
+	{
+		for (unsigned int i = 0; i < CALLBACK_COUNT; ++i)
+		{
+			scheduler.schedule(1.0e6 + i * 37.0, doNothing);
+		}
+	}
+
+	const bump::Scheduler::Callback callback(doNothing);
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bump::Scheduler::Id id = scheduler.schedule(100.0 + (i & 0xffff), callback);
+		bumpBenchmark::doNotOptimize(&id);
+		scheduler.cancel(id);
+	}
+}
+
+//====================================================================================
+//                                       Expiry
+//====================================================================================
+
+BUMP_BENCHMARK(Scheduler, expire10000Callbacks)
+{
+	// Each iteration schedules callbacks across all the wheels and runs them all
+	const bump::Scheduler::Callback callback(doNothing);
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bump::Scheduler scheduler(1.0);
+		for (unsigned int j = 0; j < CALLBACK_COUNT; ++j)
+		{
+			scheduler.schedule(1.0 + ((j * 2654435761U) >> 12), callback);
+		}
+
+		unsigned int ran = scheduler.advance(1.0e7);
+		bumpBenchmark::doNotOptimize(&ran);
+	}
+}
@@ -0,0 +1,330 @@
+//
+//	StringBenchmark.cpp
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+// Bump headers
+#include <bump/Arena.h>
+#include <bump/String.h>
+#include <bump/StringTable.h>
+
+// bumpBenchmark headers
+#include "../bumpBenchmark/Benchmark.h"
+
+namespace {
+
+/** A line of about the length the log and file readers typically work with. */
+const bump::String gSentence("The quick brown fox jumps over the lazy dog while the Lazy Dog sleeps in the sun");
+
+/** A comma separated record. */
+const bump::String gRecord("4605d211,2d5b,4ab4,8feb,d7c38e4e38c3,alpha,beta,gamma,delta,epsilon,zeta,eta");
+
+/** A large list of short, path-like strings, well beyond what fits in the caches as a StringList. */
+const bump::StringList& samplePaths()
+{
+	static bump::StringList paths;
+	if (paths.empty())
+	{
+		for (unsigned int i = 0; i < 200000; ++i)
+		{
+			paths.push_back(bump::String("/usr/share/bump/item_%1.txt").arg((i * 2654435761U) % 1000000));
+		}
+	}
+
+	return paths;
+}
+
+}	// End of anonymous namespace
+
+//====================================================================================
+//                                     Formatting
+//====================================================================================
+
+BUMP_BENCHMARK(String, arg1)
+{
+	const bump::String format("Copying file: %1");
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bump::String result = format.arg("test.txt");
+		bumpBenchmark::doNotOptimize(&result);
+	}
+}
+
+BUMP_BENCHMARK(String, arg3)
+{
+	const bump::String format("Copying files %1 of %2: %3");
+	const bump::String current(1);
+	const bump::String total(10);
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bump::String result = format.arg(current, total, "test.txt");
+		bumpBenchmark::doNotOptimize(&result);
+	}
+}
+
+BUMP_BENCHMARK(String, arg3Numbers)
+{
+	// The numbers converted on every call, as most callers have to
+	const bump::String format("Copying files %1 of %2: %3");
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bump::String result = format.arg(bump::String(static_cast<unsigned int>(i & 0xffff)), bump::String(65536), "test.txt");
+		bumpBenchmark::doNotOptimize(&result);
+	}
+}
+
+#ifndef BOOST_NO_CXX11_VARIADIC_TEMPLATES
+BUMP_BENCHMARK(String, format1)
+{
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bump::String result = bump::String::format("Copying file: %1", "test.txt");
+		bumpBenchmark::doNotOptimize(&result);
+	}
+}
+
+BUMP_BENCHMARK(String, format3Numbers)
+{
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bump::String result = bump::String::format("Copying files %1 of %2: %3", static_cast<unsigned int>(i & 0xffff), 65536, "test.txt");
+		bumpBenchmark::doNotOptimize(&result);
+	}
+}
+
+BUMP_BENCHMARK(String, formatDouble)
+{
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bump::String result = bump::String::format("Read %1 of %2 bytes", static_cast<unsigned int>(i), 1024.5);
+		bumpBenchmark::doNotOptimize(&result);
+	}
+}
+#endif
+
+BUMP_BENCHMARK(String, streamNumbers)
+{
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bump::String result("Read ");
+		result << static_cast<unsigned int>(i) << " of " << 1024.5 << " bytes";
+		bumpBenchmark::doNotOptimize(&result);
+	}
+}
+
+//====================================================================================
+//                                   Manipulation
+//====================================================================================
+
+BUMP_BENCHMARK(String, split)
+{
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bump::StringList fields = gRecord.split(",");
+		bumpBenchmark::doNotOptimize(&fields);
+	}
+}
+
+BUMP_BENCHMARK(String, splitArena)
+{
+	// Each iteration parses into a fresh arena over the same stack buffer, so nothing touches the heap
+	char buffer[16 * 1024];
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bump::MonotonicArena arena(buffer, sizeof(buffer));
+		bump::ArenaStringList fields = gRecord.split(",", &arena);
+		bumpBenchmark::doNotOptimize(&fields);
+	}
+}
+
+BUMP_BENCHMARK(String, splitTable)
+{
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bump::StringTable fields = gRecord.splitTable(",");
+		bumpBenchmark::doNotOptimize(&fields);
+	}
+}
+
+BUMP_BENCHMARK(String, join)
+{
+	const bump::StringList fields = gRecord.split(",");
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bump::String result = bump::String::join(fields, ",");
+		bumpBenchmark::doNotOptimize(&result);
+	}
+}
+
+BUMP_BENCHMARK(String, replace)
+{
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bump::String result(gSentence);
+		result.replace("the", "a");
+		bumpBenchmark::doNotOptimize(&result);
+	}
+}
+
+BUMP_BENCHMARK(String, trimmed)
+{
+	const bump::String padded = "   \t" + gSentence + "  \n";
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bump::String result = padded.trimmed();
+		bumpBenchmark::doNotOptimize(&result);
+	}
+}
+
+BUMP_BENCHMARK(String, toLowerCase)
+{
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bump::String result(gSentence);
+		result.toLowerCase();
+		bumpBenchmark::doNotOptimize(&result);
+	}
+}
+
+//====================================================================================
+//                                     Searching
+//====================================================================================
+
+BUMP_BENCHMARK(String, contains)
+{
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bool result = gSentence.contains("sun");
+		bumpBenchmark::doNotOptimize(&result);
+	}
+}
+
+BUMP_BENCHMARK(String, containsCaseInsensitive)
+{
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bool result = gSentence.contains("SUN", bump::String::NotCaseSensitive);
+		bumpBenchmark::doNotOptimize(&result);
+	}
+}
+
+BUMP_BENCHMARK(String, countCaseInsensitive)
+{
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		int result = gSentence.count("lazy", bump::String::NotCaseSensitive);
+		bumpBenchmark::doNotOptimize(&result);
+	}
+}
+
+BUMP_BENCHMARK(String, compareCaseInsensitive)
+{
+	const bump::String upper("THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG WHILE THE LAZY DOG SLEEPS IN THE SUN");
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bool result = gSentence.compare(upper, bump::String::NotCaseSensitive);
+		bumpBenchmark::doNotOptimize(&result);
+	}
+}
+
+BUMP_BENCHMARK(String, scanStringList)
+{
+	// Counts the paths ending in 7, touching every string once
+	const bump::StringList& paths = samplePaths();
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		unsigned int count = 0;
+		for (unsigned int j = 0; j < paths.size(); ++j)
+		{
+			count += paths[j][paths[j].size() - 5] == '7' ? 1 : 0;
+		}
+		bumpBenchmark::doNotOptimize(&count);
+	}
+}
+
+BUMP_BENCHMARK(String, scanStringTable)
+{
+	static const bump::StringTable paths(samplePaths());
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		unsigned int count = 0;
+		for (std::size_t j = 0; j < paths.size(); ++j)
+		{
+			const boost::string_ref path = paths[j];
+			count += path[path.size() - 5] == '7' ? 1 : 0;
+		}
+		bumpBenchmark::doNotOptimize(&count);
+	}
+}
+
+BUMP_BENCHMARK(String, binarySearchStringTable)
+{
+	static bump::StringTable paths;
+	if (paths.empty())
+	{
+		paths = bump::StringTable(samplePaths());
+		paths.sort();
+	}
+
+	const bump::StringList& keys = samplePaths();
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		std::size_t index = paths.binarySearch(keys[i % keys.size()]);
+		bumpBenchmark::doNotOptimize(&index);
+	}
+}
+
+//====================================================================================
+//                                    Conversions
+//====================================================================================
+
+BUMP_BENCHMARK(String, fromInt)
+{
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bump::String result(static_cast<int>(i));
+		bumpBenchmark::doNotOptimize(&result);
+	}
+}
+
+BUMP_BENCHMARK(String, fromDouble)
+{
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bump::String result(static_cast<double>(i) * 0.25);
+		bumpBenchmark::doNotOptimize(&result);
+	}
+}
+
+BUMP_BENCHMARK(String, toInt)
+{
+	const bump::String number("-2147483");
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		int result = number.toInt();
+		bumpBenchmark::doNotOptimize(&result);
+	}
+}
+
+BUMP_BENCHMARK(String, toDouble)
+{
+	const bump::String number("3.14159265");
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		double result = number.toDouble();
+		bumpBenchmark::doNotOptimize(&result);
+	}
+}
+
+BUMP_BENCHMARK(String, toIntInvalid)
+{
+	const bump::String number("not a number");
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bump::Expected<int> result = number.tryToInt();
+		bumpBenchmark::doNotOptimize(&result);
+	}
+}
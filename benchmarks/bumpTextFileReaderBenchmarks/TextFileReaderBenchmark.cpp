@@ -0,0 +1,122 @@
+//
+//	TextFileReaderBenchmark.cpp
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+// C++ headers
+#include <fstream>
+
+// Bump headers
+#include <bump/Arena.h>
+#include <bump/FileSystem.h>
+#include <bump/TextFileReader.h>
+
+// bumpBenchmark headers
+#include "../bumpBenchmark/Benchmark.h"
+
+namespace {
+
+/** A temporary text file of 10,000 lines, removed when the benchmarks exit. */
+class SampleFile
+{
+public:
+
+	SampleFile() :
+		path(bump::FileSystem::join(bump::FileSystem::temporaryPath(), "bumpTextFileReaderBenchmark.txt"))
+	{
+		std::ofstream file(path.c_str());
+		for (unsigned int i = 0; i < 10000; ++i)
+		{
+			file << "line " << i << ": the quick brown fox jumps over the lazy dog" << std::endl;
+		}
+	}
+
+	~SampleFile()
+	{
+		bump::FileSystem::removeFile(path);
+	}
+
+	bump::String path;
+};
+
+const bump::String& samplePath()
+{
+	static SampleFile file;
+	return file.path;
+}
+
+}	// End of anonymous namespace
+
+BUMP_BENCHMARK(TextFileReader, fileContents)
+{
+	const bump::String& path = samplePath();
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bump::StringList lines = bump::TextFileReader::fileContents(path);
+		bumpBenchmark::doNotOptimize(&lines);
+	}
+}
+
+BUMP_BENCHMARK(TextFileReader, fileContentsArena)
+{
+	const bump::String& path = samplePath();
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bump::MonotonicArena arena(64 * 1024);
+		bump::ArenaStringList lines = bump::TextFileReader::fileContents(path, &arena);
+		bumpBenchmark::doNotOptimize(&lines);
+	}
+}
+
+BUMP_BENCHMARK(TextFileReader, fileContentsTable)
+{
+	const bump::String& path = samplePath();
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bump::StringTable lines = bump::TextFileReader::fileContentsTable(path);
+		bumpBenchmark::doNotOptimize(&lines);
+	}
+}
+
+BUMP_BENCHMARK(TextFileReader, numberOfLines)
+{
+	const bump::String& path = samplePath();
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		int count = bump::TextFileReader::numberOfLines(path);
+		bumpBenchmark::doNotOptimize(&count);
+	}
+}
+
+BUMP_BENCHMARK(TextFileReader, firstLine)
+{
+	const bump::String& path = samplePath();
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bump::String line = bump::TextFileReader::firstLine(path);
+		bumpBenchmark::doNotOptimize(&line);
+	}
+}
+
+BUMP_BENCHMARK(TextFileReader, header)
+{
+	const bump::String& path = samplePath();
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bump::StringList lines = bump::TextFileReader::header(path, 10);
+		bumpBenchmark::doNotOptimize(&lines);
+	}
+}
+
+BUMP_BENCHMARK(TextFileReader, footer)
+{
+	const bump::String& path = samplePath();
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bump::StringList lines = bump::TextFileReader::footer(path, 10);
+		bumpBenchmark::doNotOptimize(&lines);
+	}
+}
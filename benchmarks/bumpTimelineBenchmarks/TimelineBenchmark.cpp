@@ -0,0 +1,124 @@
+//
+//	TimelineBenchmark.cpp
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+// C++ headers
+#include <vector>
+
+// Bump headers
+#include <bump/Timeline.h>
+#include <bump/TimelineCurve.h>
+#include <bump/TimelineGroup.h>
+
+// bumpBenchmark headers
+#include "../bumpBenchmark/Benchmark.h"
+
+namespace {
+
+// The number of timelines updated per benchmark iteration
+const unsigned int TIMELINE_COUNT = 10000;
+
+}	// End of anonymous namespace
+
+//====================================================================================
+//                                      Updates
+//====================================================================================
+
+BUMP_BENCHMARK(Timeline, update10000Timelines)
+{
+	// Mix the curve shapes so the branches are unpredictable, as in a real scene
+	static std::vector<bump::Timeline> timelines;
+	if (timelines.empty())
+	{
+		timelines.resize(TIMELINE_COUNT);
+		for (unsigned int i = 0; i < TIMELINE_COUNT; ++i)
+		{
+			timelines[i].setDuration(1.0e6);
+			timelines[i].setCurveShape((bump::Timeline::CurveShape) ((i * 2654435761U) >> 30));
+			timelines[i].start();
+		}
+	}
+
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		for (unsigned int j = 0; j < TIMELINE_COUNT; ++j)
+		{
+			timelines[j].update();
+		}
+		bumpBenchmark::doNotOptimize(&timelines[0]);
+	}
+}
+
+BUMP_BENCHMARK(Timeline, advance10000Timelines)
+{
+	static std::vector<bump::Timeline> timelines;
+	if (timelines.empty())
+	{
+		timelines.resize(TIMELINE_COUNT);
+		for (unsigned int i = 0; i < TIMELINE_COUNT; ++i)
+		{
+			timelines[i].setDuration(1.0e6);
+			timelines[i].setCurveShape((bump::Timeline::CurveShape) ((i * 2654435761U) >> 30));
+			timelines[i].start();
+		}
+	}
+
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		for (unsigned int j = 0; j < TIMELINE_COUNT; ++j)
+		{
+			timelines[j].advance(1.0e-6);
+		}
+		bumpBenchmark::doNotOptimize(&timelines[0]);
+	}
+}
+
+BUMP_BENCHMARK(Timeline, groupUpdate10000Timelines)
+{
+	static bump::TimelineGroup group;
+	if (group.size() == 0)
+	{
+		for (unsigned int i = 0; i < TIMELINE_COUNT; ++i)
+		{
+			group.start(group.add(1.0e6, bump::Timeline::FORWARDS, (bump::Timeline::CurveShape) ((i * 2654435761U) >> 30)));
+		}
+	}
+
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		group.update();
+		bumpBenchmark::doNotOptimize(&group);
+	}
+}
+
+//====================================================================================
+//                                       Curves
+//====================================================================================
+
+BUMP_BENCHMARK(TimelineCurve, cubicBezierEvaluate)
+{
+	static const bump::CubicBezierCurve curve(0.25, 0.1, 0.25, 1.0);
+	double progress = 0.0;
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		progress = progress < 1.0 ? progress + 0.001 : 0.0;
+		double value = curve.evaluate(progress);
+		bumpBenchmark::doNotOptimize(&value);
+	}
+}
+
+BUMP_BENCHMARK(TimelineCurve, lookupTableEvaluate)
+{
+	static const bump::LookupTableCurve curve(bump::CubicBezierCurve(0.25, 0.1, 0.25, 1.0));
+	double progress = 0.0;
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		progress = progress < 1.0 ? progress + 0.001 : 0.0;
+		double value = curve.evaluate(progress);
+		bumpBenchmark::doNotOptimize(&value);
+	}
+}
@@ -0,0 +1,131 @@
+//
+//	TimerBenchmark.cpp
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+// Bump headers
+#include <bump/AutoTimer.h>
+#include <bump/FileSystem.h>
+#include <bump/LatencyHistogram.h>
+#include <bump/Profiler.h>
+#include <bump/Timer.h>
+#include <bump/Tracer.h>
+
+// bumpBenchmark headers
+#include "../bumpBenchmark/Benchmark.h"
+
+//====================================================================================
+//                                      Readings
+//====================================================================================
+
+BUMP_BENCHMARK(Timer, elapsedNanosecondsSteadyClock)
+{
+	bump::Timer timer;
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		unsigned long long nanoseconds = timer.elapsedNanoseconds();
+		bumpBenchmark::doNotOptimize(&nanoseconds);
+	}
+}
+
+BUMP_BENCHMARK(Timer, elapsedNanosecondsTimeStampCounter)
+{
+	bump::Timer timer(bump::Timer::TIME_STAMP_COUNTER);
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		unsigned long long nanoseconds = timer.elapsedNanoseconds();
+		bumpBenchmark::doNotOptimize(&nanoseconds);
+	}
+}
+
+BUMP_BENCHMARK(Timer, secondsElapsed)
+{
+	bump::Timer timer;
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		double seconds = timer.secondsElapsed();
+		bumpBenchmark::doNotOptimize(&seconds);
+	}
+}
+
+//====================================================================================
+//                                 Latency Histograms
+//====================================================================================
+
+BUMP_BENCHMARK(LatencyHistogram, record)
+{
+	static bump::LatencyHistogram histogram;
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		histogram.record((i * 2654435761ULL) & 0xfffff);
+	}
+}
+
+BUMP_BENCHMARK(LatencyHistogram, autoTimer)
+{
+	bump::LatencyHistogram* histogram = bump::LatencyHistogram::named("benchmark.autoTimer");
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bump::AutoTimer timer(*histogram);
+	}
+}
+
+//====================================================================================
+//                                      Profiler
+//====================================================================================
+
+BUMP_BENCHMARK(Profiler, scope)
+{
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		BUMP_PROFILE_SCOPE("benchmark.scope");
+	}
+}
+
+BUMP_BENCHMARK(Profiler, nestedScopes)
+{
+	BUMP_PROFILE_SCOPE("benchmark.outer");
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		BUMP_PROFILE_SCOPE("benchmark.first");
+		{
+			BUMP_PROFILE_SCOPE("benchmark.second");
+		}
+	}
+}
+
+//====================================================================================
+//                                       Tracer
+//====================================================================================
+
+BUMP_BENCHMARK(Tracer, disabledScope)
+{
+	bump::Tracer::setEnabled(false);
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		BUMP_TRACE_SCOPE("benchmark", "scope");
+	}
+}
+
+BUMP_BENCHMARK(Tracer, scope)
+{
+	// Flushing before the buffer fills keeps every event, and counts the cost of writing it out
+	const bump::String path = bump::FileSystem::join(bump::FileSystem::temporaryPath(), "bumpTracerBenchmark.json");
+	bump::Tracer::setTraceFile(path);
+	bump::Tracer::setEnabled(true);
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		BUMP_TRACE_SCOPE("benchmark", "scope");
+		if (i % 16384 == 16383)
+		{
+			bump::Tracer::flush();
+		}
+	}
+	bump::Tracer::setEnabled(false);
+	bump::Tracer::flush();
+	bump::Tracer::setTraceFile("");
+	bump::FileSystem::removeFile(path);
+}
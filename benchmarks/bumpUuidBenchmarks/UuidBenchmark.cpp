@@ -0,0 +1,260 @@
+//
+//	UuidBenchmark.cpp
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+// C++ headers
+#include <map>
+#include <vector>
+
+// Boost headers
+#include <boost/unordered_map.hpp>
+#include <boost/uuid/random_generator.hpp>
+#include <boost/uuid/string_generator.hpp>
+#include <boost/uuid/uuid_io.hpp>
+
+// Bump headers
+#include <bump/String.h>
+#include <bump/Uuid.h>
+#include <bump/UuidHashTable.h>
+
+// bumpBenchmark headers
+#include "../bumpBenchmark/Benchmark.h"
+
+namespace {
+
+/** The fixed set of uuids parsed and formatted by the benchmarks. */
+const std::vector<bump::Uuid>& sampleUuids()
+{
+	static std::vector<bump::Uuid> uuids;
+	if (uuids.empty())
+	{
+		uuids.resize(1024);
+		bump::Uuid::generateRandomBatch(uuids.size(), &uuids[0]);
+	}
+
+	return uuids;
+}
+
+/** The string forms of the sample uuids. */
+const std::vector<bump::String>& sampleStrings()
+{
+	static std::vector<bump::String> strings;
+	if (strings.empty())
+	{
+		const std::vector<bump::Uuid>& uuids = sampleUuids();
+		for (unsigned int i = 0; i < uuids.size(); ++i)
+		{
+			strings.push_back(uuids[i].toString());
+		}
+	}
+
+	return strings;
+}
+
+/** The keys of the lookup benchmarks, large enough that the containers do not fit in L2. */
+const std::vector<bump::Uuid>& lookupKeys()
+{
+	static std::vector<bump::Uuid> keys;
+	if (keys.empty())
+	{
+		keys.resize(1 << 18);
+		bump::Uuid::generateRandomBatch(keys.size(), &keys[0], bump::Uuid::FAST);
+	}
+
+	return keys;
+}
+
+/** Fills the container with every lookup key once. */
+template <class Map>
+const Map& lookupMap()
+{
+	static Map map;
+	if (map.empty())
+	{
+		const std::vector<bump::Uuid>& keys = lookupKeys();
+		for (unsigned int i = 0; i < keys.size(); ++i)
+		{
+			map[keys[i]] = i;
+		}
+	}
+
+	return map;
+}
+
+/** Looks up keys in a pseudo-random order so the benchmark is not a sequential scan. */
+template <class Map>
+void findKeys(unsigned long long iterations)
+{
+	const Map& map = lookupMap<Map>();
+	const std::vector<bump::Uuid>& keys = lookupKeys();
+	const std::size_t mask = keys.size() - 1;
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		typename Map::const_iterator iter = map.find(keys[(i * 40503) & mask]);
+		bumpBenchmark::doNotOptimize(&iter->second);
+	}
+}
+
+}	// End of anonymous namespace
+
+//====================================================================================
+//                                     Formatting
+//====================================================================================
+
+BUMP_BENCHMARK(Uuid, toString)
+{
+	const std::vector<bump::Uuid>& uuids = sampleUuids();
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bump::String uuidString = uuids[i & 1023].toString();
+		bumpBenchmark::doNotOptimize(&uuidString);
+	}
+}
+
+BUMP_BENCHMARK(Uuid, toChars)
+{
+	const std::vector<bump::Uuid>& uuids = sampleUuids();
+	char chars[36];
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		uuids[i & 1023].toChars(chars);
+		bumpBenchmark::doNotOptimize(chars);
+	}
+}
+
+BUMP_BENCHMARK(Uuid, boostToString)
+{
+	const std::vector<bump::Uuid>& uuids = sampleUuids();
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		std::string uuidString = boost::uuids::to_string(uuids[i & 1023]);
+		bumpBenchmark::doNotOptimize(&uuidString);
+	}
+}
+
+//====================================================================================
+//                                      Parsing
+//====================================================================================
+
+BUMP_BENCHMARK(Uuid, fromString)
+{
+	const std::vector<bump::String>& strings = sampleStrings();
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bump::Uuid uuid = bump::Uuid::fromString(strings[i & 1023]);
+		bumpBenchmark::doNotOptimize(&uuid);
+	}
+}
+
+BUMP_BENCHMARK(Uuid, tryFromString)
+{
+	const std::vector<bump::String>& strings = sampleStrings();
+	bump::Uuid uuid;
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		const bump::String& uuidString = strings[i & 1023];
+		bump::Uuid::tryFromString(uuidString.c_str(), uuidString.size(), uuid);
+		bumpBenchmark::doNotOptimize(&uuid);
+	}
+}
+
+BUMP_BENCHMARK(Uuid, boostStringGenerator)
+{
+	const std::vector<bump::String>& strings = sampleStrings();
+	boost::uuids::string_generator generator;
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		boost::uuids::uuid uuid = generator(strings[i & 1023]);
+		bumpBenchmark::doNotOptimize(&uuid);
+	}
+}
+
+//====================================================================================
+//                                     Generation
+//====================================================================================
+
+BUMP_BENCHMARK(Uuid, generateRandom)
+{
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bump::Uuid uuid = bump::Uuid::generateRandom();
+		bumpBenchmark::doNotOptimize(&uuid);
+	}
+}
+
+BUMP_BENCHMARK(Uuid, generateRandomBatchSecure)
+{
+	bump::Uuid uuids[256];
+	for (unsigned long long i = 0; i < iterations; i += 256)
+	{
+		bump::Uuid::generateRandomBatch(256, uuids, bump::Uuid::SECURE);
+		bumpBenchmark::doNotOptimize(uuids);
+	}
+}
+
+BUMP_BENCHMARK(Uuid, generateRandomBatchFast)
+{
+	bump::Uuid uuids[256];
+	for (unsigned long long i = 0; i < iterations; i += 256)
+	{
+		bump::Uuid::generateRandomBatch(256, uuids, bump::Uuid::FAST);
+		bumpBenchmark::doNotOptimize(uuids);
+	}
+}
+
+BUMP_BENCHMARK(Uuid, generateTimeOrdered)
+{
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		bump::Uuid uuid = bump::Uuid::generateTimeOrdered();
+		bumpBenchmark::doNotOptimize(&uuid);
+	}
+}
+
+BUMP_BENCHMARK(Uuid, boostRandomGenerator)
+{
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		boost::uuids::random_generator generator;
+		boost::uuids::uuid uuid = generator();
+		bumpBenchmark::doNotOptimize(&uuid);
+	}
+}
+
+//====================================================================================
+//                                      Lookups
+//====================================================================================
+
+BUMP_BENCHMARK(Uuid, uuidHashMapFind)
+{
+	findKeys<bump::UuidHashMap<unsigned int> >(iterations);
+}
+
+BUMP_BENCHMARK(Uuid, boostUnorderedMapFind)
+{
+	findKeys<boost::unordered_map<bump::Uuid, unsigned int> >(iterations);
+}
+
+BUMP_BENCHMARK(Uuid, stdMapFind)
+{
+	findKeys<std::map<bump::Uuid, unsigned int> >(iterations);
+}
+
+BUMP_BENCHMARK(Uuid, uuidHashMapInsert)
+{
+	const std::vector<bump::Uuid>& keys = lookupKeys();
+	bump::UuidHashMap<unsigned int> map;
+	for (unsigned long long i = 0; i < iterations; ++i)
+	{
+		if (map.size() == keys.size())
+		{
+			map.clear();
+		}
+		map.insert(keys[map.size()], (unsigned int) i);
+	}
+	bumpBenchmark::doNotOptimize(&map);
+}
@@ -0,0 +1,81 @@
+#!/usr/bin/env python
+#
+#	compare.py
+#	Bump
+#
+#	Created by Christian Noon on 10/17/26.
+#	Copyright (c) 2026 Christian Noon. All rights reserved.
+#
+
+"""
+Compares the JSON results of a benchmark run against a stored baseline and flags regressions.
+
+Usage: compare.py <baseline.json> <current.json> [--threshold <fraction>]
+
+Generate the results with any benchmark executable, for example:
+
+    bumpAllBenchmarks --json baseline.json
+    (make the change and rebuild)
+    bumpAllBenchmarks --json current.json
+    python benchmarks/compare.py baseline.json current.json
+
+A benchmark regresses when its median time per iteration grows by more than the threshold, which
+defaults to 0.10 (10%). The script exits with 1 if anything regressed so it can gate a build.
+"""
+
+from __future__ import print_function
+
+import json
+import sys
+
+
+def load(path):
+    """Returns the median nanoseconds of each benchmark in the results file, keyed by name."""
+    with open(path) as results:
+        benchmarks = json.load(results)["benchmarks"]
+    return dict((benchmark["name"], benchmark["median_ns"]) for benchmark in benchmarks)
+
+
+def main(argv):
+    arguments = list(argv[1:])
+    threshold = 0.10
+    if "--threshold" in arguments:
+        index = arguments.index("--threshold")
+        threshold = float(arguments[index + 1])
+        del arguments[index:index + 2]
+
+    if len(arguments) != 2:
+        print(__doc__.strip(), file=sys.stderr)
+        return 2
+
+    baseline = load(arguments[0])
+    current = load(arguments[1])
+
+    regressions = 0
+    print("%-48s %14s %14s %9s" % ("Benchmark", "Baseline ns", "Current ns", "Change"))
+    for name in sorted(set(baseline) | set(current)):
+        if name not in current:
+            print("%-48s %14.2f %14s %9s" % (name, baseline[name], "-", "removed"))
+            continue
+        if name not in baseline:
+            print("%-48s %14s %14.2f %9s" % (name, "-", current[name], "new"))
+            continue
+
+        change = (current[name] - baseline[name]) / baseline[name] if baseline[name] > 0.0 else 0.0
+        flag = ""
+        if change > threshold:
+            flag = "  REGRESSION"
+            regressions += 1
+        elif change < -threshold:
+            flag = "  improved"
+        print("%-48s %14.2f %14.2f %+8.1f%%%s" % (name, baseline[name], current[name], change * 100.0, flag))
+
+    if regressions:
+        print("\n%d benchmark(s) regressed by more than %.0f%%" % (regressions, threshold * 100.0))
+        return 1
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -0,0 +1,50 @@
+//
+//	Arena.h
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+#ifndef BUMP_ARENA_H
+#define BUMP_ARENA_H
+
+// Boost headers
+#include <boost/container/pmr/memory_resource.hpp>
+#include <boost/container/pmr/monotonic_buffer_resource.hpp>
+#include <boost/container/pmr/string.hpp>
+#include <boost/container/pmr/unsynchronized_pool_resource.hpp>
+#include <boost/container/pmr/vector.hpp>
+
+// Bump headers
+#include <bump/Arena_fwd.h>
+
+namespace bump {
+
+/**
+ * Arena allocation for code that builds thousands of short-lived strings, such as splitting or
+ * reading a file line by line, where a separate malloc and free for every string dominates the cost.
+ *
+ * The functions that produce string lists have overloads taking a MemoryResource. The strings they
+ * return, along with the list itself, are allocated from that resource. A MonotonicArena hands out
+ * memory by bumping a pointer through large blocks, and frees nothing until it is destroyed or
+ * released, so everything parsed for one request can be thrown away at once. A PoolArena keeps
+ * freed blocks in pools by size for reuse, which suits work that frees strings as it goes.
+ *
+ * Neither arena is thread-safe, so use one per thread, and destroy the arena only after everything
+ * allocated from it.
+ *
+ *   bump::MonotonicArena arena(64 * 1024);
+ *   bump::ArenaStringList lines = bump::TextFileReader::fileContents(path, &arena);
+ *   bump::ArenaStringList fields = record.split(",", &arena);
+ *   ...
+ *   arena.release();
+ */
+
+// Typedefs, along with MemoryResource, ArenaString and ArenaStringList from bump/Arena_fwd.h
+typedef boost::container::pmr::monotonic_buffer_resource MonotonicArena;				/**< An arena that only frees when it is destroyed or released. */
+typedef boost::container::pmr::unsynchronized_pool_resource PoolArena;				/**< An arena that reuses freed blocks of the same size. */
+
+}	// End of bump namespace
+
+#endif	// End of BUMP_ARENA_H
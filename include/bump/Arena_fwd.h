@@ -0,0 +1,34 @@
+//
+//	Arena_fwd.h
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+#ifndef BUMP_ARENA_FWD_H
+#define BUMP_ARENA_FWD_H
+
+// C++ headers
+#include <string>
+
+// Boost headers
+#include <boost/container/container_fwd.hpp>
+
+namespace bump {
+
+/**
+ * Declares the arena types without including the pmr headers, for headers that only name them in
+ * function declarations. Include bump/Arena.h to create an arena or use the lists it returns.
+ *
+ * These name the same types as boost::container::pmr::string and pmr::vector_of<>::type.
+ */
+
+// Typedefs
+typedef boost::container::pmr::memory_resource MemoryResource;
+typedef boost::container::basic_string<char, std::char_traits<char>, boost::container::pmr::polymorphic_allocator<char> > ArenaString;
+typedef boost::container::vector<ArenaString, boost::container::pmr::polymorphic_allocator<ArenaString> > ArenaStringList;
+
+}	// End of bump namespace
+
+#endif	// End of BUMP_ARENA_FWD_H
@@ -9,16 +9,24 @@
 #ifndef BUMP_AUTO_TIMER_H
 #define BUMP_AUTO_TIMER_H
 
+// Boost headers
+#include <boost/optional.hpp>
+
 // Bump headers
 #include <bump/Export.h>
 #include <bump/Timer.h>
 
 namespace bump {
 
+// Forward declarations
+class LatencyHistogram;
+class String;
+
 /**
  * The AutoTimer class used for easily measuring elapsed time in a particular
  * scope. When the AutoTimer is destructed, it will print out the elapsed
- * time to std::cout.
+ * time to std::cout, record it into a LatencyHistogram if it was created
+ * with one, or end its Tracer event if it was created with a trace name.
  */
 class BUMP_EXPORT AutoTimer
 {
@@ -42,6 +50,34 @@ public:
 	 */
 	AutoTimer(const OutputType& outputType = SECONDS);
 
+	/**
+	 * Constructor for recording the elapsed time into a histogram rather than printing it. This
+	 * reads the time stamp counter when available to keep the cost of each sample low.
+	 *
+	 * @param histogram The histogram to record the elapsed time into.
+	 */
+	AutoTimer(LatencyHistogram& histogram);
+
+	/**
+	 * Constructor for recording the elapsed time into a registered histogram. Looking up the
+	 * name takes a lock, so hot code should cache LatencyHistogram::named() and use the
+	 * histogram constructor instead.
+	 *
+	 * @param histogramName The name of the registered histogram to record the elapsed time into.
+	 */
+	AutoTimer(const String& histogramName);
+
+	/**
+	 * Constructor for tracing the scope as a begin and end event of the Tracer rather than
+	 * printing the elapsed time. The scope is only traced while the Tracer is enabled, and is
+	 * sampled the same way as BUMP_TRACE_SCOPE(), which is the equivalent that compiles out.
+	 * No timer is started, so a scope that is not traced never reads the clock.
+	 *
+	 * @param traceCategory The category of the event, which must live as long as the process.
+	 * @param traceName The name of the event, which must live as long as the process.
+	 */
+	AutoTimer(const char* traceCategory, const char* traceName);
+
 	/**
 	 * Destructor.
 	 */
@@ -50,8 +86,11 @@ public:
 protected:
 
 	// Instance member variables
-	OutputType		_outputType;	/**< @internal The output format to be printed to std::cout. */
-	Timer			_timer;			/**< @internal The timer used to print out the elapsed time. */
+	OutputType				_outputType;	/**< @internal The output format to be printed to std::cout. */
+	LatencyHistogram*		_histogram;		/**< @internal The histogram to record into, or NULL to print. */
+	const char*				_traceCategory;	/**< @internal The category of the traced event, or NULL when not tracing. */
+	const char*				_traceName;		/**< @internal The name of the traced event, or NULL when it was not sampled. */
+	boost::optional<Timer>	_timer;		/**< @internal The timer used to print out the elapsed time, which is never started when tracing. */
 };
 
 }	// End of bump namespace
@@ -9,12 +9,43 @@
 #ifndef BUMP_CRYPTOGRAPHIC_HASH_H
 #define BUMP_CRYPTOGRAPHIC_HASH_H
 
+// C++ headers
+#include <cstddef>
+
+// Boost headers
+#include <boost/array.hpp>
+
 // Bump headers
 #include <bump/Export.h>
 #include <bump/String.h>
 
 namespace bump {
 
+/**
+ * A raw 20 byte sha1 digest. Digests compare with ==, != and < and can be used as keys in
+ * ordered containers, or in unordered containers together with Sha1DigestHash.
+ */
+typedef boost::array<unsigned char, 20> Sha1Digest;
+
+/**
+ * Hash functor for using a Sha1Digest as the key of an unordered container, e.g.
+ * boost::unordered_map<bump::Sha1Digest, bump::String, bump::Sha1DigestHash>.
+ *
+ * The digest bytes are already uniformly distributed, so the leading bytes are used directly.
+ */
+struct Sha1DigestHash
+{
+	std::size_t operator()(const Sha1Digest& digest) const
+	{
+		std::size_t hash = 0;
+		for (std::size_t i = 0; i < sizeof(std::size_t); ++i)
+		{
+			hash = (hash << 8) | digest[i];
+		}
+		return hash;
+	}
+};
+
 /**
  * The CryptographicHash class is used to generate a sha1 hash for textual
  * and binary data. It is designed to make it easy to add additional hash
@@ -71,8 +102,82 @@ public:
 	 */
 	String result();
 
+	/**
+	 * Computes the cryptographic hash and returns the raw digest, avoiding the hex conversion
+	 * when the hash is only compared or stored as a key.
+	 *
+	 * @return The 20 byte sha1 digest, or an all zero digest if no data has been set.
+	 */
+	Sha1Digest resultBytes();
+
+	/**
+	 * Computes the cryptographic hash of a file's contents without loading the whole file into a String.
+	 *
+	 * Files at or above the memory map threshold (4 MB) are memory mapped and hashed in place. Smaller
+	 * files are read in chunks on a background thread so disk reads overlap with hashing. Unlike result(),
+	 * an empty file still produces the hash of zero bytes of data.
+	 *
+	 * @throw bump::FileSystemError When the path is not a file or cannot be read.
+	 *
+	 * @param path The path of the file to hash.
+	 * @param algorithm The algorithm to use to generate the cryptographic hash.
+	 * @return The cryptographic hash of the file contents as a 40 character hex string.
+	 */
+	static String hashFile(const String& path, const Algorithm& algorithm = SHA1);
+
+	/**
+	 * Computes the cryptographic hash of each file, spreading the files across all available cores.
+	 *
+	 * @param paths The paths of the files to hash.
+	 * @param algorithm The algorithm to use to generate the cryptographic hashes.
+	 * @return The 40 character hex string hash for each path in the same order. Paths that could not
+	 *         be hashed produce an empty string.
+	 */
+	static StringList hashFiles(const StringList& paths, const Algorithm& algorithm = SHA1);
+
+	/**
+	 * Computes the raw hashes of many independent messages in a single call.
+	 *
+	 * This is designed for hashing large numbers of small messages such as cache keys. Rather than
+	 * hashing one message at a time, several messages are hashed side by side in the lanes of SIMD
+	 * registers (multi-buffer hashing). Unlike result(), an empty message still produces the hash of
+	 * zero bytes of data.
+	 *
+	 * @param messages The array of pointers to the data of each message.
+	 * @param lengths The array of lengths of each message in bytes.
+	 * @param count The number of messages to hash.
+	 * @param digests A caller-provided buffer of at least 20 * count bytes. The 20 byte sha1 digest of
+	 *                message i is written to digests + 20 * i.
+	 * @param algorithm The algorithm to use to generate the cryptographic hashes.
+	 */
+	static void hashMessages(const char* const* messages, const int* lengths, unsigned int count,
+							 unsigned char* digests, const Algorithm& algorithm = SHA1);
+
 protected:
 
+	/**
+	 * @internal
+	 * Memory maps the file and hashes it in place (platform specific).
+	 *
+	 * @param path The path of the file to hash.
+	 * @param fileSize The size of the file in bytes.
+	 * @param hash The 20 byte buffer to store the sha1 hash in.
+	 * @return True if the file was mapped and hashed, false if the caller should fall back to reading it.
+	 */
+	static bool hashMappedFile(const String& path, unsigned long long fileSize, unsigned char* hash);
+
+	/**
+	 * @internal
+	 * Hashes the file by reading it in chunks, overlapping the reads with hashing for larger files.
+	 *
+	 * @throw bump::FileSystemError When the file cannot be opened or read.
+	 *
+	 * @param path The path of the file to hash.
+	 * @param fileSize The size of the file in bytes.
+	 * @param hash The 20 byte buffer to store the sha1 hash in.
+	 */
+	static void hashStreamedFile(const String& path, unsigned long long fileSize, unsigned char* hash);
+
 	// Instance member variables
 	Algorithm		_algorithm;		/**< @internal The algorithm to use to generate the cryptographic hash. */
 	const char*		_data;			/**< @internal The data used to generate the cryptographic hash. */
@@ -9,6 +9,9 @@
 #ifndef BUMP_ENVIROMENT_H
 #define BUMP_ENVIROMENT_H
 
+// Boost headers
+#include <boost/utility/string_ref.hpp>
+
 // Bump headers
 #include <bump/Export.h>
 
@@ -20,6 +23,12 @@ class String;
 /**
  * The Bump Environment namespace is designed to make it easy to work with environment
  * variables. You can easily fetch, set and unset environment variables.
+ *
+ * The environment is parsed once into a snapshot that lookups read without taking a lock, so
+ * any number of threads can query it while another sets or unsets variables. Setting or unsetting
+ * a variable updates the process environment and publishes a new snapshot under a single lock,
+ * which keeps bump from racing the C runtime's getenv and setenv. Changes made to the process
+ * environment without going through bump are only seen after calling reloadEnvironment().
  */
 namespace Environment {
 
@@ -31,6 +40,18 @@ namespace Environment {
  */
 BUMP_EXPORT String environmentVariable(const String& name);
 
+/**
+ * Finds the value for the given environment variable without copying it.
+ *
+ * The view stays valid for the life of the process, even after the variable is changed, since
+ * every value the environment has held is kept until the process exits. Names are matched
+ * ignoring case on Windows, the same way getenv matches them there.
+ *
+ * @param name The environment variable's name you wish to find the value for.
+ * @return A view of the enviroment variable's value, which is empty if it is not set.
+ */
+BUMP_EXPORT boost::string_ref environmentVariableView(boost::string_ref name);
+
 /**
  * Sets the environment variable to the given value.
  *
@@ -38,6 +59,9 @@ BUMP_EXPORT String environmentVariable(const String& name);
  * overwrite flag is true. If the environment variable does not exist, then the environment
  * variable is added to the runtime and set to the given value.
  *
+ * Each change copies the names of every variable into a new snapshot, so avoid setting variables
+ * in a loop. Every distinct value is kept for the life of the process, so views stay valid.
+ *
  * @param name The environment variable's name you wish to set.
  * @param value The value of the environment variable you wish to set.
  * @param overwrite Whether to reset the value by overwritting the previous value with the new one.
@@ -53,6 +77,20 @@ BUMP_EXPORT bool setEnvironmentVariable(const String& name, const String& value,
  */
 BUMP_EXPORT bool unsetEnvironmentVariable(const String& name);
 
+/**
+ * Returns the generation of the environment, which increases every time a variable is set,
+ * unset or the environment is reloaded. Compare it against a previous generation to find out
+ * whether values derived from the environment need to be refreshed.
+ *
+ * @return The generation of the environment.
+ */
+BUMP_EXPORT unsigned long long environmentGeneration();
+
+/**
+ * Parses the process environment again, picking up changes made without going through bump.
+ */
+BUMP_EXPORT void reloadEnvironment();
+
 /**
  * Returns the username of the current user.
  *
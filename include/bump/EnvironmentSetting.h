@@ -0,0 +1,489 @@
+//
+//	EnvironmentSetting.h
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+#ifndef BUMP_ENVIRONMENT_SETTING_H
+#define BUMP_ENVIRONMENT_SETTING_H
+
+// C++ headers
+#include <cstddef>
+
+// Boost headers
+#include <boost/atomic.hpp>
+#include <boost/utility/string_ref.hpp>
+
+// Bump headers
+#include <bump/Export.h>
+#include <bump/String.h>
+
+namespace bump {
+
+/**
+ * The EnvironmentSetting class is the base of the typed settings components read from environment
+ * variables. Each setting parses its variable once when it is constructed and stores the result in
+ * an atomic, so reading a setting on a hot path costs no more than reading a member variable.
+ *
+ * A variable that is not set, or that cannot be parsed, leaves the setting at its default. Invalid
+ * values are reported on std::cout the same way the Log reports its environment variables.
+ *
+ * Every setting registers itself while it exists, so dump() can print the effective configuration
+ * and reloadAll() can pick up variables changed after startup. Reloading only changes what value()
+ * returns from then on. Subsystems that copied a value when they started, such as the Log level,
+ * the Tracer sample interval and the thread count of the shared Executor, keep running with the
+ * copy, so dump() may then show values they are not using. Declare settings as function-local
+ * statics so they are constructed on first use rather than during static initialization:
+ *
+ *   const bump::IntSetting& retryLimit()
+ *   {
+ *       static const bump::IntSetting setting("MYAPP_RETRY_LIMIT", 3, "Retries before giving up", 0, 100);
+ *       return setting;
+ *   }
+ *
+ *   for (long long i = 0; i < retryLimit().value(); ++i) { ... }
+ */
+class BUMP_EXPORT EnvironmentSetting
+{
+public:
+
+	/** The types of settings. */
+	enum Type
+	{
+		BOOL_SETTING,
+		INT_SETTING,
+		ENUM_SETTING,
+		DURATION_SETTING,
+		SIZE_SETTING
+	};
+
+	/**
+	 * Destructor unregisters the setting.
+	 */
+	virtual ~EnvironmentSetting();
+
+	/**
+	 * Returns the name of the environment variable the setting is read from.
+	 *
+	 * @return The name of the environment variable.
+	 */
+	inline const String& name() const { return _name; }
+
+	/**
+	 * Returns what the setting configures.
+	 *
+	 * @return The description of the setting.
+	 */
+	inline const String& description() const { return _description; }
+
+	/**
+	 * Returns the type of the setting.
+	 *
+	 * @return The type of the setting.
+	 */
+	inline Type type() const { return _type; }
+
+	/**
+	 * Returns whether the value came from the environment rather than the default.
+	 *
+	 * @return True if the environment variable holds a valid value, false otherwise.
+	 */
+	inline bool isSet() const { return _isSet.load(boost::memory_order_relaxed); }
+
+	/**
+	 * Formats the effective value the same way it would be written in the environment.
+	 *
+	 * @return The effective value.
+	 */
+	virtual String toString() const = 0;
+
+	/**
+	 * Formats the default value the same way it would be written in the environment.
+	 *
+	 * @return The default value.
+	 */
+	virtual String defaultString() const = 0;
+
+	/**
+	 * Parses the environment variable again.
+	 *
+	 * @return True if the variable is unset or valid, false if it could not be parsed.
+	 */
+	bool reload();
+
+	/**
+	 * Parses the environment variables of every registered setting again. Subsystems that copied a
+	 * setting when they started keep the copied value.
+	 *
+	 * @return True if every variable is unset or valid, false otherwise.
+	 */
+	static bool reloadAll();
+
+	/**
+	 * Formats the effective configuration of every registered setting, one per line and sorted by
+	 * name, along with whether each value came from the environment or the default.
+	 *
+	 * @return The effective configuration.
+	 */
+	static String dump();
+
+protected:
+
+	/**
+	 * Constructor. Subclasses must call reload() and then registerSetting() once they are
+	 * constructed, and unregisterSetting() when they are destroyed, so dump() and reloadAll()
+	 * never call into a setting that is only partly constructed or destroyed.
+	 *
+	 * @param name The name of the environment variable the setting is read from.
+	 * @param description What the setting configures.
+	 * @param type The type of the setting.
+	 */
+	EnvironmentSetting(const String& name, const String& description, Type type);
+
+	/**
+	 * @internal
+	 * Adds the fully constructed setting to the registry.
+	 */
+	void registerSetting();
+
+	/**
+	 * @internal
+	 * Removes the setting from the registry, which does nothing if it is not registered.
+	 */
+	void unregisterSetting();
+
+	/**
+	 * @internal
+	 * Parses the text of the environment variable into the value.
+	 *
+	 * @param text The text of the environment variable, which is never empty.
+	 * @return True if the text was valid, false otherwise.
+	 */
+	virtual bool parse(boost::string_ref text) = 0;
+
+	/**
+	 * @internal
+	 * Resets the value to the default.
+	 */
+	virtual void reset() = 0;
+
+	/**
+	 * @internal
+	 * Describes the values the setting accepts, for the warning printed about invalid values.
+	 *
+	 * @return The accepted values.
+	 */
+	virtual String acceptedValues() const = 0;
+
+	// Instance member variables
+	String				_name;			/**< @internal The name of the environment variable. */
+	String				_description;	/**< @internal What the setting configures. */
+	Type				_type;			/**< @internal The type of the setting. */
+	boost::atomic<bool>	_isSet;			/**< @internal Whether the value came from the environment. */
+
+private:
+
+	/**
+	 * @internal
+	 * Copy constructor. Settings cannot be copied.
+	 */
+	EnvironmentSetting(const EnvironmentSetting& setting);
+
+	/**
+	 * @internal
+	 * Overloaded assignment operator. Settings cannot be copied.
+	 */
+	void operator=(const EnvironmentSetting& setting);
+};
+
+/**
+ * A setting that is either on or off. Accepts the following values, ignoring case:
+ *	  - [ YES | TRUE | ON | ENABLE | 1 ] for true
+ *	  - [ NO | FALSE | OFF | DISABLE | NOPE | 0 ] for false
+ */
+class BUMP_EXPORT BoolSetting : public EnvironmentSetting
+{
+public:
+
+	/**
+	 * Constructor parses the environment variable.
+	 *
+	 * @param name The name of the environment variable.
+	 * @param defaultValue The value when the variable is unset or invalid.
+	 * @param description What the setting configures.
+	 */
+	BoolSetting(const String& name, bool defaultValue, const String& description);
+
+	/**
+	 * Destructor.
+	 */
+	~BoolSetting();
+
+	/**
+	 * Returns the effective value.
+	 *
+	 * @return The effective value.
+	 */
+	inline bool value() const { return _value.load(boost::memory_order_relaxed); }
+
+	/** @see EnvironmentSetting::toString() */
+	String toString() const;
+
+	/** @see EnvironmentSetting::defaultString() */
+	String defaultString() const;
+
+protected:
+
+	/** @internal @see EnvironmentSetting::parse() */
+	bool parse(boost::string_ref text);
+
+	/** @internal @see EnvironmentSetting::reset() */
+	void reset();
+
+	/** @internal @see EnvironmentSetting::acceptedValues() */
+	String acceptedValues() const;
+
+	// Instance member variables
+	bool				_defaultValue;	/**< @internal The value when the variable is unset or invalid. */
+	boost::atomic<bool>	_value;			/**< @internal The effective value. */
+};
+
+/**
+ * A setting holding an integer within an inclusive range.
+ */
+class BUMP_EXPORT IntSetting : public EnvironmentSetting
+{
+public:
+
+	/**
+	 * Constructor parses the environment variable.
+	 *
+	 * @param name The name of the environment variable.
+	 * @param defaultValue The value when the variable is unset or invalid.
+	 * @param description What the setting configures.
+	 * @param minimum The smallest valid value.
+	 * @param maximum The largest valid value.
+	 */
+	IntSetting(const String& name, long long defaultValue, const String& description,
+		long long minimum = -9223372036854775807LL - 1, long long maximum = 9223372036854775807LL);
+
+	/**
+	 * Destructor.
+	 */
+	~IntSetting();
+
+	/**
+	 * Returns the effective value.
+	 *
+	 * @return The effective value.
+	 */
+	inline long long value() const { return _value.load(boost::memory_order_relaxed); }
+
+	/** @see EnvironmentSetting::toString() */
+	String toString() const;
+
+	/** @see EnvironmentSetting::defaultString() */
+	String defaultString() const;
+
+protected:
+
+	/** @internal @see EnvironmentSetting::parse() */
+	bool parse(boost::string_ref text);
+
+	/** @internal @see EnvironmentSetting::reset() */
+	void reset();
+
+	/** @internal @see EnvironmentSetting::acceptedValues() */
+	String acceptedValues() const;
+
+	// Instance member variables
+	long long					_defaultValue;	/**< @internal The value when the variable is unset or invalid. */
+	long long					_minimum;		/**< @internal The smallest valid value. */
+	long long					_maximum;		/**< @internal The largest valid value. */
+	boost::atomic<long long>	_value;			/**< @internal The effective value. */
+};
+
+/**
+ * A setting choosing one of a fixed set of named values, matched ignoring case. The choices are
+ * usually an enum, cast back from value():
+ *
+ *   static const bump::EnumSetting::Choice choices[] = { { "FAST", FAST }, { "SAFE", SAFE } };
+ *   static const bump::EnumSetting setting("MYAPP_MODE", choices, 2, SAFE, "How to write files");
+ *   const Mode mode = static_cast<Mode>(setting.value());
+ */
+class BUMP_EXPORT EnumSetting : public EnvironmentSetting
+{
+public:
+
+	/** A named value of the setting. */
+	struct Choice
+	{
+		const char*	name;	/**< The name of the value in the environment. */
+		int			value;	/**< The value. */
+	};
+
+	/**
+	 * Constructor parses the environment variable.
+	 *
+	 * @param name The name of the environment variable.
+	 * @param choices The named values, which must live as long as the setting.
+	 * @param choiceCount The number of named values.
+	 * @param defaultValue The value when the variable is unset or invalid.
+	 * @param description What the setting configures.
+	 */
+	EnumSetting(const String& name, const Choice* choices, std::size_t choiceCount, int defaultValue, const String& description);
+
+	/**
+	 * Destructor.
+	 */
+	~EnumSetting();
+
+	/**
+	 * Returns the effective value.
+	 *
+	 * @return The effective value.
+	 */
+	inline int value() const { return _value.load(boost::memory_order_relaxed); }
+
+	/** @see EnvironmentSetting::toString() */
+	String toString() const;
+
+	/** @see EnvironmentSetting::defaultString() */
+	String defaultString() const;
+
+protected:
+
+	/** @internal @see EnvironmentSetting::parse() */
+	bool parse(boost::string_ref text);
+
+	/** @internal @see EnvironmentSetting::reset() */
+	void reset();
+
+	/** @internal @see EnvironmentSetting::acceptedValues() */
+	String acceptedValues() const;
+
+	/** @internal Returns the name of the given value. */
+	String nameOf(int value) const;
+
+	// Instance member variables
+	const Choice*		_choices;		/**< @internal The named values. */
+	std::size_t			_choiceCount;	/**< @internal The number of named values. */
+	int					_defaultValue;	/**< @internal The value when the variable is unset or invalid. */
+	boost::atomic<int>	_value;			/**< @internal The effective value. */
+};
+
+/**
+ * A setting holding a length of time, written as a number followed by a unit of [ ns | us | ms |
+ * s | m | h ], such as "250ms" or "1.5s". Numbers without a unit are seconds.
+ */
+class BUMP_EXPORT DurationSetting : public EnvironmentSetting
+{
+public:
+
+	/**
+	 * Constructor parses the environment variable.
+	 *
+	 * @param name The name of the environment variable.
+	 * @param defaultNanoseconds The duration in nanoseconds when the variable is unset or invalid.
+	 * @param description What the setting configures.
+	 */
+	DurationSetting(const String& name, unsigned long long defaultNanoseconds, const String& description);
+
+	/**
+	 * Destructor.
+	 */
+	~DurationSetting();
+
+	/**
+	 * Returns the effective duration in nanoseconds.
+	 *
+	 * @return The effective duration in nanoseconds.
+	 */
+	inline unsigned long long nanoseconds() const { return _nanoseconds.load(boost::memory_order_relaxed); }
+
+	/**
+	 * Returns the effective duration in seconds.
+	 *
+	 * @return The effective duration in seconds.
+	 */
+	inline double seconds() const { return nanoseconds() / 1000000000.0; }
+
+	/** @see EnvironmentSetting::toString() */
+	String toString() const;
+
+	/** @see EnvironmentSetting::defaultString() */
+	String defaultString() const;
+
+protected:
+
+	/** @internal @see EnvironmentSetting::parse() */
+	bool parse(boost::string_ref text);
+
+	/** @internal @see EnvironmentSetting::reset() */
+	void reset();
+
+	/** @internal @see EnvironmentSetting::acceptedValues() */
+	String acceptedValues() const;
+
+	// Instance member variables
+	unsigned long long					_defaultNanoseconds;	/**< @internal The duration when the variable is unset or invalid. */
+	boost::atomic<unsigned long long>	_nanoseconds;			/**< @internal The effective duration. */
+};
+
+/**
+ * A setting holding a number of bytes, written as a number followed by an optional unit of [ B |
+ * K | M | G | T ], such as "64K" or "1.5G". The units are powers of 1024, and may also be written
+ * as KB or KiB.
+ */
+class BUMP_EXPORT SizeSetting : public EnvironmentSetting
+{
+public:
+
+	/**
+	 * Constructor parses the environment variable.
+	 *
+	 * @param name The name of the environment variable.
+	 * @param defaultBytes The size in bytes when the variable is unset or invalid.
+	 * @param description What the setting configures.
+	 */
+	SizeSetting(const String& name, unsigned long long defaultBytes, const String& description);
+
+	/**
+	 * Destructor.
+	 */
+	~SizeSetting();
+
+	/**
+	 * Returns the effective size in bytes.
+	 *
+	 * @return The effective size in bytes.
+	 */
+	inline unsigned long long bytes() const { return _bytes.load(boost::memory_order_relaxed); }
+
+	/** @see EnvironmentSetting::toString() */
+	String toString() const;
+
+	/** @see EnvironmentSetting::defaultString() */
+	String defaultString() const;
+
+protected:
+
+	/** @internal @see EnvironmentSetting::parse() */
+	bool parse(boost::string_ref text);
+
+	/** @internal @see EnvironmentSetting::reset() */
+	void reset();
+
+	/** @internal @see EnvironmentSetting::acceptedValues() */
+	String acceptedValues() const;
+
+	// Instance member variables
+	unsigned long long					_defaultBytes;	/**< @internal The size when the variable is unset or invalid. */
+	boost::atomic<unsigned long long>	_bytes;			/**< @internal The effective size. */
+};
+
+}	// End of bump namespace
+
+#endif	// End of BUMP_ENVIRONMENT_SETTING_H
@@ -9,6 +9,9 @@
 #ifndef BUMP_EXCEPTION_H
 #define BUMP_EXCEPTION_H
 
+// C++ headers
+#include <vector>
+
 // Boost headers
 #include <boost/current_function.hpp>
 
@@ -20,11 +23,84 @@
  * The BUMP_LOCATION is used in exceptions to place the function name, filename and line number directly
  * into the description for the exception. This makes everything much easier to debug when exceptions are
  * actually thrown.
+ *
+ * The location only captures pointers to the compiler's static strings and the line number, and is not
+ * formatted until the description is requested, so throwing stays cheap.
  */
-#define BUMP_LOCATION bump::String("Function: ") + BOOST_CURRENT_FUNCTION + " File: " + __FILE__ + " Line: " + bump::String(__LINE__)
+#define BUMP_LOCATION bump::SourceLocation(BOOST_CURRENT_FUNCTION, __FILE__, __LINE__)
 
 namespace bump {
 
+/**
+ * The place in the source an exception was thrown from, as captured by BUMP_LOCATION.
+ *
+ * A location can also be created from a preformatted string, which lets existing code pass
+ * its own location text to the exceptions.
+ */
+class BUMP_EXPORT SourceLocation
+{
+public:
+
+	/**
+	 * Constructor. The strings must live as long as the process, as the compiler's do.
+	 *
+	 * @param function The name of the function.
+	 * @param file The path of the source file.
+	 * @param line The line number.
+	 */
+	SourceLocation(const char* function, const char* file, int line);
+
+	/**
+	 * Constructor taking a preformatted location.
+	 *
+	 * @param location The description of the location.
+	 */
+	SourceLocation(const String& location);
+
+	/**
+	 * Constructor taking a preformatted location.
+	 *
+	 * @param location The description of the location.
+	 */
+	SourceLocation(const char* location);
+
+	/**
+	 * Returns the name of the function.
+	 *
+	 * @return The name of the function, or NULL for a preformatted location.
+	 */
+	inline const char* function() const { return _function; }
+
+	/**
+	 * Returns the path of the source file.
+	 *
+	 * @return The path of the source file, or NULL for a preformatted location.
+	 */
+	inline const char* file() const { return _file; }
+
+	/**
+	 * Returns the line number.
+	 *
+	 * @return The line number, or 0 for a preformatted location.
+	 */
+	inline int line() const { return _line; }
+
+	/**
+	 * Formats the location as the function name, file path and line number.
+	 *
+	 * @return The description of the location.
+	 */
+	String description() const;
+
+protected:
+
+	// Instance member variables
+	const char*		_function;		/**< @internal The name of the function. */
+	const char*		_file;			/**< @internal The path of the source file. */
+	int				_line;			/**< @internal The line number. */
+	String			_location;		/**< @internal The preformatted location, if any. */
+};
+
 /**
  * A base class exception supporting both logic and runtime errors.
  *
@@ -63,7 +139,7 @@ public:
 	 * @param description The description of the exception.
 	 * @param location The file path, line number and function name of where the exception was thrown.
 	 */
-	void extendDescription(const String& description, const String& location);
+	void extendDescription(const String& description, const SourceLocation& location);
 
 protected:
 
@@ -71,15 +147,41 @@ protected:
 	 * @internal
 	 * Constructor.
 	 *
+	 * The class name is kept as a pointer rather than copied, so it must have static storage
+	 * duration, such as a string literal.
+	 *
+	 * @param className The class name of the sub-class exception, which must outlive the exception.
+	 * @param description The description of the exception.
+	 * @param location The file path, line number and function name of where the exception was thrown.
+	 */
+	Exception(const char* className, const String& description, const SourceLocation& location) throw();
+
+	/**
+	 * @internal
+	 * Constructor for class names that are not string literals. The name is copied once into
+	 * storage that lives as long as the process, then shared by every exception with that name.
+	 *
 	 * @param className The class name of the sub-class exception.
 	 * @param description The description of the exception.
 	 * @param location The file path, line number and function name of where the exception was thrown.
 	 */
-	Exception(const String& className, const String& description, const String& location) throw();
+	Exception(const String& className, const String& description, const SourceLocation& location) throw();
+
+	/**
+	 * @internal
+	 * A description of the exception and the location it was added at, formatted by description().
+	 */
+	struct Description
+	{
+		Description(const String& text, const SourceLocation& location) : text(text), location(location) {}
+
+		String			text;			/**< @internal The description. */
+		SourceLocation	location;		/**< @internal Where the description was added. */
+	};
 
 	// Instance member variables
-	String			_className;			/**< @internal The class name of the exception. */
-	StringList		_descriptions;		/**< @internal A list of descriptions each time an exception is thrown or re-thrown. */
+	const char*					_className;		/**< @internal The class name of the exception, with static storage duration. */
+	std::vector<Description>	_descriptions;	/**< @internal A list of descriptions each time an exception is thrown or re-thrown. */
 };
 
 /**
@@ -101,11 +203,25 @@ protected:
 	 * @internal
 	 * Constructor.
 	 *
+	 * The class name is kept as a pointer rather than copied, so it must have static storage
+	 * duration, such as a string literal.
+	 *
+	 * @param className The class name of the sub-class exception, which must outlive the exception.
+	 * @param description The description of the exception.
+	 * @param location The file path, line number and function name of where the exception was thrown.
+	 */
+	LogicError(const char* className, const String& description, const SourceLocation& location) throw();
+
+	/**
+	 * @internal
+	 * Constructor for class names that are not string literals. The name is copied once into
+	 * storage that lives as long as the process, then shared by every exception with that name.
+	 *
 	 * @param className The class name of the sub-class exception.
 	 * @param description The description of the exception.
 	 * @param location The file path, line number and function name of where the exception was thrown.
 	 */
-	LogicError(const String& className, const String& description, const String& location) throw();
+	LogicError(const String& className, const String& description, const SourceLocation& location) throw();
 };
 
 /**
@@ -127,11 +243,25 @@ protected:
 	 * @internal
 	 * Constructor.
 	 *
+	 * The class name is kept as a pointer rather than copied, so it must have static storage
+	 * duration, such as a string literal.
+	 *
+	 * @param className The class name of the sub-class exception, which must outlive the exception.
+	 * @param description The description of the exception.
+	 * @param location The file path, line number and function name of where the exception was thrown.
+	 */
+	RuntimeError(const char* className, const String& description, const SourceLocation& location) throw();
+
+	/**
+	 * @internal
+	 * Constructor for class names that are not string literals. The name is copied once into
+	 * storage that lives as long as the process, then shared by every exception with that name.
+	 *
 	 * @param className The class name of the sub-class exception.
 	 * @param description The description of the exception.
 	 * @param location The file path, line number and function name of where the exception was thrown.
 	 */
-	RuntimeError(const String& className, const String& description, const String& location) throw();
+	RuntimeError(const String& className, const String& description, const SourceLocation& location) throw();
 };
 
 }	// End of bump namespace
@@ -0,0 +1,246 @@
+//
+//	Executor.h
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+#ifndef BUMP_EXECUTOR_H
+#define BUMP_EXECUTOR_H
+
+// C++ headers
+#include <cstddef>
+#include <deque>
+#include <vector>
+
+// Boost headers
+#include <boost/atomic.hpp>
+#include <boost/function.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/future.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread.hpp>
+
+// Bump headers
+#include <bump/Export.h>
+
+// Defines the environment variables to configure the shared executor
+#define BUMP_EXECUTOR_THREADS	"BUMP_EXECUTOR_THREADS"
+#define BUMP_EXECUTOR_AFFINITY	"BUMP_EXECUTOR_AFFINITY"
+
+namespace bump {
+
+/**
+ * The Executor runs tasks on a fixed pool of worker threads that balance the load between
+ * themselves by work stealing.
+ *
+ * Each worker has its own deque of tasks. Tasks posted from a worker go to the back of its own
+ * deque, where it picks them up again most recently first while they are still in its cache, and
+ * idle workers steal the oldest tasks from the front of the other deques. Tasks posted from other
+ * threads are queued for whichever worker is free first. Workers sleep while there is nothing to
+ * run, so an idle executor costs nothing.
+ *
+ * Use the shared instance() rather than starting threads, so everything running in the process
+ * shares the cores instead of oversubscribing them. The following environment variables configure
+ * the shared executor:
+ *	  - BUMP_EXECUTOR_THREADS: The number of worker threads, where 0 uses one per core:
+ *		  * 8
+ *	  - BUMP_EXECUTOR_AFFINITY: Pins each worker thread to its own core:
+ *		  * [ YES | NO ]
+ *
+ * Tasks must not block waiting on futures of other tasks, since every worker could end up waiting.
+ * parallelFor() is safe to call from a task, because the calling thread runs tasks while it waits.
+ *
+ *   bump::Executor* executor = bump::Executor::instance();
+ *   boost::shared_future<int> count = executor->submit<int>(boost::bind(&countLines, path));
+ *   executor->parallelFor(0, images.size(), boost::bind(&resizeImage, &images, _1));
+ *   std::cout << count.get() << std::endl;
+ */
+class BUMP_EXPORT Executor
+{
+public:
+
+	// Typedefs
+	typedef boost::function<void ()> Task;
+	typedef boost::function<void (std::size_t)> IndexTask;
+
+	/**
+	 * Constructor starts the worker threads.
+	 *
+	 * @param threadCount The number of worker threads, where 0 uses one per core.
+	 * @param pinThreads Whether to pin each worker thread to its own core.
+	 */
+	Executor(unsigned int threadCount = 0, bool pinThreads = false);
+
+	/**
+	 * Destructor runs the tasks that are still queued, then stops the worker threads.
+	 */
+	~Executor();
+
+	/**
+	 * Returns the executor shared by the whole process, configured by the BUMP_EXECUTOR_THREADS and
+	 * BUMP_EXECUTOR_AFFINITY environment variables.
+	 *
+	 * @return The shared executor.
+	 */
+	static Executor* instance();
+
+	/**
+	 * Returns the number of worker threads.
+	 *
+	 * @return The number of worker threads.
+	 */
+	unsigned int threadCount() const;
+
+	/**
+	 * Queues a task to run on a worker thread.
+	 *
+	 * A task that throws is dropped, and the exception is logged. Use submit() to get the exception.
+	 *
+	 * This is thread-safe.
+	 *
+	 * @param task The task to run.
+	 */
+	void post(const Task& task);
+
+	/**
+	 * Queues a function to run on a worker thread, returning a future for its result.
+	 *
+	 * This is thread-safe.
+	 *
+	 * @param function The function to run.
+	 * @return The future of the result, which rethrows anything the function throws.
+	 */
+	template <typename R>
+	boost::shared_future<R> submit(const boost::function<R ()>& function);
+
+	/**
+	 * Runs the body for every index in a range, spread across the worker threads and the calling
+	 * thread, and returns once every index has run.
+	 *
+	 * The range is split in halves until the pieces are no larger than the grain size, and idle
+	 * workers steal the larger pieces that are left, so uneven bodies still keep every worker busy.
+	 * The calling thread runs tasks while there are any to take, then sleeps until the pieces still
+	 * running on the workers finish.
+	 *
+	 * This is thread-safe, and can be called from inside a task.
+	 *
+	 * @throw The first exception thrown by the body, once every other index has run.
+	 *
+	 * @param begin The first index.
+	 * @param end One past the last index.
+	 * @param body The function to run for each index.
+	 * @param grainSize The number of indices too few to be worth splitting up further.
+	 */
+	void parallelFor(std::size_t begin, std::size_t end, const IndexTask& body, std::size_t grainSize = 1);
+
+	/**
+	 * Returns whether the calling thread is one of this executor's workers.
+	 *
+	 * @return True if the calling thread is a worker, false otherwise.
+	 */
+	bool isWorkerThread() const;
+
+	/**
+	 * Returns the number of tasks workers have stolen from each other.
+	 *
+	 * @return The number of stolen tasks.
+	 */
+	unsigned long long stolenTasks() const;
+
+protected:
+
+	/** @internal A worker thread and its deque of tasks. */
+	struct Worker
+	{
+		boost::mutex		mutex;		/**< @internal Guards the tasks. */
+		std::deque<Task>	tasks;		/**< @internal The tasks, most recently posted at the back. */
+		boost::thread*		thread;		/**< @internal The worker thread. */
+	};
+
+	/** @internal The progress of a parallelFor() shared by the pieces of its range. */
+	struct ParallelFor;
+
+	/**
+	 * @internal
+	 * Takes the next task for the calling thread from its own deque, the queue of tasks posted from
+	 * other threads, or the deque of another worker, in that order.
+	 *
+	 * @param task The task that was taken.
+	 * @return True if a task was taken, false if there are none.
+	 */
+	bool takeTask(Task& task);
+
+	/**
+	 * @internal
+	 * Runs a task, logging anything it throws.
+	 *
+	 * @param task The task to run.
+	 */
+	static void runTask(const Task& task);
+
+	/**
+	 * @internal
+	 * The loop of each worker thread.
+	 *
+	 * @param index The index of the worker.
+	 * @param pinThread Whether to pin the worker thread to a core.
+	 */
+	void runWorker(unsigned int index, bool pinThread);
+
+	/**
+	 * @internal
+	 * Runs a piece of a parallelFor() range, splitting off the upper halves as tasks for others to steal.
+	 */
+	void runRange(ParallelFor* parallelFor, std::size_t begin, std::size_t end);
+
+	/**
+	 * @internal
+	 * Pins the calling thread to a core (platform specific).
+	 *
+	 * @param cpu The index of the core.
+	 * @return True if the thread was pinned, false otherwise.
+	 */
+	static bool pinCurrentThread(unsigned int cpu);
+
+	/**
+	 * @internal
+	 * Runs a function and fulfills its promise with the result or the exception it throws.
+	 */
+	template <typename R>
+	static void fulfill(const boost::shared_ptr<boost::promise<R> >& promise, const boost::function<R ()>& function);
+
+	// Instance member variables
+	std::vector<Worker*>				_workers;			/**< @internal The worker threads. */
+	boost::mutex						_injectedMutex;		/**< @internal Guards the tasks posted from other threads. */
+	std::deque<Task>					_injectedTasks;		/**< @internal The tasks posted from other threads. */
+	boost::atomic<unsigned long long>	_pendingTasks;		/**< @internal The number of queued tasks. */
+	boost::atomic<unsigned int>			_sleepingWorkers;	/**< @internal The number of workers waiting for tasks. */
+	boost::atomic<unsigned long long>	_stolenTasks;		/**< @internal The number of stolen tasks. */
+	boost::mutex						_sleepMutex;		/**< @internal Guards sleeping and waking the workers. */
+	boost::condition_variable			_wakeCondition;		/**< @internal Wakes the workers when tasks are posted. */
+	bool								_isStopping;		/**< @internal Whether the destructor is stopping the workers. */
+
+private:
+
+	/**
+	 * @internal
+	 * Copy constructor. Executors cannot be copied.
+	 */
+	Executor(const Executor& executor);
+
+	/**
+	 * @internal
+	 * Overloaded assignment operator. Executors cannot be copied.
+	 */
+	void operator=(const Executor& executor);
+};
+
+}	// End of bump namespace
+
+// Pull in the Executor template implementations
+#include <bump/Executor_impl.h>
+
+#endif	// End of BUMP_EXECUTOR_H
@@ -0,0 +1,56 @@
+//
+//	Executor_impl.h
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+#ifndef BUMP_EXECUTOR_IMPL_H
+#define BUMP_EXECUTOR_IMPL_H
+
+// Boost headers
+#include <boost/bind.hpp>
+#include <boost/exception_ptr.hpp>
+
+namespace bump {
+
+template <typename R>
+boost::shared_future<R> Executor::submit(const boost::function<R ()>& function)
+{
+	boost::shared_ptr<boost::promise<R> > promise(new boost::promise<R>());
+	boost::shared_future<R> future(promise->get_future());
+	post(boost::bind(&Executor::fulfill<R>, promise, function));
+	return future;
+}
+
+template <typename R>
+void Executor::fulfill(const boost::shared_ptr<boost::promise<R> >& promise, const boost::function<R ()>& function)
+{
+	try
+	{
+		promise->set_value(function());
+	}
+	catch (...)
+	{
+		promise->set_exception(boost::current_exception());
+	}
+}
+
+template <>
+inline void Executor::fulfill<void>(const boost::shared_ptr<boost::promise<void> >& promise, const boost::function<void ()>& function)
+{
+	try
+	{
+		function();
+		promise->set_value();
+	}
+	catch (...)
+	{
+		promise->set_exception(boost::current_exception());
+	}
+}
+
+}	// End of bump namespace
+
+#endif	// End of BUMP_EXECUTOR_IMPL_H
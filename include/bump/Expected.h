@@ -0,0 +1,221 @@
+//
+//	Expected.h
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+#ifndef BUMP_EXPECTED_H
+#define BUMP_EXPECTED_H
+
+// Boost headers
+#include <boost/system/error_code.hpp>
+
+// Bump headers
+#include <bump/Export.h>
+
+namespace bump {
+
+// Forward declarations
+class String;
+
+/**
+ * The Result of an operation that reports failures by value rather than by throwing.
+ *
+ * A failed result carries the type of exception the throwing version of the operation would have
+ * thrown, a static description of what failed, and the system error code of the cause, so the
+ * failure can be handled without unwinding and diagnosed without repeating the operation. Results
+ * never allocate, which keeps failing on hot paths cheap.
+ *
+ *   bump::Result result = bump::FileSystem::tryCopyFile(source, destination);
+ *   if (result.isError() && result.code() == boost::system::errc::permission_denied)
+ *   {
+ *       ...
+ *   }
+ */
+class BUMP_EXPORT Result
+{
+public:
+
+	/** The types of failures, named after the exceptions the throwing operations use for them. */
+	enum Type
+	{
+		SUCCESS,
+		FILE_SYSTEM_ERROR,
+		INVALID_ARGUMENT_ERROR,
+		OUT_OF_RANGE_ERROR,
+		STRING_SEARCH_ERROR,
+		TYPE_CAST_ERROR
+	};
+
+	/**
+	 * Constructor for a successful result.
+	 */
+	Result();
+
+	/**
+	 * Constructor for a failed result.
+	 *
+	 * @param type The type of failure.
+	 * @param description What failed, which must be a string literal or otherwise live as long as the process.
+	 * @param code The system error code of the cause.
+	 */
+	Result(Type type, const char* description, const boost::system::error_code& code);
+
+	/**
+	 * Constructor for a failed result.
+	 *
+	 * @param type The type of failure.
+	 * @param description What failed, which must be a string literal or otherwise live as long as the process.
+	 * @param code The system error condition of the cause.
+	 */
+	Result(Type type, const char* description, boost::system::errc::errc_t code);
+
+	/**
+	 * Returns whether the operation succeeded.
+	 *
+	 * @return True if the operation succeeded, false otherwise.
+	 */
+	inline bool isSuccess() const { return _type == SUCCESS; }
+
+	/**
+	 * Returns whether the operation failed.
+	 *
+	 * @return True if the operation failed, false otherwise.
+	 */
+	inline bool isError() const { return _type != SUCCESS; }
+
+	/**
+	 * Returns the type of failure.
+	 *
+	 * @return The type of failure, or SUCCESS.
+	 */
+	inline Type type() const { return _type; }
+
+	/**
+	 * Returns what failed.
+	 *
+	 * @return The description of the failure, or an empty string on success.
+	 */
+	inline const char* description() const { return _description; }
+
+	/**
+	 * Returns the system error code of the cause.
+	 *
+	 * @return The error code, which is empty on success.
+	 */
+	inline const boost::system::error_code& code() const { return _code; }
+
+	/**
+	 * Formats the description along with the message of the error code.
+	 *
+	 * @return The message, or an empty string on success.
+	 */
+	String message() const;
+
+	/**
+	 * Throws the exception the throwing version of the operation would have thrown. Does nothing
+	 * on success.
+	 *
+	 * @throw bump::Exception The exception matching the type of failure.
+	 */
+	void throwError() const;
+
+protected:
+
+	// Instance member variables
+	Type						_type;			/**< @internal The type of failure. */
+	const char*					_description;	/**< @internal What failed. */
+	boost::system::error_code	_code;			/**< @internal The system error code of the cause. */
+};
+
+/**
+ * Either the value of an operation that succeeded, or the Result of why it failed.
+ *
+ * The value type must be default constructible and copyable.
+ *
+ *   const bump::Expected<int> port = portString.tryToInt();
+ *   if (port.hasValue())
+ *   {
+ *       connect(port.value());
+ *   }
+ */
+template <typename T>
+class Expected
+{
+public:
+
+	/**
+	 * Constructor for a successful operation.
+	 *
+	 * @param value The value of the operation.
+	 */
+	Expected(const T& value) :
+		_value(value),
+		_result()
+	{
+		;
+	}
+
+	/**
+	 * Constructor for a failed operation.
+	 *
+	 * @param result Why the operation failed.
+	 */
+	Expected(const Result& result) :
+		_value(),
+		_result(result)
+	{
+		;
+	}
+
+	/**
+	 * Returns whether the operation succeeded.
+	 *
+	 * @return True if there is a value, false otherwise.
+	 */
+	inline bool hasValue() const { return _result.isSuccess(); }
+
+	/**
+	 * Returns the value of the operation.
+	 *
+	 * @throw bump::Exception The exception matching the failure when there is no value.
+	 *
+	 * @return The value.
+	 */
+	inline const T& value() const
+	{
+		if (_result.isError())
+		{
+			_result.throwError();
+		}
+
+		return _value;
+	}
+
+	/**
+	 * Returns the value of the operation, or the given value if it failed.
+	 *
+	 * @param defaultValue The value to return if the operation failed.
+	 * @return The value.
+	 */
+	inline T valueOr(const T& defaultValue) const { return _result.isSuccess() ? _value : defaultValue; }
+
+	/**
+	 * Returns why the operation failed.
+	 *
+	 * @return The result, which is successful when there is a value.
+	 */
+	inline const Result& result() const { return _result; }
+
+protected:
+
+	// Instance member variables
+	T			_value;		/**< @internal The value, or a default value on failure. */
+	Result		_result;	/**< @internal Why the operation failed. */
+};
+
+}	// End of bump namespace
+
+#endif	// End of BUMP_EXPECTED_H
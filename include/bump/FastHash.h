@@ -0,0 +1,165 @@
+//
+//	FastHash.h
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+#ifndef BUMP_FAST_HASH_H
+#define BUMP_FAST_HASH_H
+
+// C++ headers
+#include <cstddef>
+
+// Bump headers
+#include <bump/Export.h>
+#include <bump/String.h>
+
+namespace bump {
+
+/**
+ * A 128 bit hash value produced by the FastHash 128 bit variants.
+ */
+struct BUMP_EXPORT Hash128
+{
+	unsigned long long low;		/**< The low 64 bits of the hash. */
+	unsigned long long high;	/**< The high 64 bits of the hash. */
+
+	bool operator==(const Hash128& rhs) const { return low == rhs.low && high == rhs.high; }
+	bool operator!=(const Hash128& rhs) const { return !(*this == rhs); }
+	bool operator<(const Hash128& rhs) const { return high < rhs.high || (high == rhs.high && low < rhs.low); }
+};
+
+/**
+ * The FastHash class generates fast non-cryptographic 64 and 128 bit hashes. It is intended
+ * for hash tables, sharding and cache keys where the strength of CryptographicHash is not
+ * needed and its speed is too low.
+ *
+ * The hashes are produced by the XXH3 algorithm and are bit-for-bit compatible with the
+ * XXH3_64bits and XXH3_128bits functions of the reference xxHash library (including the
+ * seeded variants). Large inputs are processed with SSE2, or AVX2 when the CPU supports it.
+ *
+ * Data can be hashed in a single call with hash64() and hash128(), or incrementally by
+ * calling update() as many times as needed and then result64() or result128():
+ *
+ *   bump::FastHash hash;
+ *   hash.update(header, headerLength);
+ *   hash.update(body, bodyLength);
+ *   unsigned long long key = hash.result64();
+ *
+ * Unlike CryptographicHash, hashing zero bytes of data produces a valid hash.
+ */
+class BUMP_EXPORT FastHash
+{
+public:
+
+	/**
+	 * Constructor.
+	 *
+	 * @param seed The seed to use for the incremental hash.
+	 */
+	FastHash(unsigned long long seed = 0);
+
+	/**
+	 * Destructor.
+	 */
+	~FastHash();
+
+	/**
+	 * Adds textual data to the incremental hash.
+	 *
+	 * @param data The data string to add to the hash.
+	 */
+	void update(const String& data);
+
+	/**
+	 * Adds binary data to the incremental hash.
+	 *
+	 * @param data The binary data to add to the hash.
+	 * @param length The length of the binary data.
+	 */
+	void update(const char* data, std::size_t length);
+
+	/**
+	 * Discards all data added so far and starts a new incremental hash.
+	 *
+	 * @param seed The seed to use for the new incremental hash.
+	 */
+	void reset(unsigned long long seed = 0);
+
+	/**
+	 * Computes the 64 bit hash of all the data added so far. More data can still be added afterwards.
+	 *
+	 * @return The 64 bit hash.
+	 */
+	unsigned long long result64() const;
+
+	/**
+	 * Computes the 128 bit hash of all the data added so far. More data can still be added afterwards.
+	 *
+	 * @return The 128 bit hash.
+	 */
+	Hash128 result128() const;
+
+	/**
+	 * Computes the 64 bit hash of the textual data.
+	 *
+	 * @param data The data string to hash.
+	 * @param seed The seed to use for the hash.
+	 * @return The 64 bit hash.
+	 */
+	static unsigned long long hash64(const String& data, unsigned long long seed = 0);
+
+	/**
+	 * Computes the 64 bit hash of the binary data.
+	 *
+	 * @param data The binary data to hash.
+	 * @param length The length of the binary data.
+	 * @param seed The seed to use for the hash.
+	 * @return The 64 bit hash.
+	 */
+	static unsigned long long hash64(const char* data, std::size_t length, unsigned long long seed = 0);
+
+	/**
+	 * Computes the 128 bit hash of the textual data.
+	 *
+	 * @param data The data string to hash.
+	 * @param seed The seed to use for the hash.
+	 * @return The 128 bit hash.
+	 */
+	static Hash128 hash128(const String& data, unsigned long long seed = 0);
+
+	/**
+	 * Computes the 128 bit hash of the binary data.
+	 *
+	 * @param data The binary data to hash.
+	 * @param length The length of the binary data.
+	 * @param seed The seed to use for the hash.
+	 * @return The 128 bit hash.
+	 */
+	static Hash128 hash128(const char* data, std::size_t length, unsigned long long seed = 0);
+
+protected:
+
+	/**
+	 * @internal
+	 * Finishes a copy of the accumulators for inputs longer than the internal buffer.
+	 *
+	 * @param accumulators The 8 accumulators to finish.
+	 */
+	void finishAccumulators(unsigned long long* accumulators) const;
+
+	// Instance member variables
+	unsigned long long		_accumulators[8];		/**< @internal The long input accumulators. */
+	unsigned char			_secret[192];			/**< @internal The secret derived from the seed. */
+	unsigned char			_buffer[256];			/**< @internal The data not yet accumulated. */
+	unsigned int			_bufferedSize;			/**< @internal The number of bytes in the buffer. */
+	unsigned int			_stripesSoFar;			/**< @internal The number of stripes accumulated in the current block. */
+	unsigned long long		_totalLength;			/**< @internal The total number of bytes added. */
+	unsigned long long		_seed;					/**< @internal The seed of the hash. */
+};
+
+}	// End of bump namespace
+
+#endif	// End of BUMP_FAST_HASH_H
@@ -13,6 +13,7 @@
 #include <boost/filesystem/path.hpp>
 
 // Bump headers
+#include <bump/Expected.h>
 #include <bump/Export.h>
 #include <bump/String.h>
 
@@ -70,6 +71,13 @@ public:
 	 */
 	unsigned long long fileSize() const;
 
+	/**
+	 * Returns the file size of the path without throwing.
+	 *
+	 * @return File size of path if exists and is file, otherwise a FILE_SYSTEM_ERROR result.
+	 */
+	Expected<unsigned long long> tryFileSize() const;
+
 	/**
 	 * Returns whether the path is an absolute path.
 	 *
@@ -115,6 +123,14 @@ public:
 	 */
 	bool isEmpty() const;
 
+	/**
+	 * Returns whether the path points an empty directory or empty file without throwing.
+	 *
+	 * @return Whether the path is empty, or a FILE_SYSTEM_ERROR result when the path does not exist
+	 *         or cannot be checked.
+	 */
+	Expected<bool> tryIsEmpty() const;
+
 	/**
 	 * Returns whether the path points to a hidden file.
 	 *
@@ -434,6 +450,14 @@ public:
 	 */
 	std::time_t modifiedDate() const;
 
+	/**
+	 * Returns the date the file system object was last modified without throwing.
+	 *
+	 * @return The date the file system object was last modified, or a FILE_SYSTEM_ERROR result
+	 *         when the path does not exist.
+	 */
+	Expected<std::time_t> tryModifiedDate() const;
+
 protected:
 
 	/**
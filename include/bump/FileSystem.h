@@ -13,6 +13,7 @@
 #include <bump/Export.h>
 #include <bump/FileInfo.h>
 #include <bump/String.h>
+#include <bump/StringTable.h>
 
 namespace bump {
 
@@ -280,6 +281,16 @@ BUMP_EXPORT bool isSymbolicLink(const String& path);
  */
 BUMP_EXPORT bool createDirectory(const String& path);
 
+/**
+ * Creates the directory specified, reporting why it failed.
+ *
+ * @see createDirectory()
+ *
+ * @param path The path of the directory to create.
+ * @return A successful result, or a FILE_SYSTEM_ERROR result with the cause of the failure.
+ */
+BUMP_EXPORT Result tryCreateDirectory(const String& path);
+
 /**
  * Creates the full path for the directory specified.
  *
@@ -290,6 +301,16 @@ BUMP_EXPORT bool createDirectory(const String& path);
  */
 BUMP_EXPORT bool createFullDirectoryPath(const String& path);
 
+/**
+ * Creates the full path for the directory specified, reporting why it failed.
+ *
+ * @see createFullDirectoryPath()
+ *
+ * @param path The path of the directory to create.
+ * @return A successful result, or a FILE_SYSTEM_ERROR result with the cause of the failure.
+ */
+BUMP_EXPORT Result tryCreateFullDirectoryPath(const String& path);
+
 /**
  * Removes the specified directory if it is empty.
  *
@@ -300,6 +321,16 @@ BUMP_EXPORT bool createFullDirectoryPath(const String& path);
  */
 BUMP_EXPORT bool removeDirectory(const String& path);
 
+/**
+ * Removes the specified directory if it is empty, reporting why it failed.
+ *
+ * @see removeDirectory()
+ *
+ * @param path The path of the directory to remove.
+ * @return A successful result, or a FILE_SYSTEM_ERROR result with the cause of the failure.
+ */
+BUMP_EXPORT Result tryRemoveDirectory(const String& path);
+
 /**
  * Removes the specified directory's contents recursively, then removes the directory itself.
  *
@@ -308,6 +339,16 @@ BUMP_EXPORT bool removeDirectory(const String& path);
  */
 BUMP_EXPORT bool removeDirectoryAndContents(const String& path);
 
+/**
+ * Removes the specified directory and its contents, reporting why it failed.
+ *
+ * @see removeDirectoryAndContents()
+ *
+ * @param path The path of the directory to remove.
+ * @return A successful result, or a FILE_SYSTEM_ERROR result with the cause of the failure.
+ */
+BUMP_EXPORT Result tryRemoveDirectoryAndContents(const String& path);
+
 /**
  * Copies the source directory over to the destination directory.
  *
@@ -322,6 +363,17 @@ BUMP_EXPORT bool removeDirectoryAndContents(const String& path);
  */
 BUMP_EXPORT bool copyDirectory(const String& source, const String& destination);
 
+/**
+ * Copies the source directory over to the destination directory, reporting why it failed.
+ *
+ * @see copyDirectory()
+ *
+ * @param source The source directory to copy.
+ * @param destination The destination directory to copy the source directory to.
+ * @return A successful result, or a FILE_SYSTEM_ERROR result with the cause of the failure.
+ */
+BUMP_EXPORT Result tryCopyDirectory(const String& source, const String& destination);
+
 /**
  * Copies the source directory and all contents over to the destination directory.
  *
@@ -340,6 +392,17 @@ BUMP_EXPORT bool copyDirectoryAndContents(const String& source, const String& de
  */
 BUMP_EXPORT bool renameDirectory(const String& source, const String& destination);
 
+/**
+ * Renames the source directory to the destination directory, reporting why it failed.
+ *
+ * @see renameDirectory()
+ *
+ * @param source The source directory to rename.
+ * @param destination The destination directory to rename the source directory to.
+ * @return A successful result, or a FILE_SYSTEM_ERROR result with the cause of the failure.
+ */
+BUMP_EXPORT Result tryRenameDirectory(const String& source, const String& destination);
+
 /**
  * Creates a list of file system object paths contained within the directory.
  *
@@ -351,6 +414,34 @@ BUMP_EXPORT bool renameDirectory(const String& source, const String& destination
  */
 BUMP_EXPORT StringList directoryList(const String& path);
 
+/**
+ * Creates a sorted list of file system object paths contained within the directory, allocated
+ * from an arena.
+ *
+ * @see bump::MonotonicArena
+ *
+ * @throw bump::FileSystemError When the path does not exist.
+ * @throw bump::FileSystemError When the path is not a directory.
+ *
+ * @param path The path of the directory.
+ * @param resource The memory resource to allocate the list and the paths from.
+ * @return A string list of all the file system object paths contained within the directory.
+ */
+BUMP_EXPORT ArenaStringList directoryList(const String& path, MemoryResource* resource);
+
+/**
+ * Creates a sorted, contiguous string table of file system object paths contained within the directory.
+ *
+ * @see bump::StringTable
+ *
+ * @throw bump::FileSystemError When the path does not exist.
+ * @throw bump::FileSystemError When the path is not a directory.
+ *
+ * @param path The path of the directory.
+ * @return A string table of all the file system object paths contained within the directory.
+ */
+BUMP_EXPORT StringTable directoryTable(const String& path);
+
 /**
  * Creates a list of FileInfo objects contained within the directory.
  *
@@ -374,6 +465,16 @@ BUMP_EXPORT FileInfoList directoryInfoList(const String& path);
  */
 BUMP_EXPORT bool createFile(const String& path);
 
+/**
+ * Creates the file specified, reporting why it failed.
+ *
+ * @see createFile()
+ *
+ * @param path The path of the file to create.
+ * @return A successful result, or a FILE_SYSTEM_ERROR result with the cause of the failure.
+ */
+BUMP_EXPORT Result tryCreateFile(const String& path);
+
 /**
  * Removes the file specified.
  *
@@ -382,6 +483,16 @@ BUMP_EXPORT bool createFile(const String& path);
  */
 BUMP_EXPORT bool removeFile(const String& path);
 
+/**
+ * Removes the file specified, reporting why it failed.
+ *
+ * @see removeFile()
+ *
+ * @param path The path of the file to remove.
+ * @return A successful result, or a FILE_SYSTEM_ERROR result with the cause of the failure.
+ */
+BUMP_EXPORT Result tryRemoveFile(const String& path);
+
 /**
  * Copies the source file over to the destination filepath.
  *
@@ -391,6 +502,17 @@ BUMP_EXPORT bool removeFile(const String& path);
  */
 BUMP_EXPORT bool copyFile(const String& source, const String& destination);
 
+/**
+ * Copies the source file over to the destination filepath, reporting why it failed.
+ *
+ * @see copyFile()
+ *
+ * @param source The source file to copy.
+ * @param destination The destination file to copy the source file to.
+ * @return A successful result, or a FILE_SYSTEM_ERROR result with the cause of the failure.
+ */
+BUMP_EXPORT Result tryCopyFile(const String& source, const String& destination);
+
 /**
  * Renames the source file to the destination filepath.
  *
@@ -400,6 +522,17 @@ BUMP_EXPORT bool copyFile(const String& source, const String& destination);
  */
 BUMP_EXPORT bool renameFile(const String& source, const String& destination);
 
+/**
+ * Renames the source file to the destination filepath, reporting why it failed.
+ *
+ * @see renameFile()
+ *
+ * @param source The source file to rename.
+ * @param destination The destination file to rename the source file to.
+ * @return A successful result, or a FILE_SYSTEM_ERROR result with the cause of the failure.
+ */
+BUMP_EXPORT Result tryRenameFile(const String& source, const String& destination);
+
 //====================================================================================
 //                               Symbolic Link Methods
 //====================================================================================
@@ -29,7 +29,7 @@ public:
 	 * @param description The description of the exception.
 	 * @param location The file path, line number and function name of where the exception was thrown.
 	 */
-	FileSystemError(const String& description, const String& location) throw();
+	FileSystemError(const String& description, const SourceLocation& location) throw();
 
 	/**
 	 * Destructor.
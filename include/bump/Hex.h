@@ -0,0 +1,77 @@
+//
+//	Hex.h
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+#ifndef BUMP_HEX_H
+#define BUMP_HEX_H
+
+// Bump headers
+#include <bump/Export.h>
+#include <bump/String.h>
+
+namespace bump {
+
+/**
+ * The Hex namespace converts binary data to and from lowercase hexadecimal text. It is
+ * shared by CryptographicHash and Uuid, and processes 16 bytes at a time with SSE2 when
+ * the target supports it.
+ */
+namespace Hex {
+
+/**
+ * Encodes binary data as lowercase hex digits into a caller-provided buffer.
+ *
+ * @param data The binary data to encode.
+ * @param length The length of the binary data in bytes.
+ * @param hex The buffer to write the hex digits to. It must hold at least 2 * length characters
+ *            and is not null terminated.
+ */
+BUMP_EXPORT void encode(const unsigned char* data, unsigned int length, char* hex);
+
+/**
+ * Encodes binary data as a string of lowercase hex digits.
+ *
+ * @param data The binary data to encode.
+ * @param length The length of the binary data in bytes.
+ * @return A string containing 2 * length hex digits.
+ */
+BUMP_EXPORT String encode(const unsigned char* data, unsigned int length);
+
+/**
+ * Decodes hex digits into binary data. Both uppercase and lowercase digits are accepted.
+ *
+ * @param hex The hex digits to decode.
+ * @param length The number of hex digits, which must be even.
+ * @param data The buffer to write the binary data to. It must hold at least length / 2 bytes.
+ * @return True if every character was a hex digit and the length was even, otherwise false. The
+ *         contents of data are unspecified when false is returned.
+ */
+BUMP_EXPORT bool decode(const char* hex, unsigned int length, unsigned char* data);
+
+/**
+ * Encodes 16 bytes as the canonical 36 character uuid form ("xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx").
+ *
+ * @param data The 16 bytes to encode.
+ * @param chars The buffer to write to. It must hold at least 36 characters and is not null terminated.
+ */
+BUMP_EXPORT void encodeUuid(const unsigned char* data, char* chars);
+
+/**
+ * Decodes the canonical 36 character uuid form ("xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx") into 16 bytes.
+ *
+ * @param chars The 36 characters to decode.
+ * @param data The buffer of at least 16 bytes to write to.
+ * @return True if the dashes were in place and every other character was a hex digit, otherwise false.
+ *         The contents of data are unspecified when false is returned.
+ */
+BUMP_EXPORT bool decodeUuid(const char* chars, unsigned char* data);
+
+}	// End of Hex namespace
+
+}	// End of bump namespace
+
+#endif	// End of BUMP_HEX_H
@@ -0,0 +1,224 @@
+//
+//	LatencyHistogram.h
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+#ifndef BUMP_LATENCY_HISTOGRAM_H
+#define BUMP_LATENCY_HISTOGRAM_H
+
+// C++ headers
+#include <cstddef>
+#include <vector>
+
+// Boost headers
+#include <boost/thread/mutex.hpp>
+
+// Bump headers
+#include <bump/Export.h>
+#include <bump/String.h>
+
+namespace bump {
+
+/**
+ * The LatencyHistogram records the distribution of many latencies (in nanoseconds) so
+ * percentiles can be reported without storing every sample.
+ *
+ * Samples are counted in log-linear buckets in the style of an HDR histogram: every power of
+ * two range is split into 64 equal sub-buckets, so any recorded value is reported within about
+ * 1.6% of its true value from 1 ns up to hundreds of years.
+ *
+ * Each thread records into its own shard of buckets, so recording never takes a lock or
+ * contends with other threads and costs a few nanoseconds. Queries merge the shards on demand.
+ *
+ * Histograms can be created directly, or looked up by name in a process wide registry so
+ * that AutoTimers in different modules can share them and they can be periodically logged:
+ *
+ *   bump::LatencyHistogram* histogram = bump::LatencyHistogram::named("database.query");
+ *   {
+ *       bump::AutoTimer timer(*histogram);
+ *       ...
+ *   }
+ *   bump::LatencyHistogram::startPeriodicLogging(60);
+ */
+class BUMP_EXPORT LatencyHistogram
+{
+public:
+
+	/**
+	 * Constructor creates an empty histogram.
+	 *
+	 * @param name The name of the histogram used when logging it.
+	 */
+	LatencyHistogram(const String& name = "");
+
+	/**
+	 * Destructor. No other thread may be recording into the histogram when it is destroyed.
+	 */
+	~LatencyHistogram();
+
+	/**
+	 * Returns the histogram with the given name from the registry, creating it the first time.
+	 * Registered histograms live until the process exits, so the pointer can be cached.
+	 *
+	 * This is thread-safe.
+	 *
+	 * @param name The name of the histogram.
+	 * @return The histogram with the given name.
+	 */
+	static LatencyHistogram* named(const String& name);
+
+	/**
+	 * Logs the summary of every registered histogram that has samples at the info level.
+	 */
+	static void logAll();
+
+	/**
+	 * Starts a background thread that calls logAll() at a fixed interval, replacing any
+	 * previously started one.
+	 *
+	 * @param intervalSeconds The number of seconds between logs.
+	 */
+	static void startPeriodicLogging(unsigned int intervalSeconds);
+
+	/**
+	 * Stops the background thread started by startPeriodicLogging().
+	 */
+	static void stopPeriodicLogging();
+
+	/**
+	 * Returns the name of the histogram.
+	 *
+	 * @return The name of the histogram.
+	 */
+	const String& name() const;
+
+	/**
+	 * Records a single sample. This is thread-safe and lock-free.
+	 *
+	 * @param nanoseconds The latency to record.
+	 */
+	void record(unsigned long long nanoseconds);
+
+	/**
+	 * Adds every sample of the other histogram to this histogram.
+	 *
+	 * @param histogram The histogram to merge into this one.
+	 */
+	void merge(const LatencyHistogram& histogram);
+
+	/**
+	 * Removes all the samples. Samples recorded by other threads while resetting may be lost.
+	 *
+	 * Only the thread that owns a shard ever writes its counters, so resetting just marks every
+	 * shard as cleared. Queries skip marked shards, and each thread zeroes its own shard the next
+	 * time it records.
+	 */
+	void reset();
+
+	/**
+	 * Returns the number of samples recorded.
+	 *
+	 * @return The number of samples.
+	 */
+	unsigned long long count() const;
+
+	/**
+	 * Returns the smallest sample recorded.
+	 *
+	 * @return The smallest sample, or 0 if there are no samples.
+	 */
+	unsigned long long min() const;
+
+	/**
+	 * Returns the largest sample recorded.
+	 *
+	 * @return The largest sample, or 0 if there are no samples.
+	 */
+	unsigned long long max() const;
+
+	/**
+	 * Returns the mean of the samples recorded.
+	 *
+	 * @return The mean of the samples, or 0 if there are no samples.
+	 */
+	double mean() const;
+
+	/**
+	 * Returns the value that the given percentage of the samples are less than or equal to,
+	 * e.g. 50.0 for the median or 99.9 for the p999.
+	 *
+	 * @param percentile The percentile between 0.0 and 100.0.
+	 * @return The percentile value, or 0 if there are no samples.
+	 */
+	unsigned long long percentile(double percentile) const;
+
+	/**
+	 * Returns a one line summary of the histogram with its count, min, p50, p90, p99, p999
+	 * and max in nanoseconds.
+	 *
+	 * @return The summary of the histogram.
+	 */
+	String summary() const;
+
+protected:
+
+	/** @internal The per-thread buckets, defined in the source file. */
+	struct Shard;
+
+	/** @internal The totals of all the shards. */
+	struct Totals
+	{
+		std::vector<unsigned long long> counts;
+		unsigned long long count;
+		unsigned long long sum;
+		unsigned long long min;
+		unsigned long long max;
+	};
+
+	/**
+	 * @internal
+	 * Returns the calling thread's shard, creating it the first time the thread records.
+	 */
+	Shard* threadShard();
+
+	/**
+	 * @internal
+	 * Sums the buckets and statistics of every shard.
+	 */
+	void totals(Totals& totals) const;
+
+	/**
+	 * @internal
+	 * Returns the percentile value from previously computed totals.
+	 */
+	static unsigned long long percentile(const Totals& totals, double percentile);
+
+	/**
+	 * @internal
+	 * Copy constructor.
+	 *
+	 * No-op since the shards cannot be shared.
+	 */
+	LatencyHistogram(const LatencyHistogram& histogram);
+
+	/**
+	 * @internal
+	 * Overloaded assignment operator.
+	 *
+	 * No-op since the shards cannot be shared.
+	 */
+	void operator=(const LatencyHistogram& histogram);
+
+	// Instance member variables
+	String								_name;			/**< @internal The name of the histogram. */
+	unsigned long long					_id;			/**< @internal The process unique id used to find the thread's shard. */
+	mutable boost::mutex				_shardsMutex;	/**< @internal Guards the list of shards. */
+	std::vector<Shard*>					_shards;		/**< @internal The shard of every thread that has recorded. */
+};
+
+}	// End of bump namespace
+
+#endif	// End of BUMP_LATENCY_HISTOGRAM_H
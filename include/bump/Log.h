@@ -38,7 +38,7 @@ namespace bump {
  *
  * The following environment variables can be used to configure the log at runtime:
  *	  - BUMP_LOG_ENABLED: Disables the log system if set to any of the following:
- *		  * [ NO | FALSE | NOPE | DISABLE ]
+ *		  * [ NO | FALSE | OFF | NOPE | DISABLE | 0 ]
  *	  - BUMP_LOG_FILE: Redirects the output from the log to a specified file:
  *		  * /home/username/output.txt
  *	  - BUMP_LOG_LEVEL: Defines the maximum output level for the log:
@@ -0,0 +1,183 @@
+//
+//	Profiler.h
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+#ifndef BUMP_PROFILER_H
+#define BUMP_PROFILER_H
+
+// C++ headers
+#include <vector>
+
+// Bump headers
+#include <bump/Export.h>
+#include <bump/String.h>
+#include <bump/Timer.h>
+
+/**
+ * Profiles the rest of the enclosing scope under the given name, which must be a string
+ * literal or otherwise live as long as the process.
+ *
+ * Defining BUMP_DISABLE_PROFILING before including this header compiles every profiled
+ * scope out, so release builds pay nothing for them.
+ */
+#ifdef BUMP_DISABLE_PROFILING
+	#define BUMP_PROFILE_SCOPE(name)
+#else
+	#define BUMP_PROFILE_SCOPE(name) bump::ProfileScope BUMP_PROFILE_SCOPE_VARIABLE(__LINE__)(name)
+#endif
+
+/** @internal Names the ProfileScope variable after the line so several scopes can share a block. */
+#define BUMP_PROFILE_SCOPE_VARIABLE(line) BUMP_PROFILE_SCOPE_CONCATENATE(bumpProfileScope, line)
+#define BUMP_PROFILE_SCOPE_CONCATENATE(prefix, line) prefix##line
+
+namespace bump {
+
+/**
+ * The Profiler aggregates the time spent in nested, named scopes into a call tree.
+ *
+ * Each thread records into its own call tree, so entering and leaving a scope never takes
+ * a lock or contends with other threads. The nodes of a tree never move once created, which
+ * lets report() merge the trees of every thread while they are still being recorded into
+ * without stopping them. Scopes are matched by the address of their name, and merged by the
+ * text of their names, so the same scope reached through different call paths is reported
+ * separately under each path.
+ *
+ *   void Parser::parse()
+ *   {
+ *       BUMP_PROFILE_SCOPE("parse");
+ *       ...
+ *       {
+ *           BUMP_PROFILE_SCOPE("tokenize");
+ *           ...
+ *       }
+ *   }
+ *   ...
+ *   bump::Profiler::log();
+ *
+ * Each thread's call tree holds up to 262144 distinct scopes, after which new scopes are
+ * attributed to the scope enclosing them. When a thread exits, its call tree is merged into a
+ * shared tree of retired samples and freed, so the samples stay in the report.
+ */
+class BUMP_EXPORT Profiler
+{
+public:
+
+	/**
+	 * The aggregated measurements of a scope reached through one call path.
+	 */
+	struct Entry
+	{
+		String				name;					/**< The name of the scope. */
+		unsigned int		depth;					/**< The number of scopes enclosing the scope. */
+		unsigned long long	calls;					/**< The number of times the scope was left. */
+		unsigned long long	inclusiveNanoseconds;	/**< The time spent in the scope. */
+		unsigned long long	exclusiveNanoseconds;	/**< The time spent in the scope outside its nested scopes. */
+	};
+
+	/**
+	 * @internal
+	 * A scope in a thread's call tree. Only the owning thread writes to a node.
+	 */
+	struct Node;
+
+	/**
+	 * Merges the call trees of every thread.
+	 *
+	 * This is thread-safe, and does not block threads entering and leaving scopes.
+	 *
+	 * @return The scopes in depth-first order, with the children of each scope sorted by
+	 *         decreasing inclusive time.
+	 */
+	static std::vector<Entry> entries();
+
+	/**
+	 * Formats the merged call trees as a table of inclusive time, exclusive time and calls, with
+	 * nested scopes indented under the scopes enclosing them.
+	 *
+	 * @return The report, or an empty string if no scopes have been recorded.
+	 */
+	static String report();
+
+	/**
+	 * Logs the report at the info level, one line at a time.
+	 */
+	static void log();
+
+	/**
+	 * Clears the measurements of every scope. Measurements recorded by other threads while
+	 * resetting may be lost.
+	 *
+	 * Only the thread that owns a call tree ever writes its counters, so resetting just marks
+	 * every tree as cleared. Reports skip marked trees, and each thread zeroes its own tree the
+	 * next time it enters or leaves a scope.
+	 */
+	static void reset();
+
+	/**
+	 * @internal
+	 * Enters a scope on the calling thread's call tree.
+	 *
+	 * @param name The name of the scope.
+	 * @return The node of the scope, or NULL if the call tree is full.
+	 */
+	static Node* enter(const char* name);
+
+	/**
+	 * @internal
+	 * Leaves the scope entered by enter().
+	 *
+	 * @param node The node returned by enter().
+	 * @param nanoseconds The time spent in the scope.
+	 */
+	static void leave(Node* node, unsigned long long nanoseconds);
+};
+
+/**
+ * The ProfileScope class records the time until it is destructed into the Profiler, the same way
+ * an AutoTimer records into a LatencyHistogram. Use the BUMP_PROFILE_SCOPE macro rather than
+ * creating these directly so the scopes can be compiled out.
+ */
+class BUMP_EXPORT ProfileScope
+{
+public:
+
+	/**
+	 * Constructor enters the scope.
+	 *
+	 * @param name The name of the scope, which must live as long as the process.
+	 */
+	ProfileScope(const char* name);
+
+	/**
+	 * Destructor leaves the scope.
+	 */
+	~ProfileScope();
+
+protected:
+
+	// Instance member variables
+	Profiler::Node*		_node;		/**< @internal The scope's node in the thread's call tree. */
+	Timer				_timer;		/**< @internal Reads the time stamp counter when available. */
+
+private:
+
+	/**
+	 * @internal
+	 * Copy constructor. Scopes cannot be copied.
+	 */
+	ProfileScope(const ProfileScope& scope);
+
+	/**
+	 * @internal
+	 * Overloaded assignment operator. Scopes cannot be copied.
+	 */
+	void operator=(const ProfileScope& scope);
+};
+
+}	// End of bump namespace
+
+#endif	// End of BUMP_PROFILER_H
@@ -0,0 +1,341 @@
+//
+//	Scheduler.h
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+#ifndef BUMP_SCHEDULER_H
+#define BUMP_SCHEDULER_H
+
+// C++ headers
+#include <cstddef>
+#include <deque>
+#include <vector>
+
+// Boost headers
+#include <boost/any.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/function.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/recursive_mutex.hpp>
+#include <boost/thread/thread.hpp>
+
+// Bump headers
+#include <bump/Export.h>
+#include <bump/String.h>
+#include <bump/Timer.h>
+
+namespace bump {
+
+// Forward declarations
+class Timeline;
+
+/**
+ * The Scheduler runs delayed and periodic callbacks on a hierarchical timing wheel.
+ *
+ * Time is divided into ticks of a fixed resolution. Callbacks due within the next 256 ticks
+ * are stored in the slot of the tick they are due in, and callbacks due later are stored in
+ * coarser wheels which are cascaded into the finer ones as their time approaches. Scheduling
+ * and cancelling are O(1), and expiry is amortized O(1) however many callbacks are waiting.
+ * Callbacks fire on the first tick at or after they are due, so they may run up to one tick
+ * resolution early relative to when they were scheduled.
+ *
+ * The scheduler can either be pumped by calling poll() from the caller's own loop, or run its
+ * own thread with start(). Callbacks are invoked on the thread that polls the scheduler, one
+ * at a time while holding the scheduler's lock, so they should be short. They may schedule and
+ * cancel callbacks, including themselves, but must not poll or stop the scheduler. A callback
+ * that throws is cancelled, and the exception is thrown out of poll() or logged by the thread.
+ *
+ *   bump::Scheduler scheduler;
+ *   scheduler.start();
+ *   bump::Scheduler::Id id = scheduler.schedulePeriodic(0.5, boost::bind(&Server::rampUp, &server));
+ *   scheduler.scheduleNotification(2.0, "WarmupFinished");
+ *   ...
+ *   scheduler.cancel(id);
+ */
+class BUMP_EXPORT Scheduler
+{
+public:
+
+	// Typedefs
+	typedef boost::uint64_t Id;
+	typedef boost::function<void ()> Callback;
+
+	/**
+	 * Constructor.
+	 *
+	 * @throw bump::InvalidArgumentError When the resolution is not positive.
+	 *
+	 * @param resolution The length of a tick in seconds.
+	 */
+	Scheduler(double resolution = 0.001);
+
+	/**
+	 * Destructor. Stops the scheduler's thread if it is running and drops any pending callbacks.
+	 */
+	~Scheduler();
+
+	/**
+	 * Schedules a callback to run once after a delay.
+	 *
+	 * This is thread-safe.
+	 *
+	 * @param delay The number of seconds to wait before running the callback.
+	 * @param callback The callback to run.
+	 * @return The id of the scheduled callback, which is never 0.
+	 */
+	Id schedule(double delay, const Callback& callback);
+
+	/**
+	 * Schedules a callback to run repeatedly until it is cancelled.
+	 *
+	 * Each run is scheduled an interval after the previous one was due rather than after it ran,
+	 * so the callback does not drift. If polling falls behind, the missed runs are skipped rather
+	 * than run in a burst.
+	 *
+	 * This is thread-safe.
+	 *
+	 * @param interval The number of seconds between runs, rounded up to at least one tick.
+	 * @param callback The callback to run.
+	 * @return The id of the scheduled callback, which is never 0.
+	 */
+	Id schedulePeriodic(double interval, const Callback& callback);
+
+	/**
+	 * Schedules a notification to be posted through the NotificationCenter after a delay.
+	 *
+	 * This is thread-safe.
+	 *
+	 * @param delay The number of seconds to wait before posting the notification.
+	 * @param notificationName The notification to post to registered observers.
+	 * @return The id of the scheduled notification, which is never 0.
+	 */
+	Id scheduleNotification(double delay, const String& notificationName);
+
+	/**
+	 * Schedules a notification with an object to be posted through the NotificationCenter after a delay.
+	 *
+	 * This is thread-safe.
+	 *
+	 * @param delay The number of seconds to wait before posting the notification.
+	 * @param notificationName The notification to post to registered observers.
+	 * @param object The object to send to the registered observers.
+	 * @return The id of the scheduled notification, which is never 0.
+	 */
+	Id scheduleNotificationWithObject(double delay, const String& notificationName, const boost::any& object);
+
+	/**
+	 * Updates a running timeline at a fixed interval until it finishes or stops.
+	 *
+	 * The timeline's finished callback runs on the thread polling the scheduler, so use it to
+	 * react to the timeline finishing, for example by posting a notification, rather than polling
+	 * the timeline's state. The timeline must outlive the scheduled updates and must not be updated
+	 * by anything else while they run.
+	 *
+	 * This is thread-safe.
+	 *
+	 * @param timeline The running timeline to update.
+	 * @param interval The number of seconds between updates.
+	 * @return The id of the scheduled updates, which is never 0.
+	 */
+	Id scheduleTimeline(Timeline& timeline, double interval);
+
+	/**
+	 * Cancels a scheduled callback so it never runs again.
+	 *
+	 * This is thread-safe.
+	 *
+	 * @param id The id of the callback.
+	 * @return True if the callback was scheduled, false if it already ran or was cancelled.
+	 */
+	bool cancel(Id id);
+
+	/**
+	 * Returns the number of scheduled callbacks.
+	 *
+	 * @return The number of scheduled callbacks.
+	 */
+	std::size_t size() const;
+
+	/**
+	 * Returns the current time of the scheduler's clock in seconds, which is the time since
+	 * the scheduler was constructed plus any time it was advanced by.
+	 *
+	 * @return The current time in seconds.
+	 */
+	double time() const;
+
+	/**
+	 * Runs every callback that is due at the current time.
+	 *
+	 * @return The number of callbacks that ran.
+	 */
+	unsigned int poll();
+
+	/**
+	 * Moves the scheduler's clock forward and runs every callback that is then due.
+	 *
+	 * This makes it possible to drive the scheduler from a simulated clock, such as a fixed
+	 * step loop or a replay, without waiting in real time.
+	 *
+	 * @param elapsed The number of seconds to move the clock forward by.
+	 * @return The number of callbacks that ran.
+	 */
+	unsigned int advance(double elapsed);
+
+	/**
+	 * Starts a thread which sleeps until callbacks are due and runs them. Does nothing if the
+	 * thread is already running.
+	 */
+	void start();
+
+	/**
+	 * Stops the scheduler's thread, waiting for it to finish running any callbacks. Pending
+	 * callbacks stay scheduled.
+	 */
+	void stop();
+
+	/**
+	 * Returns whether the scheduler's thread is running.
+	 *
+	 * @return True if the thread is running, false otherwise.
+	 */
+	bool isRunning() const;
+
+protected:
+
+	/**
+	 * @internal
+	 * Runs a scheduled callback, returning whether a periodic callback should run again.
+	 */
+	typedef boost::function<bool ()> Task;
+
+	/**
+	 * @internal
+	 * A scheduled callback, linked into the list of the wheel slot it is due in.
+	 */
+	struct Node
+	{
+		Task				task;			/**< @internal The callback. */
+		boost::uint64_t		expiry;			/**< @internal The tick the callback is due in. */
+		boost::uint64_t		period;			/**< @internal The ticks between runs, or 0 to run once. */
+		boost::uint32_t		generation;		/**< @internal Distinguishes the ids that reuse the node. */
+		boost::uint32_t		slot;			/**< @internal The slot list the node is in. */
+		boost::uint32_t		previous;		/**< @internal The previous node in the slot list. */
+		boost::uint32_t		next;			/**< @internal The next node in the slot list. */
+		bool				scheduled;		/**< @internal Whether the callback has not been cancelled. */
+	};
+
+	/**
+	 * @internal
+	 * Schedules a task, returning its id.
+	 *
+	 * @param delay The number of seconds to wait before running the task.
+	 * @param period The number of seconds between runs, or 0 to run once.
+	 * @param task The task to run.
+	 * @return The id of the task.
+	 */
+	Id scheduleTask(double delay, double period, const Task& task);
+
+	/**
+	 * @internal
+	 * Returns the current tick of the scheduler's clock.
+	 *
+	 * @return The current tick.
+	 */
+	boost::uint64_t currentTick() const;
+
+	/**
+	 * @internal
+	 * Runs every callback due up to and including the given tick.
+	 *
+	 * @param tick The tick to run the callbacks up to.
+	 * @return The number of callbacks that ran.
+	 */
+	unsigned int runUntil(boost::uint64_t tick);
+
+	/**
+	 * @internal
+	 * Returns the tick the thread can sleep until before it needs to poll again.
+	 *
+	 * @return The tick to poll at, or the largest tick if nothing is scheduled.
+	 */
+	boost::uint64_t nextPollTick() const;
+
+	/**
+	 * @internal
+	 * Returns the finest wheel holding any callbacks.
+	 *
+	 * @return The index of the wheel.
+	 */
+	boost::uint32_t finestWheel() const;
+
+	/**
+	 * @internal
+	 * Links a node into the wheel slot of its expiry.
+	 *
+	 * @param index The index of the node.
+	 */
+	void insert(boost::uint32_t index);
+
+	/**
+	 * @internal
+	 * Links a node into a slot list.
+	 *
+	 * @param index The index of the node.
+	 * @param slot The slot to link it into.
+	 */
+	void link(boost::uint32_t index, boost::uint32_t slot);
+
+	/**
+	 * @internal
+	 * Unlinks a node from its slot list.
+	 *
+	 * @param index The index of the node.
+	 */
+	void unlink(boost::uint32_t index);
+
+	/**
+	 * @internal
+	 * Moves the nodes of a coarse wheel slot into the finer wheels.
+	 *
+	 * @param slot The slot to cascade.
+	 */
+	void cascade(boost::uint32_t slot);
+
+	/**
+	 * @internal
+	 * Returns a node to the free list.
+	 *
+	 * @param index The index of the node.
+	 */
+	void release(boost::uint32_t index);
+
+	/**
+	 * @internal
+	 * Sleeps until callbacks are due and runs them until the scheduler is stopped.
+	 */
+	void run();
+
+	// Instance member variables
+	double							_resolution;	/**< @internal The length of a tick in seconds. */
+	Timer							_timer;			/**< @internal The scheduler's clock. */
+	double							_offset;		/**< @internal The time the clock was advanced by. */
+	boost::uint64_t					_nextTick;		/**< @internal The next tick to run the callbacks of. */
+	std::deque<Node>				_nodes;			/**< @internal The scheduled callbacks, which never move. */
+	std::vector<boost::uint32_t>	_freeNodes;		/**< @internal The indices of the unused nodes. */
+	std::vector<boost::uint32_t>	_slots;			/**< @internal The first node of each slot list. */
+	std::size_t						_levelSizes[5];	/**< @internal The number of nodes in each wheel. */
+	std::size_t						_size;			/**< @internal The number of scheduled callbacks. */
+	bool							_polling;		/**< @internal Whether callbacks are being run. */
+	mutable boost::recursive_mutex	_mutex;			/**< @internal Guards the wheels. */
+	boost::condition_variable_any	_condition;		/**< @internal Wakes the thread when callbacks are scheduled. */
+	boost::thread*					_thread;		/**< @internal The scheduler's thread, when running. */
+	bool							_stopping;		/**< @internal Asks the thread to stop. */
+};
+
+}	// End of bump namespace
+
+#endif	// End of BUMP_SCHEDULER_H
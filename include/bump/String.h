@@ -10,18 +10,28 @@
 #define BUMP_STRING_H
 
 // C++ headers
+#include <cstddef>
+#include <functional>
 #include <iostream>
 #include <set>
 #include <string>
 #include <vector>
 
+// Boost headers
+#include <boost/config.hpp>
+#include <boost/utility/string_ref.hpp>
+
 // Bump headers
+#include <bump/Arena_fwd.h>
+#include <bump/Expected.h>
 #include <bump/Export.h>
 
 namespace bump {
 
 // Forward Declarations
 class String;
+class StringTable;
+class Uuid;
 
 // Typedefs
 typedef std::vector<String> StringList;		/**< A shortcut typedef for an std::vector of bump::String objects. */
@@ -50,6 +60,82 @@ public:
 		NotCaseSensitive = 1	/**< NOT case sensitive meaning that 'xyz' and 'XYZ' are the same. */
 	};
 
+	/**
+	 * One argument of format(), which refers to the caller's value without copying or converting it.
+	 *
+	 * Integers, floats, bools, uuids and strings each have their own constructor, so any other
+	 * type, including pointers that would otherwise silently convert to bool, fails to compile.
+	 */
+	class BUMP_EXPORT FormatArgument
+	{
+	public:
+
+		// Constructors for each supported type
+		FormatArgument(bool value) : _type(BOOL_TYPE) { _value.integer = value ? 1 : 0; }
+		FormatArgument(char value) : _type(SIGNED_TYPE) { _value.integer = value; }
+		FormatArgument(signed char value) : _type(SIGNED_TYPE) { _value.integer = value; }
+		FormatArgument(unsigned char value) : _type(UNSIGNED_TYPE) { _value.unsignedInteger = value; }
+		FormatArgument(short value) : _type(SIGNED_TYPE) { _value.integer = value; }
+		FormatArgument(unsigned short value) : _type(UNSIGNED_TYPE) { _value.unsignedInteger = value; }
+		FormatArgument(int value) : _type(SIGNED_TYPE) { _value.integer = value; }
+		FormatArgument(unsigned int value) : _type(UNSIGNED_TYPE) { _value.unsignedInteger = value; }
+		FormatArgument(long value) : _type(SIGNED_TYPE) { _value.integer = value; }
+		FormatArgument(unsigned long value) : _type(UNSIGNED_TYPE) { _value.unsignedInteger = value; }
+		FormatArgument(long long value) : _type(SIGNED_TYPE) { _value.integer = value; }
+		FormatArgument(unsigned long long value) : _type(UNSIGNED_TYPE) { _value.unsignedInteger = value; }
+		FormatArgument(float value) : _type(FLOAT_TYPE) { _value.floating = value; }
+		FormatArgument(double value) : _type(DOUBLE_TYPE) { _value.floating = value; }
+		FormatArgument(const char* value) : _type(TEXT_TYPE) { _value.text.data = value; _value.text.size = std::char_traits<char>::length(value); }
+		FormatArgument(const std::string& value) : _type(TEXT_TYPE) { _value.text.data = value.data(); _value.text.size = value.size(); }
+		FormatArgument(boost::string_ref value) : _type(TEXT_TYPE) { _value.text.data = value.data(); _value.text.size = value.size(); }
+		FormatArgument(const Uuid& value) : _type(UUID_TYPE) { _value.uuid = &value; }
+
+		/**
+		 * Appends the argument to the end of the string, formatted the same way as the String
+		 * constructor of its type formats it.
+		 *
+		 * @param string The string to append the argument to.
+		 */
+		void appendTo(std::string& string) const;
+
+	protected:
+
+		/** @internal The types of arguments. */
+		enum Type
+		{
+			BOOL_TYPE,
+			SIGNED_TYPE,
+			UNSIGNED_TYPE,
+			FLOAT_TYPE,
+			DOUBLE_TYPE,
+			TEXT_TYPE,
+			UUID_TYPE
+		};
+
+		// Instance member variables
+		Type _type;							/**< @internal The type of the argument. */
+		union
+		{
+			long long integer;
+			unsigned long long unsignedInteger;
+			double floating;
+			struct
+			{
+				const char* data;
+				std::size_t size;
+			} text;
+			const Uuid* uuid;
+		} _value;							/**< @internal The value, or where to find it. */
+
+	private:
+
+		/**
+		 * @internal
+		 * Other pointers are not formatted, rather than converted to bool.
+		 */
+		FormatArgument(const void* value);
+	};
+
 	/**
 	 * Default constructor.
 	 */
@@ -390,6 +476,33 @@ public:
 	String arg(const String& a1, const String& a2, const String& a3, const String& a4, const String& a5,
 			   const String& a6, const String& a7, const String& a8, const String& a9) const;
 
+#ifndef BOOST_NO_CXX11_VARIADIC_TEMPLATES
+	/**
+	 * Creates a string from the format with each numbered marker replaced by its argument.
+	 *
+	 * Marker %1 is replaced by the first argument, %2 by the second, and so on up to %99. Unlike
+	 * arg(), the arguments keep their own types: integers, floats, bools, uuids, strings and string
+	 * views are written straight into the result, without first being converted to a String each.
+	 * Numbers, bools and uuids are formatted exactly as the String constructors format them in the
+	 * classic locale, and floating point numbers are always written with a '.' decimal point.
+	 *
+	 * @code
+	 *   bump::String copying = bump::String::format("Copying file %1 of %2: %3", index, count, path);
+	 *   // copying = "Copying file 3 of 10: test.txt"
+	 * @endcode
+	 *
+	 * Use BUMP_FORMAT() for literal formats to check the markers against the arguments when compiling.
+	 *
+	 * @throw bump::StringSearchError When a marker has no argument, or an argument has no marker.
+	 *
+	 * @param format The format containing the markers %1 - %99.
+	 * @param arguments The arguments to replace each marker with.
+	 * @return The formatted string.
+	 */
+	template <typename... Arguments>
+	static String format(boost::string_ref format, const Arguments&... arguments);
+#endif
+
 	/**
 	 * Locates and returns the character at the position in this string.
 	 *
@@ -783,6 +896,32 @@ public:
 	 */
 	StringList split(const String& separator) const;
 
+	/**
+	 * Splits the string into a list of strings allocated from an arena.
+	 *
+	 * The strings are split exactly as split() splits them, but the list and every string in it are
+	 * allocated from the memory resource rather than one at a time from the heap.
+	 *
+	 * @see bump::MonotonicArena
+	 *
+	 * @param separator A string used to split the string into a list of strings.
+	 * @param resource The memory resource to allocate the list and the strings from.
+	 * @return A list of strings separated by the separator character.
+	 */
+	ArenaStringList split(const String& separator, MemoryResource* resource) const;
+
+	/**
+	 * Splits the string into a contiguous string table.
+	 *
+	 * The strings are split exactly as split() splits them, but are stored back to back in one buffer.
+	 *
+	 * @see bump::StringTable
+	 *
+	 * @param separator A string used to split the string into a list of strings.
+	 * @return A table of strings separated by the separator character.
+	 */
+	StringTable splitTable(const String& separator) const;
+
 	/**
 	 * Checks whether this string starts with the given string.
 	 *
@@ -937,6 +1076,94 @@ public:
 	 */
 	String trimmed() const;
 
+	/**
+	 * Creates a copy of this string with the lowest numbered marker replaced by a1, without throwing.
+	 *
+	 * @see arg()
+	 *
+	 * @param a1 A string to replace the lowest numbered marker.
+	 * @return A copy of the string with the lowest numbered marker replaced, or a STRING_SEARCH_ERROR
+	 *         result when no valid markers are found (i.e. %1-%99).
+	 */
+	Expected<String> tryArg(const String& a1) const;
+
+	/**
+	 * Converts this string to a boolean without throwing.
+	 *
+	 * @return The bool value of the string, or a TYPE_CAST_ERROR result when it cannot be converted.
+	 */
+	Expected<bool> tryToBool() const;
+
+	/**
+	 * Converts this string to a double without throwing.
+	 *
+	 * @return The double value of the string, or a TYPE_CAST_ERROR result when it cannot be converted.
+	 */
+	Expected<double> tryToDouble() const;
+
+	/**
+	 * Converts this string to a float without throwing.
+	 *
+	 * @return The float value of the string, or a TYPE_CAST_ERROR result when it cannot be converted.
+	 */
+	Expected<float> tryToFloat() const;
+
+	/**
+	 * Converts this string to an int without throwing.
+	 *
+	 * @return The int value of the string, or a TYPE_CAST_ERROR result when it cannot be converted.
+	 */
+	Expected<int> tryToInt() const;
+
+	/**
+	 * Converts this string to a long without throwing.
+	 *
+	 * @return The long value of the string, or a TYPE_CAST_ERROR result when it cannot be converted.
+	 */
+	Expected<long> tryToLong() const;
+
+	/**
+	 * Converts this string to a long long without throwing.
+	 *
+	 * @return The long long value of the string, or a TYPE_CAST_ERROR result when it cannot be converted.
+	 */
+	Expected<long long> tryToLongLong() const;
+
+	/**
+	 * Converts this string to a short without throwing.
+	 *
+	 * @return The short value of the string, or a TYPE_CAST_ERROR result when it cannot be converted.
+	 */
+	Expected<short> tryToShort() const;
+
+	/**
+	 * Converts this string to an unsigned int without throwing.
+	 *
+	 * @return The unsigned int value of the string, or a TYPE_CAST_ERROR result when it cannot be converted.
+	 */
+	Expected<unsigned int> tryToUInt() const;
+
+	/**
+	 * Converts this string to an unsigned long without throwing.
+	 *
+	 * @return The unsigned long value of the string, or a TYPE_CAST_ERROR result when it cannot be converted.
+	 */
+	Expected<unsigned long> tryToULong() const;
+
+	/**
+	 * Converts this string to an unsigned long long without throwing.
+	 *
+	 * @return The unsigned long long value of the string, or a TYPE_CAST_ERROR result when it cannot be converted.
+	 */
+	Expected<unsigned long long> tryToULongLong() const;
+
+	/**
+	 * Converts this string to an unsigned short without throwing.
+	 *
+	 * @return The unsigned short value of the string, or a TYPE_CAST_ERROR result when it cannot be converted.
+	 */
+	Expected<unsigned short> tryToUShort() const;
+
 	/**
 	 * Appends the string onto the end of this string.
 	 *
@@ -1056,8 +1283,35 @@ public:
 	 * @return The modified version of this string.
 	 */
 	String& operator << (bool appendBool);
+
+protected:
+
+	/**
+	 * @internal
+	 * Formats the arguments of format() into a string.
+	 */
+	static String formatArguments(boost::string_ref format, const FormatArgument* arguments, std::size_t argumentCount);
 };
 
 }	// End of bump namespace
 
+// Provide std::hash support so the String can key the C++11 unordered containers
+#ifndef BOOST_NO_CXX11_HDR_FUNCTIONAL
+namespace std {
+
+/**
+ * Hashes a bump::String with the bump::FastHash 64 bit hash.
+ */
+template<>
+struct BUMP_EXPORT hash<bump::String>
+{
+	std::size_t operator()(const bump::String& string) const;
+};
+
+}	// End of std namespace
+#endif
+
+// Pull in the String template implementations
+#include <bump/String_impl.h>
+
 #endif	// End of BUMP_STRING_H
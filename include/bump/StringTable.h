@@ -0,0 +1,188 @@
+//
+//	StringTable.h
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+#ifndef BUMP_STRING_TABLE_H
+#define BUMP_STRING_TABLE_H
+
+// C++ headers
+#include <cstddef>
+#include <vector>
+
+// Boost headers
+#include <boost/utility/string_ref.hpp>
+
+// Bump headers
+#include <bump/Export.h>
+#include <bump/String.h>
+
+namespace bump {
+
+/**
+ * The StringTable is a compact, read-mostly list of strings.
+ *
+ * Every character of every string is stored back to back in one buffer, next to an array of the
+ * offsets where each string starts. Compared to a StringList, there is no heap block per string,
+ * scanning the table reads straight through memory instead of chasing a pointer per string, and
+ * a large table of short lines or paths takes several times less memory.
+ *
+ * Strings are read as boost::string_ref views into the buffer. Appending may move the buffer,
+ * which invalidates every view, as does sort() and dedupe().
+ *
+ *   bump::StringTable paths = bump::FileSystem::directoryTable("/usr/include");
+ *   if (paths.binarySearch("/usr/include/stdio.h") != bump::StringTable::npos)
+ *   {
+ *       ...
+ *   }
+ */
+class BUMP_EXPORT StringTable
+{
+public:
+
+	/** The index binarySearch() returns when the string is not in the table. */
+	static const std::size_t npos = static_cast<std::size_t>(-1);
+
+	/**
+	 * Constructor creates an empty table.
+	 */
+	StringTable();
+
+	/**
+	 * Constructor copies every string of the string list.
+	 *
+	 * @param strings The strings to copy.
+	 */
+	explicit StringTable(const StringList& strings);
+
+	/**
+	 * Reserves room so the table can grow to the given size without reallocating.
+	 *
+	 * @param stringCount The number of strings to reserve room for.
+	 * @param characterCount The total number of characters of all the strings to reserve room for.
+	 */
+	void reserve(std::size_t stringCount, std::size_t characterCount);
+
+	/**
+	 * Appends a copy of the string to the end of the table.
+	 *
+	 * @param string The string to append.
+	 */
+	void append(boost::string_ref string);
+
+	/**
+	 * Removes every string from the table, keeping the memory for reuse.
+	 */
+	void clear();
+
+	/**
+	 * Returns the number of strings in the table.
+	 *
+	 * @return The number of strings in the table.
+	 */
+	inline std::size_t size() const { return _offsets.size() - 1; }
+
+	/**
+	 * Returns whether the table has no strings.
+	 *
+	 * @return True if the table is empty, false otherwise.
+	 */
+	inline bool empty() const { return _offsets.size() == 1; }
+
+	/**
+	 * Returns the total number of characters of all the strings in the table.
+	 *
+	 * @return The total number of characters.
+	 */
+	inline std::size_t characterCount() const { return _characters.size(); }
+
+	/**
+	 * Returns a view of the string at the index.
+	 *
+	 * @throw bump::OutOfRangeError When the index is not less than size().
+	 *
+	 * @param index The index of the string.
+	 * @return A view of the string, valid until the table is next modified.
+	 */
+	boost::string_ref at(std::size_t index) const;
+
+	/**
+	 * Returns a view of the string at the index without checking the index.
+	 *
+	 * @param index The index of the string, which must be less than size().
+	 * @return A view of the string, valid until the table is next modified.
+	 */
+	inline boost::string_ref operator[](std::size_t index) const
+	{
+		const char* characters = _characters.empty() ? "" : &_characters[0];
+		return boost::string_ref(characters + _offsets[index], _offsets[index + 1] - _offsets[index]);
+	}
+
+	/**
+	 * Returns a copy of the string at the index.
+	 *
+	 * @throw bump::OutOfRangeError When the index is not less than size().
+	 *
+	 * @param index The index of the string.
+	 * @return A copy of the string.
+	 */
+	String string(std::size_t index) const;
+
+	/**
+	 * Sorts the strings in ascending order, comparing them character by character.
+	 */
+	void sort();
+
+	/**
+	 * Removes each string that equals the string before it.
+	 *
+	 * Call sort() first to remove every duplicate.
+	 */
+	void dedupe();
+
+	/**
+	 * Finds a string in a sorted table with a binary search.
+	 *
+	 * The result is undefined if the table is not sorted.
+	 *
+	 * @param string The string to find.
+	 * @return The index of the string, or npos if it is not in the table.
+	 */
+	std::size_t binarySearch(boost::string_ref string) const;
+
+	/**
+	 * Copies the strings of the table into a string list.
+	 *
+	 * @return A string list of the strings in the table.
+	 */
+	StringList toStringList() const;
+
+	/**
+	 * Checks whether both tables hold the same strings in the same order.
+	 *
+	 * @param table The table to compare against.
+	 * @return True if the tables are equal, false otherwise.
+	 */
+	bool operator==(const StringTable& table) const;
+
+	/**
+	 * Checks whether the tables differ.
+	 *
+	 * @param table The table to compare against.
+	 * @return True if the tables are not equal, false otherwise.
+	 */
+	bool operator!=(const StringTable& table) const;
+
+protected:
+
+	// Instance member variables
+	std::vector<char>			_characters;	/**< @internal The characters of every string, back to back. */
+	std::vector<std::size_t>	_offsets;		/**< @internal Where each string starts, followed by the end of the last string. */
+};
+
+}	// End of bump namespace
+
+#endif	// End of BUMP_STRING_TABLE_H
@@ -0,0 +1,105 @@
+//
+//	String_impl.h
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+#ifndef BUMP_STRING_IMPL_H
+#define BUMP_STRING_IMPL_H
+
+#ifndef BOOST_NO_CXX11_VARIADIC_TEMPLATES
+
+namespace bump {
+
+template <typename... Arguments>
+String String::format(boost::string_ref format, const Arguments&... arguments)
+{
+	// The trailing argument is never formatted, it only keeps the array from being empty
+	const FormatArgument list[] = { FormatArgument(arguments)..., FormatArgument(false) };
+	return formatArguments(format, list, sizeof...(Arguments));
+}
+
+#ifndef BOOST_NO_CXX11_CONSTEXPR
+
+/**
+ * Compile-time checks of literal String::format() formats, used by BUMP_FORMAT().
+ *
+ * These are recursive so they compile as C++11 constexpr functions, which limits the format to
+ * the compiler's constexpr recursion depth (512 characters by default with GCC and Clang).
+ */
+namespace StringFormat {
+
+/** Returns the value of the marker at the start of the format, or 0 if it does not start with one. */
+constexpr unsigned int markerValue(const char* format)
+{
+	return (format[0] != '%' || format[1] < '1' || format[1] > '9') ? 0 :
+		(format[2] >= '0' && format[2] <= '9') ? (format[1] - '0') * 10 + (format[2] - '0') : format[1] - '0';
+}
+
+/** Returns how far to move past the start of the format to reach the next marker or character. */
+constexpr unsigned int stepLength(const char* format)
+{
+	return markerValue(format) == 0 ? 1 : markerValue(format) < 10 ? 2 : 3;
+}
+
+/** Returns the highest marker in the format. */
+constexpr unsigned int highestMarker(const char* format, unsigned int highest = 0)
+{
+	return format[0] == '\0' ? highest :
+		highestMarker(format + stepLength(format), markerValue(format) > highest ? markerValue(format) : highest);
+}
+
+/** Returns whether the marker appears in the format. */
+constexpr bool hasMarker(const char* format, unsigned int marker)
+{
+	return format[0] != '\0' && (markerValue(format) == marker || hasMarker(format + stepLength(format), marker));
+}
+
+/** Returns whether every marker up to the count appears in the format, and no higher ones do. */
+constexpr bool matchesArguments(const char* format, std::size_t count, unsigned int marker = 1)
+{
+	return marker > count ? highestMarker(format) == count : hasMarker(format, marker) && matchesArguments(format, count, marker + 1);
+}
+
+/** Counts the arguments of BUMP_FORMAT() in its size, without evaluating them. */
+template <typename... Arguments>
+char (&argumentCount(const Arguments&... arguments))[sizeof...(Arguments) + 1];
+
+/** Fails to compile when the markers do not match the arguments. */
+template <bool MatchesArguments>
+struct Check
+{
+	static_assert(MatchesArguments, "The markers of the format do not match its arguments, which must use each of %1 to %N");
+};
+
+}	// End of StringFormat namespace
+
+#endif	// End of BOOST_NO_CXX11_CONSTEXPR
+
+}	// End of bump namespace
+
+/**
+ * Formats a literal format string with String::format(), failing to compile unless the markers of
+ * the format are %1 up to the number of arguments, each used at least once.
+ *
+ * @code
+ *   bump::String copying = BUMP_FORMAT("Copying file %1 of %2: %3", index, count, path);
+ *   bump::String broken = BUMP_FORMAT("Copying file %1 of %2", index);  // does not compile
+ * @endcode
+ *
+ * Compilers without constexpr skip the check and format the same way at runtime.
+ */
+#ifndef BOOST_NO_CXX11_CONSTEXPR
+	#define BUMP_FORMAT(formatString, ...)																	\
+		(static_cast<void>(sizeof(::bump::StringFormat::Check<(::bump::StringFormat::matchesArguments(		\
+			formatString, sizeof(::bump::StringFormat::argumentCount(__VA_ARGS__)) - 1))>)),				\
+		 ::bump::String::format(formatString, __VA_ARGS__))
+#else
+	#define BUMP_FORMAT(formatString, ...) ::bump::String::format(formatString, __VA_ARGS__)
+#endif
+
+#endif	// End of BOOST_NO_CXX11_VARIADIC_TEMPLATES
+
+#endif	// End of BUMP_STRING_IMPL_H
@@ -11,6 +11,7 @@
 
 #include <bump/Export.h>
 #include <bump/String.h>
+#include <bump/StringTable.h>
 
 namespace bump {
 
@@ -38,6 +39,33 @@ namespace TextFileReader {
  */
 BUMP_EXPORT StringList fileContents(const String& fileName);
 
+/**
+ * Returns the entire contents of the text file allocated from an arena.
+ *
+ * Each string in the returned list is one line of the text file, and the list and every line
+ * are allocated from the memory resource rather than one at a time from the heap.
+ *
+ * @see bump::MonotonicArena
+ *
+ * @param fileName The text file's name and/or path.
+ * @param resource The memory resource to allocate the lines from.
+ * @return The entire contents of the file with each string being one line from the file.
+ */
+BUMP_EXPORT ArenaStringList fileContents(const String& fileName, MemoryResource* resource);
+
+/**
+ * Returns the entire contents of the text file as a contiguous string table.
+ *
+ * Each string in the returned table is one line of the text file, and every line is stored
+ * back to back in one buffer.
+ *
+ * @see bump::StringTable
+ *
+ * @param fileName The text file's name and/or path.
+ * @return The entire contents of the file with each string being one line from the file.
+ */
+BUMP_EXPORT StringTable fileContentsTable(const String& fileName);
+
 /**
  * Returns a subset of the text file.
  *
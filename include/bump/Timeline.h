@@ -9,12 +9,19 @@
 #ifndef BUMP_TIMELINE_H
 #define BUMP_TIMELINE_H
 
+// Boost headers
+#include <boost/function.hpp>
+#include <boost/shared_ptr.hpp>
+
 // Bump headers
 #include <bump/Export.h>
 #include <bump/Timer.h>
 
 namespace bump {
 
+// Forward declarations
+class TimelineCurve;
+
 /**
  * The Timeline class is used for controlling animations.
  *
@@ -23,6 +30,14 @@ namespace bump {
  * and curve shape, then start the timeline. You then need to periodically call the
  * update method. After the timeline has been updated, use the stepValue or
  * stepIncrement values to update the animations.
+ *
+ * The timeline can either read its own clock through update(), or be driven by the
+ * caller's clock through update(now) or advance(dt). The latter never read a clock,
+ * which makes fixed-step simulations and replays deterministic. A timeline should
+ * only be driven one of these ways at a time.
+ *
+ * Besides the built-in curve shapes, a timeline can follow any TimelineCurve set through
+ * setCurve(), such as a cubic Bézier, a spring or a curve built from data points.
  */
 class BUMP_EXPORT Timeline
 {
@@ -56,9 +71,15 @@ public:
 		LINEAR_CURVE,			/**< Timeline moves from start to end output linearly. */
 		EASE_IN_CURVE,			/**< Timeline moves slow at first, then increases in speed. */
 		EASE_OUT_CURVE,			/**< Timeline moves fast at first, then slows down steadily. */
-		EASE_IN_AND_OUT_CURVE	/**< Timeline starts slow, increases in speed, peaks in the middle, then eases out. */
+		EASE_IN_AND_OUT_CURVE,	/**< Timeline starts slow, increases in speed, peaks in the middle, then eases out. */
+		CUSTOM_CURVE			/**< Timeline follows the TimelineCurve set with setCurve(). */
 	};
 
+	/**
+	 * Defines the callback invoked when the timeline finishes.
+	 */
+	typedef boost::function<void (Timeline&)> FinishedCallback;
+
 	/**
 	 * Default constructor.
 	 */
@@ -104,14 +125,41 @@ public:
 	void unpause();
 
 	/**
-	 * Updates the timeline.
+	 * Updates the timeline from its own clock.
 	 *
 	 * This method needs to be called each time you wish to update the step value
 	 * of the timeline. After the timeline has been updated, you will use either
-	 * the stepValue or stepIncrement functions to update your animations.
+	 * the stepValue or stepIncrement functions to update your animations. Updating
+	 * a timeline that is not running does nothing.
 	 */
 	void update();
 
+	/**
+	 * Updates the timeline from the caller's clock without reading a clock.
+	 *
+	 * The timeline advances by the time since the previous call. The first call after
+	 * the timeline starts only sets the reference time, so call this in the same frame
+	 * the timeline is started. Time that passes while the timeline is paused is skipped.
+	 *
+	 * @param now The current time in seconds on the caller's clock.
+	 */
+	void update(double now);
+
+	/**
+	 * Advances a running timeline by a fixed amount of time without reading a clock.
+	 *
+	 * @param elapsed The number of seconds to advance the timeline by.
+	 */
+	void advance(double elapsed);
+
+	/**
+	 * Sets the callback invoked once each time the timeline finishes, after the final step
+	 * value has been generated. The callback may restart the timeline.
+	 *
+	 * @param callback The callback, or an empty function to remove it.
+	 */
+	void setFinishedCallback(const FinishedCallback& callback);
+
 	/**
 	 * Sets the range of output values from the timeline.
 	 *
@@ -148,6 +196,23 @@ public:
 	 */
 	CurveShape curveShape();
 
+	/**
+	 * Sets a custom curve for the timeline and changes its curve shape to CUSTOM_CURVE.
+	 *
+	 * The curve is shared rather than copied, so many timelines can follow the same one.
+	 * A timeline with the CUSTOM_CURVE shape but no curve runs linearly.
+	 *
+	 * @param curve The curve for the timeline to follow.
+	 */
+	void setCurve(const boost::shared_ptr<const TimelineCurve>& curve);
+
+	/**
+	 * Returns the custom curve of the timeline.
+	 *
+	 * @return The custom curve, or an empty pointer if none has been set.
+	 */
+	boost::shared_ptr<const TimelineCurve> curve();
+
 	/**
 	 * Sets the duration of the timeline.
 	 *
@@ -204,10 +269,18 @@ protected:
 	 */
 	void generateStep();
 
+	/**
+	 * @internal
+	 * Finishes the timeline if the run time has reached the duration, generates the step
+	 * value and invokes the finished callback.
+	 */
+	void step();
+
 	// Instance member variables
 	State			_state;				/**< @internal Timeline run-time status. */
 	Direction		_direction;			/**< @internal Timeline forwards or backwards direction. */
 	CurveShape		_curveShape;		/**< @internal Timeline curve shape interpolation. */
+	boost::shared_ptr<const TimelineCurve>	_curve;	/**< @internal The curve followed by the CUSTOM_CURVE shape. */
 	double			_duration;			/**< @internal How long the timeline will run. */
 	double			_halfDuration;		/**< @internal Half the time the timeline will run. */
 	double			_runTime;			/**< @internal How long the timeline has been running. */
@@ -217,6 +290,9 @@ protected:
 	double			_startOutput;		/**< @internal The starting point step value. */
 	double			_endOutput;			/**< @internal The ending point step value. */
 	Timer			_timer;				/**< @internal The timer used to keep track of time. */
+	double			_clockTime;			/**< @internal The caller's time at the last update(now). */
+	bool			_hasClockTime;		/**< @internal Whether update(now) has set the reference time. */
+	FinishedCallback	_finishedCallback;	/**< @internal Invoked when the timeline finishes. */
 };
 
 }	// End of bump namespace
@@ -0,0 +1,276 @@
+//
+//	TimelineCurve.h
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+#ifndef BUMP_TIMELINE_CURVE_H
+#define BUMP_TIMELINE_CURVE_H
+
+// C++ headers
+#include <utility>
+#include <vector>
+
+// Bump headers
+#include <bump/Export.h>
+
+namespace bump {
+
+/**
+ * The TimelineCurve class defines the interface for custom timeline curve shapes.
+ *
+ * A curve maps the progress of a timeline, from 0 at the start to 1 at the end, to the
+ * fraction of the output range covered. Curves should start at 0 and end at 1, but may
+ * leave that range in between, for example to overshoot. Timelines always finish on
+ * exactly their end value regardless of the curve.
+ *
+ * Curves are immutable once constructed, so a single curve can be shared by any number
+ * of timelines and threads.
+ *
+ *   boost::shared_ptr<bump::TimelineCurve> curve(new bump::CubicBezierCurve(0.25, 0.1, 0.25, 1.0));
+ *   timeline.setCurve(curve);
+ */
+class BUMP_EXPORT TimelineCurve
+{
+public:
+
+	/**
+	 * Destructor.
+	 */
+	virtual ~TimelineCurve();
+
+	/**
+	 * Returns the fraction of the output range covered at the given progress.
+	 *
+	 * @param progress The progress of the timeline from 0 to 1.
+	 * @return The fraction of the output range covered.
+	 */
+	virtual double evaluate(double progress) const = 0;
+};
+
+/**
+ * A cubic Bézier curve from (0, 0) to (1, 1) defined by its two control points, the same
+ * way as the CSS cubic-bezier() timing function.
+ *
+ * Evaluating the curve solves for the Bézier parameter of the given progress with Newton's
+ * method, falling back to bisection. Wrap it in a LookupTableCurve when it is evaluated often.
+ */
+class BUMP_EXPORT CubicBezierCurve : public TimelineCurve
+{
+public:
+
+	/**
+	 * Constructor.
+	 *
+	 * @throw bump::InvalidArgumentError When x1 or x2 are outside 0 to 1.
+	 *
+	 * @param x1 The progress of the first control point.
+	 * @param y1 The output fraction of the first control point.
+	 * @param x2 The progress of the second control point.
+	 * @param y2 The output fraction of the second control point.
+	 */
+	CubicBezierCurve(double x1, double y1, double x2, double y2);
+
+	/**
+	 * Destructor.
+	 */
+	~CubicBezierCurve();
+
+	/**
+	 * Returns the output fraction of the curve at the given progress.
+	 *
+	 * @param progress The progress of the timeline from 0 to 1.
+	 * @return The fraction of the output range covered.
+	 */
+	double evaluate(double progress) const;
+
+protected:
+
+	/**
+	 * @internal
+	 * Returns the Bézier parameter whose x coordinate is the given progress.
+	 *
+	 * @param progress The progress of the timeline from 0 to 1.
+	 * @return The Bézier parameter from 0 to 1.
+	 */
+	double solveParameter(double progress) const;
+
+	// Instance member variables
+	double _ax;		/**< @internal The cubic coefficient of x. */
+	double _bx;		/**< @internal The quadratic coefficient of x. */
+	double _cx;		/**< @internal The linear coefficient of x. */
+	double _ay;		/**< @internal The cubic coefficient of y. */
+	double _by;		/**< @internal The quadratic coefficient of y. */
+	double _cy;		/**< @internal The linear coefficient of y. */
+};
+
+/**
+ * A damped spring released from 0 and settling on 1.
+ *
+ * Springs with a damping ratio below 1 overshoot and oscillate around the end value before
+ * settling, a damping ratio of 1 settles as fast as possible without overshooting, and higher
+ * damping ratios settle more slowly.
+ */
+class BUMP_EXPORT SpringCurve : public TimelineCurve
+{
+public:
+
+	/**
+	 * Constructor.
+	 *
+	 * @throw bump::InvalidArgumentError When the damping ratio is negative or the frequency is not positive.
+	 *
+	 * @param dampingRatio The damping ratio of the spring.
+	 * @param frequency The undamped angular frequency of the spring in radians over the whole timeline.
+	 */
+	SpringCurve(double dampingRatio = 0.5, double frequency = 12.0);
+
+	/**
+	 * Destructor.
+	 */
+	~SpringCurve();
+
+	/**
+	 * Returns the position of the spring at the given progress.
+	 *
+	 * @param progress The progress of the timeline from 0 to 1.
+	 * @return The fraction of the output range covered.
+	 */
+	double evaluate(double progress) const;
+
+protected:
+
+	// Instance member variables
+	double _dampingRatio;	/**< @internal The damping ratio of the spring. */
+	double _frequency;		/**< @internal The undamped angular frequency of the spring. */
+};
+
+/**
+ * A curve that jumps between evenly spaced values, holding each one until the next step.
+ */
+class BUMP_EXPORT StepCurve : public TimelineCurve
+{
+public:
+
+	/**
+	 * Constructor.
+	 *
+	 * @throw bump::InvalidArgumentError When the number of steps is 0.
+	 *
+	 * @param steps The number of steps between the start and the end.
+	 */
+	StepCurve(unsigned int steps);
+
+	/**
+	 * Destructor.
+	 */
+	~StepCurve();
+
+	/**
+	 * Returns the value of the step the given progress falls in.
+	 *
+	 * @param progress The progress of the timeline from 0 to 1.
+	 * @return The fraction of the output range covered.
+	 */
+	double evaluate(double progress) const;
+
+protected:
+
+	// Instance member variables
+	double _steps;		/**< @internal The number of steps. */
+};
+
+/**
+ * A curve that interpolates linearly between data points.
+ *
+ * Progress before the first point or after the last point is held at the value of that point.
+ */
+class BUMP_EXPORT PiecewiseLinearCurve : public TimelineCurve
+{
+public:
+
+	// Typedefs
+	typedef std::pair<double, double> Point;
+
+	/**
+	 * Constructor.
+	 *
+	 * @throw bump::InvalidArgumentError When there are no points or their progress decreases.
+	 *
+	 * @param points The (progress, output fraction) points, sorted by progress.
+	 */
+	PiecewiseLinearCurve(const std::vector<Point>& points);
+
+	/**
+	 * Destructor.
+	 */
+	~PiecewiseLinearCurve();
+
+	/**
+	 * Returns the interpolated value of the points at the given progress.
+	 *
+	 * @param progress The progress of the timeline from 0 to 1.
+	 * @return The fraction of the output range covered.
+	 */
+	double evaluate(double progress) const;
+
+protected:
+
+	// Instance member variables
+	std::vector<Point> _points;		/**< @internal The points sorted by progress. */
+};
+
+/**
+ * A curve compiled into a fixed-size table of evenly spaced samples.
+ *
+ * Evaluating the table costs one multiply and one linear interpolation without any branches,
+ * however expensive the original curve is to evaluate. The error is bounded by how much the
+ * original curve bends between two samples, so curves with sharp corners, such as a StepCurve,
+ * need many samples to keep their shape.
+ */
+class BUMP_EXPORT LookupTableCurve : public TimelineCurve
+{
+public:
+
+	/**
+	 * Constructor which samples the given curve.
+	 *
+	 * @throw bump::InvalidArgumentError When there are fewer than 2 samples.
+	 *
+	 * @param curve The curve to sample.
+	 * @param samples The number of samples from 0 to 1, including both ends.
+	 */
+	LookupTableCurve(const TimelineCurve& curve, unsigned int samples = 256);
+
+	/**
+	 * Destructor.
+	 */
+	~LookupTableCurve();
+
+	/**
+	 * Returns the interpolated value of the samples at the given progress.
+	 *
+	 * @param progress The progress of the timeline from 0 to 1, clamped to that range. NaN is treated as 0.
+	 * @return The fraction of the output range covered.
+	 */
+	double evaluate(double progress) const;
+
+	/**
+	 * Returns the number of samples in the table.
+	 *
+	 * @return The number of samples.
+	 */
+	unsigned int samples() const;
+
+protected:
+
+	// Instance member variables
+	double				_scale;		/**< @internal The number of intervals between the samples. */
+	std::vector<double>	_values;	/**< @internal The samples, with the last one repeated. */
+};
+
+}	// End of bump namespace
+
+#endif	// End of BUMP_TIMELINE_CURVE_H
@@ -0,0 +1,309 @@
+//
+//	TimelineGroup.h
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+#ifndef BUMP_TIMELINE_GROUP_H
+#define BUMP_TIMELINE_GROUP_H
+
+// C++ headers
+#include <cstddef>
+#include <vector>
+
+// Boost headers
+#include <boost/shared_ptr.hpp>
+
+// Bump headers
+#include <bump/Export.h>
+#include <bump/Timeline.h>
+#include <bump/TimelineCurve.h>
+#include <bump/Timer.h>
+
+namespace bump {
+
+/**
+ * The TimelineGroup runs large numbers of timelines together.
+ *
+ * Updating thousands of individual Timeline objects is dominated by reading the clock and
+ * branching on the curve shape and direction of each one. A group reads the clock once per
+ * update and stores its running timelines as struct-of-arrays, one set of arrays per curve
+ * shape, so each shape is evaluated by a branch-free SIMD loop over all of its timelines.
+ * Timelines following a custom TimelineCurve share a scalar loop instead, so expensive
+ * curves should be compiled into a LookupTableCurve first.
+ *
+ * Timelines are referred to by the ids returned from add(). Ids stay valid until the timeline
+ * is removed, after which they may be reused. Passing an id that is not in use throws a
+ * bump::OutOfRangeError.
+ *
+ *   bump::TimelineGroup group;
+ *   bump::TimelineGroup::Id id = group.add(0.5, bump::Timeline::FORWARDS, bump::Timeline::EASE_OUT_CURVE);
+ *   group.setOutputRange(id, 0.0, 1.0);
+ *   group.start(id);
+ *   ...
+ *   group.update();
+ *   double opacity = group.stepValue(id);
+ *   const std::vector<bump::TimelineGroup::Id>& done = group.finished();
+ */
+class BUMP_EXPORT TimelineGroup
+{
+public:
+
+	// Typedefs
+	typedef std::size_t Id;
+
+	/**
+	 * Constructor.
+	 */
+	TimelineGroup();
+
+	/**
+	 * Destructor.
+	 */
+	~TimelineGroup();
+
+	/**
+	 * Adds a timeline that is not running yet, with an output range of 0 to 100.
+	 *
+	 * @param duration The duration of timeline execution in seconds.
+	 * @param direction The direction of the timeline output.
+	 * @param curveShape The curve shape defining the acceleration of the timeline output. Timelines
+	 *                   added with the CUSTOM_CURVE shape have no curve and run linearly.
+	 * @return The id of the new timeline.
+	 */
+	Id add(double duration, const Timeline::Direction& direction = Timeline::FORWARDS,
+		   const Timeline::CurveShape& curveShape = Timeline::LINEAR_CURVE);
+
+	/**
+	 * Adds a timeline following a custom curve that is not running yet, with an output range of 0 to 100.
+	 *
+	 * @param duration The duration of timeline execution in seconds.
+	 * @param direction The direction of the timeline output.
+	 * @param curve The curve for the timeline to follow, shared rather than copied.
+	 * @return The id of the new timeline.
+	 */
+	Id add(double duration, const Timeline::Direction& direction, const boost::shared_ptr<const TimelineCurve>& curve);
+
+	/**
+	 * Removes a timeline, releasing its id.
+	 *
+	 * @param id The id of the timeline.
+	 */
+	void remove(Id id);
+
+	/**
+	 * Removes every timeline.
+	 */
+	void clear();
+
+	/**
+	 * Returns the number of timelines in the group.
+	 *
+	 * @return The number of timelines.
+	 */
+	std::size_t size() const;
+
+	/**
+	 * Returns the number of running timelines in the group.
+	 *
+	 * @return The number of running timelines.
+	 */
+	std::size_t runningCount() const;
+
+	/**
+	 * Sets the range of output values of a timeline. Takes effect the next time it starts.
+	 *
+	 * @param id The id of the timeline.
+	 * @param startOutput The starting output value for the timeline.
+	 * @param endOutput The ending output value for the timeline.
+	 */
+	void setOutputRange(Id id, double startOutput, double endOutput);
+
+	/**
+	 * Starts a timeline at the time of the last update, or unpauses it if it is paused.
+	 *
+	 * @param id The id of the timeline.
+	 */
+	void start(Id id);
+
+	/**
+	 * Restarts a timeline from the beginning at the time of the last update.
+	 *
+	 * @param id The id of the timeline.
+	 */
+	void restart(Id id);
+
+	/**
+	 * Stops a timeline.
+	 *
+	 * @param id The id of the timeline.
+	 */
+	void stop(Id id);
+
+	/**
+	 * Pauses a running timeline at the time of the last update.
+	 *
+	 * @param id The id of the timeline.
+	 */
+	void pause(Id id);
+
+	/**
+	 * Unpauses a paused timeline at the time of the last update.
+	 *
+	 * @param id The id of the timeline.
+	 */
+	void unpause(Id id);
+
+	/**
+	 * Reads the group's clock once and updates every running timeline.
+	 */
+	void update();
+
+	/**
+	 * Updates every running timeline to the given time.
+	 *
+	 * @param time The time in seconds on the group's clock. Times before the last update are ignored.
+	 */
+	void update(double time);
+
+	/**
+	 * Returns the time of the last update in seconds on the group's clock.
+	 *
+	 * @return The time of the last update.
+	 */
+	double time() const;
+
+	/**
+	 * Returns the ids of the timelines that finished during the last update.
+	 *
+	 * @return The ids of the finished timelines.
+	 */
+	const std::vector<Id>& finished() const;
+
+	/**
+	 * Returns the state of a timeline.
+	 *
+	 * @param id The id of the timeline.
+	 * @return The state of the timeline.
+	 */
+	Timeline::State state(Id id) const;
+
+	/**
+	 * Returns the step value of a timeline.
+	 *
+	 * @param id The id of the timeline.
+	 * @return The step value of the timeline.
+	 */
+	double stepValue(Id id) const;
+
+	/**
+	 * Returns the step increment of a timeline.
+	 *
+	 * @param id The id of the timeline.
+	 * @return The step increment of the timeline.
+	 */
+	double stepIncrement(Id id) const;
+
+protected:
+
+	/**
+	 * @internal
+	 * The running timelines of one curve shape, stored as struct-of-arrays.
+	 */
+	struct CurvePool
+	{
+		std::vector<Id>			ids;				/**< @internal The id of each timeline. */
+		std::vector<double>		startTimes;			/**< @internal The group time each timeline started. */
+		std::vector<const TimelineCurve*>	curves;	/**< @internal The curve of each timeline in the custom pool. */
+		std::vector<double>		inverseDurations;	/**< @internal One over each duration. */
+		std::vector<double>		bases;				/**< @internal The output when the curve is 0. */
+		std::vector<double>		scales;				/**< @internal The signed output range. */
+		std::vector<double>		values;				/**< @internal The step values. */
+		std::vector<double>		increments;			/**< @internal The step increments. */
+	};
+
+	/**
+	 * @internal
+	 * The per-timeline properties that are not needed while updating.
+	 */
+	struct Record
+	{
+		bool					inUse;				/**< @internal Whether the id is in use. */
+		Timeline::State			state;				/**< @internal The state of the timeline. */
+		Timeline::Direction		direction;			/**< @internal The direction of the timeline. */
+		Timeline::CurveShape	curveShape;			/**< @internal The curve shape and pool of the timeline. */
+		boost::shared_ptr<const TimelineCurve>	curve;	/**< @internal The curve of a CUSTOM_CURVE timeline. */
+		double					duration;			/**< @internal The duration of the timeline. */
+		double					startOutput;		/**< @internal The starting output value. */
+		double					endOutput;			/**< @internal The ending output value. */
+		double					runTime;			/**< @internal The run time when paused. */
+		double					stepValue;			/**< @internal The step value when not running. */
+		double					stepIncrement;		/**< @internal The step increment when not running. */
+		std::size_t				poolIndex;			/**< @internal The index in the curve pool when running. */
+	};
+
+	/**
+	 * @internal
+	 * Returns the record of a timeline.
+	 *
+	 * @throw bump::OutOfRangeError When the id is not in use.
+	 *
+	 * @param id The id of the timeline.
+	 * @return The record of the timeline.
+	 */
+	const Record& record(Id id) const;
+
+	/**
+	 * @internal
+	 * Returns the record of a timeline.
+	 *
+	 * @throw bump::OutOfRangeError When the id is not in use.
+	 *
+	 * @param id The id of the timeline.
+	 * @return The record of the timeline.
+	 */
+	Record& record(Id id);
+
+	/**
+	 * @internal
+	 * Stores a new record under a free id.
+	 *
+	 * @param newRecord The record of the new timeline.
+	 * @return The id of the new timeline.
+	 */
+	Id insert(const Record& newRecord);
+
+	/**
+	 * @internal
+	 * Adds a timeline to its curve pool so it is updated.
+	 *
+	 * @param id The id of the timeline.
+	 * @param startTime The group time the timeline started at.
+	 * @param stepValue The current step value.
+	 * @param stepIncrement The current step increment.
+	 */
+	void activate(Id id, double startTime, double stepValue, double stepIncrement);
+
+	/**
+	 * @internal
+	 * Removes a running timeline from its curve pool, copying its step values into its record.
+	 *
+	 * @param id The id of the timeline.
+	 */
+	void deactivate(Id id);
+
+	// Instance member variables
+	Timer					_timer;			/**< @internal The group's clock. */
+	double					_time;			/**< @internal The group time of the last update. */
+	std::vector<Record>		_records;		/**< @internal The record of each id. */
+	std::vector<Id>			_freeIds;		/**< @internal The ids of removed timelines. */
+	CurvePool				_pools[Timeline::CUSTOM_CURVE + 1];	/**< @internal The running timelines of each curve shape. */
+	std::vector<std::size_t>	_finishedIndices;	/**< @internal Scratch space for the finished pool indices. */
+	std::vector<Id>			_finished;		/**< @internal The timelines that finished during the last update. */
+};
+
+}	// End of bump namespace
+
+#endif	// End of BUMP_TIMELINE_GROUP_H
@@ -9,9 +9,6 @@
 #ifndef BUMP_TIMER_H
 #define BUMP_TIMER_H
 
-// Boost headers
-#include <boost/timer/timer.hpp>
-
 // Bump headers
 #include <bump/Export.h>
 
@@ -19,15 +16,33 @@ namespace bump {
 
 /**
  * Timer class used for measuring elapsed time between two events.
+ *
+ * The timer measures wall time from a monotonic clock and keeps it as an integer number of
+ * nanoseconds, so reading it never allocates and is cheap enough to do every iteration of a
+ * hot loop. The timer starts running as soon as it is constructed.
  */
 class BUMP_EXPORT Timer
 {
 public:
 
+	/**
+	 * Defines the clocks a timer can read.
+	 */
+	enum Clock
+	{
+		STEADY_CLOCK,			/**< The operating system's monotonic clock (about 20 ns per reading). */
+		TIME_STAMP_COUNTER		/**< The processor's invariant time stamp counter, converted to nanoseconds with a
+									 frequency calibrated against the steady clock (about 10 ns per reading). Falls
+									 back to the steady clock when the processor does not provide one. */
+	};
+
 	/**
 	 * Constructor.
+	 *
+	 * @param clock The clock to measure time with. The first time stamp counter timer calibrates the
+	 *              counter frequency, which blocks for about 10 milliseconds.
 	 */
-	Timer();
+	Timer(const Clock& clock = STEADY_CLOCK);
 
 	/**
 	 * Destructor.
@@ -41,6 +56,28 @@ public:
 	 */
 	static Timer* instance();
 
+	/**
+	 * Determines whether the processor provides an invariant time stamp counter.
+	 *
+	 * @return True if TIME_STAMP_COUNTER timers read the time stamp counter, otherwise false.
+	 */
+	static bool isTimeStampCounterAvailable();
+
+	/**
+	 * Reads the steady clock.
+	 *
+	 * @return The number of nanoseconds since an unspecified but fixed point in time.
+	 */
+	static unsigned long long steadyNanoseconds();
+
+	/**
+	 * Returns the clock the timer reads, which is the steady clock if the time stamp counter was
+	 * requested but is not available.
+	 *
+	 * @return The clock the timer reads.
+	 */
+	Clock clock() const;
+
 	/**
 	 * Starts the timer.
 	 */
@@ -61,6 +98,14 @@ public:
 	 */
 	void restart();
 
+	/**
+	 * Calculates the elapsed time in whole nanoseconds between the start time and now, excluding
+	 * the time spent paused. This is the cheapest way to read the timer.
+	 *
+	 * @return The elapsed time between the start time and now.
+	 */
+	unsigned long long elapsedNanoseconds() const;
+
 	/**
 	 * Calculates the elapsed time in seconds between the start time and now.
 	 *
@@ -91,8 +136,29 @@ public:
 
 protected:
 
+	/**
+	 * @internal
+	 * Reads the timer's clock in its native ticks.
+	 *
+	 * @return The current tick count.
+	 */
+	unsigned long long ticks() const;
+
+	/**
+	 * @internal
+	 * Converts a number of ticks of the timer's clock to nanoseconds.
+	 *
+	 * @param ticks The number of ticks to convert.
+	 * @return The number of nanoseconds.
+	 */
+	unsigned long long ticksToNanoseconds(unsigned long long ticks) const;
+
 	// Instance member variables
-	boost::timer::cpu_timer _timer;		/**< @internal The boost cpu timer used to compute the elapsed times. */
+	Clock				_clock;					/**< @internal The clock the timer reads. */
+	double				_nanosecondsPerTick;	/**< @internal The length of a clock tick in nanoseconds. */
+	unsigned long long	_startTicks;			/**< @internal The tick count when the timer was last started or unpaused. */
+	unsigned long long	_pausedTicks;			/**< @internal The ticks accumulated before the timer was last paused. */
+	bool				_paused;				/**< @internal Whether the timer is paused. */
 };
 
 }	// End of bump namespace
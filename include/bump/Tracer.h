@@ -0,0 +1,231 @@
+//
+//	Tracer.h
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+#ifndef BUMP_TRACER_H
+#define BUMP_TRACER_H
+
+// C++ headers
+#include <cstddef>
+
+// Bump headers
+#include <bump/Export.h>
+#include <bump/String.h>
+
+// Defines the environment variables to configure tracing
+#define BUMP_TRACE_FILE				"BUMP_TRACE_FILE"
+#define BUMP_TRACE_SAMPLE_INTERVAL	"BUMP_TRACE_SAMPLE_INTERVAL"
+
+/**
+ * Traces the rest of the enclosing scope as a begin and end event. The category and name must
+ * be string literals or otherwise live as long as the process.
+ *
+ * Defining BUMP_DISABLE_TRACING before including this header compiles every traced scope out.
+ */
+#ifdef BUMP_DISABLE_TRACING
+	#define BUMP_TRACE_SCOPE(category, name)
+	#define BUMP_TRACE_SCOPE_WITH_ARGUMENT(category, name, argumentName, argumentValue)
+#else
+	#define BUMP_TRACE_SCOPE(category, name) \
+		bump::TraceScope BUMP_TRACE_SCOPE_VARIABLE(__LINE__)(category, name)
+	#define BUMP_TRACE_SCOPE_WITH_ARGUMENT(category, name, argumentName, argumentValue) \
+		bump::TraceScope BUMP_TRACE_SCOPE_VARIABLE(__LINE__)(category, name, argumentName, argumentValue)
+#endif
+
+/** @internal Names the TraceScope variable after the line so several scopes can share a block. */
+#define BUMP_TRACE_SCOPE_VARIABLE(line) BUMP_TRACE_SCOPE_CONCATENATE(bumpTraceScope, line)
+#define BUMP_TRACE_SCOPE_CONCATENATE(prefix, line) prefix##line
+
+namespace bump {
+
+/**
+ * The Tracer records timestamped events into per-thread buffers and writes them to a file in the
+ * Chrome trace event format, which chrome://tracing and the Perfetto UI can display as a timeline
+ * of every thread.
+ *
+ * Each thread records into its own ring buffer, which flush() drains without stopping the thread,
+ * so recording an event never takes a lock. Events recorded while a thread's buffer is full are
+ * dropped and counted, so flush often enough to keep up with the threads.
+ *
+ * The following environment variables configure tracing at startup:
+ *	  - BUMP_TRACE_FILE: Enables tracing and sets the file flush() writes the events to:
+ *		  * /home/username/trace.json
+ *	  - BUMP_TRACE_SAMPLE_INTERVAL: Traces only one of every so many scopes on each thread:
+ *		  * 100
+ *
+ * Each flush appends to the file, which is left as an unterminated JSON array as the trace event
+ * format allows, so a trace is viewable even if the process crashes. The remaining events are
+ * flushed when the process exits.
+ *
+ *   void Connection::read()
+ *   {
+ *       BUMP_TRACE_SCOPE_WITH_ARGUMENT("network", "read", "bytes", pendingBytes());
+ *       ...
+ *   }
+ */
+class BUMP_EXPORT Tracer
+{
+public:
+
+	/**
+	 * Returns whether events are being recorded.
+	 *
+	 * @return True if tracing is enabled, false otherwise.
+	 */
+	static bool isEnabled();
+
+	/**
+	 * Enables or disables recording events. Events already recorded stay buffered until flushed.
+	 *
+	 * @param enabled Whether to record events.
+	 */
+	static void setEnabled(bool enabled);
+
+	/**
+	 * Sets how many scopes each thread skips for every scope it traces.
+	 *
+	 * @param interval Traces one of every interval scopes, where 1 traces them all.
+	 */
+	static void setSampleInterval(unsigned int interval);
+
+	/**
+	 * Returns how many scopes each thread skips for every scope it traces.
+	 *
+	 * @return The sample interval.
+	 */
+	static unsigned int sampleInterval();
+
+	/**
+	 * Sets the file flush() writes the events to. The file is replaced on the next flush.
+	 *
+	 * @param path The path of the trace file.
+	 */
+	static void setTraceFile(const String& path);
+
+	/**
+	 * Returns the file flush() writes the events to.
+	 *
+	 * @return The path of the trace file.
+	 */
+	static String traceFile();
+
+	/**
+	 * Names the calling thread in the trace.
+	 *
+	 * @param name The name of the thread.
+	 */
+	static void setThreadName(const String& name);
+
+	/**
+	 * Appends the buffered events of every thread to the trace file.
+	 *
+	 * This is thread-safe, and does not block threads recording events.
+	 *
+	 * @return True if the events were written, false if there is no trace file or it could not be written.
+	 */
+	static bool flush();
+
+	/**
+	 * Returns the number of events dropped because a thread's buffer was full.
+	 *
+	 * @return The number of dropped events.
+	 */
+	static unsigned long long droppedEvents();
+
+	/**
+	 * Records the start of a duration on the calling thread.
+	 *
+	 * @param category The category of the event, which the trace viewers can filter by.
+	 * @param name The name of the event.
+	 * @param argumentName The name of an argument to show with the event, or NULL for none.
+	 * @param argumentValue The value of the argument.
+	 */
+	static void beginEvent(const char* category, const char* name, const char* argumentName = NULL, double argumentValue = 0.0);
+
+	/**
+	 * Records the end of the duration most recently begun on the calling thread.
+	 *
+	 * @param category The category of the event.
+	 * @param name The name of the event.
+	 */
+	static void endEvent(const char* category, const char* name);
+
+	/**
+	 * Records an event without a duration on the calling thread.
+	 *
+	 * @param category The category of the event.
+	 * @param name The name of the event.
+	 * @param argumentName The name of an argument to show with the event, or NULL for none.
+	 * @param argumentValue The value of the argument.
+	 */
+	static void instantEvent(const char* category, const char* name, const char* argumentName = NULL, double argumentValue = 0.0);
+
+	/**
+	 * @internal
+	 * Returns whether the calling thread should trace its next scope.
+	 *
+	 * @return True if the scope should be traced, false otherwise.
+	 */
+	static bool sampleScope();
+};
+
+/**
+ * The TraceScope class records a begin event when it is created and an end event when it is
+ * destructed, the same way an AutoTimer times its scope. Use the BUMP_TRACE_SCOPE macros rather
+ * than creating these directly so the scopes can be compiled out.
+ */
+class BUMP_EXPORT TraceScope
+{
+public:
+
+	/**
+	 * Constructor begins the scope if tracing is enabled and the scope is sampled.
+	 *
+	 * @param category The category of the scope.
+	 * @param name The name of the scope.
+	 */
+	TraceScope(const char* category, const char* name);
+
+	/**
+	 * Constructor begins the scope with an argument if tracing is enabled and the scope is sampled.
+	 *
+	 * @param category The category of the scope.
+	 * @param name The name of the scope.
+	 * @param argumentName The name of the argument to show with the scope.
+	 * @param argumentValue The value of the argument.
+	 */
+	TraceScope(const char* category, const char* name, const char* argumentName, double argumentValue);
+
+	/**
+	 * Destructor ends the scope if it was begun.
+	 */
+	~TraceScope();
+
+protected:
+
+	// Instance member variables
+	const char*		_category;		/**< @internal The category of the scope. */
+	const char*		_name;			/**< @internal The name of the scope, or NULL if it is not traced. */
+
+private:
+
+	/**
+	 * @internal
+	 * Copy constructor. Scopes cannot be copied.
+	 */
+	TraceScope(const TraceScope& scope);
+
+	/**
+	 * @internal
+	 * Overloaded assignment operator. Scopes cannot be copied.
+	 */
+	void operator=(const TraceScope& scope);
+};
+
+}	// End of bump namespace
+
+#endif	// End of BUMP_TRACER_H
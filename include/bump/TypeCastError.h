@@ -28,7 +28,7 @@ public:
 	 * @param description The description of the exception.
 	 * @param location The file path, line number and function name of where the exception was thrown.
 	 */
-	TypeCastError(const String& description, const String& location) throw();
+	TypeCastError(const String& description, const SourceLocation& location) throw();
 
 	/**
 	 * Destructor.
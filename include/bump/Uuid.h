@@ -9,10 +9,17 @@
 #ifndef BUMP_UUID_H
 #define BUMP_UUID_H
 
+// C++ headers
+#include <cstddef>
+#include <cstring>
+#include <functional>
+
 // Boost headers
+#include <boost/config.hpp>
 #include <boost/uuid/uuid.hpp>
 
 // Bump headers
+#include <bump/Expected.h>
 #include <bump/Export.h>
 
 namespace bump {
@@ -54,7 +61,60 @@ public:
 	~Uuid();
 
 	/**
-	 * Generates a random uuid by automatically seedings a random number generator.
+	 * Defines the random number generators that can be used to generate random uuids.
+	 */
+	enum Generator
+	{
+		SECURE,		/**< A ChaCha20 based cryptographically secure generator seeded from the operating system. */
+		FAST		/**< A xoshiro256** generator seeded from the secure generator. It is not cryptographically
+						 secure, so its uuids should not be used where they must be unguessable. */
+	};
+
+	/**
+	 * Generates a random (version 4) uuid.
+	 *
+	 * Each thread lazily creates and seeds its own generator the first time it generates a uuid,
+	 * so generating uuids never contends on a lock and only the first uuid on each thread pays
+	 * for reading the operating system's entropy source.
+	 *
+	 * @throw bump::NotImplementedError When the operating system's entropy source cannot be read.
+	 *
+	 * @param generator The random number generator to use.
+	 * @return A random uuid.
+	 */
+	static Uuid generateRandom(const Generator& generator = SECURE);
+
+	/**
+	 * Fills a buffer with random (version 4) uuids. This is the fastest way to generate large
+	 * numbers of uuids as the per-call overhead is paid only once for the whole batch.
+	 *
+	 * @throw bump::NotImplementedError When the operating system's entropy source cannot be read.
+	 *
+	 * @param count The number of uuids to generate.
+	 * @param uuids The buffer of at least count uuids to fill.
+	 * @param generator The random number generator to use.
+	 */
+	static void generateRandomBatch(unsigned int count, Uuid* uuids, const Generator& generator = SECURE);
+
+	/**
+	 * Generates a time ordered (version 7) uuid as defined by RFC 9562.
+	 *
+	 * The first 48 bits hold the number of milliseconds since the Unix epoch, followed by a 16 bit
+	 * counter that increments for each uuid generated within the same millisecond, and 58 random
+	 * bits. Uuids generated by this process therefore always compare greater than the ones generated
+	 * before them, keeping inserts into ordered indexes local. Generating more than 65536 uuids in a
+	 * single millisecond borrows from the next millisecond rather than breaking the ordering.
+	 *
+	 * This is thread-safe and lock-free.
+	 *
+	 * @return A time ordered uuid.
+	 */
+	static Uuid generateTimeOrdered();
+
+	/**
+	 * Generates a random uuid using the secure generator.
+	 *
+	 * @deprecated Misspelled, use generateRandom() instead.
 	 *
 	 * @return A random uuid.
 	 */
@@ -63,6 +123,9 @@ public:
 	/**
 	 * Generates a uuid from the given string (i.e. "00000000-0000-0000-0000-000000000000").
 	 *
+	 * The canonical 36 character form is accepted along with the same form wrapped in braces
+	 * and the 32 hex digit form without dashes. Hex digits may be upper or lower case.
+	 *
 	 * @throw bump::TypeCastError When string cannot be converted to uuid.
 	 *
 	 * @param uuidString A string formatted as a uuid to create the uuid from.
@@ -70,6 +133,34 @@ public:
 	 */
 	static Uuid fromString(const String& uuidString);
 
+	/**
+	 * Converts the given string to a uuid without throwing. Accepts the same forms as fromString().
+	 *
+	 * @param uuidString A string formatted as a uuid to create the uuid from.
+	 * @param uuid The uuid to store the result in. It is left unchanged if the conversion fails.
+	 * @return True if the string was converted, otherwise false.
+	 */
+	static bool tryFromString(const String& uuidString, Uuid& uuid);
+
+	/**
+	 * Converts the given string to a uuid without throwing. Accepts the same forms as fromString().
+	 *
+	 * @param uuidString A string formatted as a uuid to create the uuid from.
+	 * @return The uuid, or a TYPE_CAST_ERROR result when the string cannot be converted.
+	 */
+	static Expected<Uuid> tryFromString(const String& uuidString);
+
+	/**
+	 * Converts the given characters to a uuid without throwing or copying them into a string.
+	 * Accepts the same forms as fromString().
+	 *
+	 * @param chars The characters formatted as a uuid, which do not need to be null terminated.
+	 * @param length The number of characters.
+	 * @param uuid The uuid to store the result in. It is left unchanged if the conversion fails.
+	 * @return True if the characters were converted, otherwise false.
+	 */
+	static bool tryFromString(const char* chars, std::size_t length, Uuid& uuid);
+
 	/**
 	 * Determines whether the uuid is null or equal to "00000000-0000-0000-0000-000000000000".
 	 *
@@ -77,6 +168,13 @@ public:
 	 */
 	bool isNull() const;
 
+	/**
+	 * Returns the creation time of a time ordered (version 7) uuid.
+	 *
+	 * @return The number of milliseconds since the Unix epoch, or 0 if this is not a version 7 uuid.
+	 */
+	unsigned long long timestamp() const;
+
 	/**
 	 * Converts the uuid to a string.
 	 *
@@ -84,13 +182,21 @@ public:
 	 */
 	String toString() const;
 
+	/**
+	 * Writes the canonical 36 character form of the uuid into a caller-provided buffer, avoiding
+	 * the string allocation of toString().
+	 *
+	 * @param chars The buffer to write to. It must hold at least 36 characters and is not null terminated.
+	 */
+	void toChars(char* chars) const;
+
 	/**
 	 * Determines whether this uuid and the right-hand side uuid are equal.
 	 *
 	 * @param rhs The right-hand side uuid.
 	 * @return True if this uuid and the right-hand side uuid are equal, otherwise returns false.
 	 */
-	bool operator==(const Uuid& rhs);
+	bool operator==(const Uuid& rhs) const;
 
 	/**
 	 * Determines whether this uuid and the right-hand side uuid are not equal.
@@ -98,15 +204,16 @@ public:
 	 * @param rhs The right-hand side uuid.
 	 * @return True if this uuid and the right-hand side uuid are not equal, otherwise returns false.
 	 */
-	bool operator!=(const Uuid& rhs);
+	bool operator!=(const Uuid& rhs) const;
 
 	/**
-	 * Determines whether this uuid is less than the right-hand side uuid.
+	 * Determines whether this uuid is less than the right-hand side uuid. Uuids are compared byte by
+	 * byte, so time ordered uuids sort in the order they were generated.
 	 *
 	 * @param rhs The right-hand side uuid.
 	 * @return True if this uuid is less than the right-hand side uuid, otherwise returns false.
 	 */
-	bool operator<(const Uuid& rhs);
+	bool operator<(const Uuid& rhs) const;
 
 	/**
 	 * Determines whether this uuid is greater than the right-hand side uuid.
@@ -114,7 +221,7 @@ public:
 	 * @param rhs The right-hand side uuid.
 	 * @return True if this uuid is greater than the right-side uuid, otherwise returns false.
 	 */
-	bool operator>(const Uuid& rhs);
+	bool operator>(const Uuid& rhs) const;
 
 	/**
 	 * Determines whether this uuid is less than or equal to the right-hand side uuid.
@@ -122,7 +229,7 @@ public:
 	 * @param rhs The right-hand side uuid.
 	 * @return True if this uuid is less than or equal to the right-side uuid, otherwise returns false.
 	 */
-	bool operator<=(const Uuid& rhs);
+	bool operator<=(const Uuid& rhs) const;
 
 	/**
 	 * Determines whether this uuid is greater than or equal to the right-hand side uuid.
@@ -130,9 +237,51 @@ public:
 	 * @param rhs The right-hand side uuid.
 	 * @return True if this uuid is greater than or equal to the right-side uuid, otherwise returns false.
 	 */
-	bool operator>=(const Uuid& rhs);
+	bool operator>=(const Uuid& rhs) const;
 };
 
+/**
+ * Hashes a uuid for boost::hash and the std::hash specialization.
+ *
+ * Random (version 4) and time ordered (version 7) uuids are already made of random bits, so
+ * rather than running them through a general purpose hash the two 64 bit halves are simply
+ * folded together. Uuids built from structured data (e.g. sequential values) should be hashed
+ * with bump::FastHash instead.
+ *
+ * @param uuid The uuid to hash.
+ * @return The hash of the uuid.
+ */
+inline std::size_t hash_value(const Uuid& uuid)
+{
+	unsigned long long halves[2];
+	std::memcpy(halves, uuid.data, sizeof(halves));
+	unsigned long long folded = halves[0] ^ halves[1];
+	if (sizeof(std::size_t) < sizeof(folded))
+	{
+		folded ^= folded >> 32;
+	}
+	return static_cast<std::size_t>(folded);
+}
+
 }	// End of bump namespace
 
+// Provide std::hash support so the Uuid can key the C++11 unordered containers
+#ifndef BOOST_NO_CXX11_HDR_FUNCTIONAL
+namespace std {
+
+/**
+ * Hashes a bump::Uuid using bump::hash_value().
+ */
+template<>
+struct hash<bump::Uuid>
+{
+	std::size_t operator()(const bump::Uuid& uuid) const
+	{
+		return bump::hash_value(uuid);
+	}
+};
+
+}	// End of std namespace
+#endif
+
 #endif	// End of BUMP_UUID_H
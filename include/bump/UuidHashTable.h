@@ -0,0 +1,351 @@
+//
+//	UuidHashTable.h
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+#ifndef BUMP_UUID_HASH_TABLE_H
+#define BUMP_UUID_HASH_TABLE_H
+
+// C++ headers
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+// Bump headers
+#include <bump/Uuid.h>
+
+// Probe groups of control bytes with SSE2 when the target guarantees it
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define BUMP_UUID_HASH_TABLE_SSE2
+	#include <emmintrin.h>
+#endif
+#ifdef _MSC_VER
+	#include <intrin.h>
+#endif
+
+namespace bump {
+
+/**
+ * Extracts the key of a UuidHashSet slot.
+ */
+struct UuidSetKey
+{
+	static const Uuid& key(const Uuid& slot) { return slot; }
+};
+
+/**
+ * Extracts the key of a UuidHashMap slot.
+ */
+template <class T>
+struct UuidMapKey
+{
+	static const Uuid& key(const std::pair<const Uuid, T>& slot) { return slot.first; }
+};
+
+/**
+ * The UuidHashTable is an open addressing hash table specialized for Uuid keys. It is the
+ * shared implementation of the UuidHashMap and UuidHashSet and is not meant to be used directly.
+ *
+ * Slots are stored in one flat array next to an array of one byte control codes. Each control
+ * byte marks its slot as empty, deleted or full, and full slots also store 7 bits of the key's
+ * hash. Lookups compare a whole group of 16 control bytes against the hash bits at once (with
+ * SSE2 when available), so only slots whose hash bits match are compared, and there are no
+ * per-entry allocations or pointers to chase. The table grows when it is 7/8 full.
+ *
+ * Inserting may move every slot, which invalidates all iterators, pointers and references.
+ * Erasing only invalidates iterators to the erased slot.
+ */
+template <class Slot, class KeyOf>
+class UuidHashTable
+{
+public:
+
+	/**
+	 * Iterates over the full slots of the table in no particular order.
+	 */
+	template <class Value, class Table>
+	class Iterator
+	{
+	public:
+
+		typedef std::forward_iterator_tag iterator_category;
+		typedef Value value_type;
+		typedef std::ptrdiff_t difference_type;
+		typedef Value* pointer;
+		typedef Value& reference;
+
+		Iterator() : _table(NULL), _index(0) {}
+		Iterator(Table* table, std::size_t index) : _table(table), _index(index) {}
+
+		/** Allows converting an iterator to a const iterator. */
+		template <class OtherValue, class OtherTable>
+		Iterator(const Iterator<OtherValue, OtherTable>& other) : _table(other.table()), _index(other.index()) {}
+
+		Value& operator*() const { return _table->_slots[_index]; }
+		Value* operator->() const { return &_table->_slots[_index]; }
+		Iterator& operator++() { _index = _table->nextFull(_index + 1); return *this; }
+		Iterator operator++(int) { Iterator previous = *this; ++(*this); return previous; }
+
+		template <class OtherValue, class OtherTable>
+		bool operator==(const Iterator<OtherValue, OtherTable>& rhs) const { return _index == rhs.index(); }
+		template <class OtherValue, class OtherTable>
+		bool operator!=(const Iterator<OtherValue, OtherTable>& rhs) const { return _index != rhs.index(); }
+
+		Table* table() const { return _table; }
+		std::size_t index() const { return _index; }
+
+	protected:
+
+		Table*			_table;		/**< @internal The table being iterated. */
+		std::size_t		_index;		/**< @internal The index of the current slot. */
+	};
+
+	// Typedefs
+	typedef Slot value_type;
+	typedef std::size_t size_type;
+	typedef Iterator<Slot, UuidHashTable> iterator;
+	typedef Iterator<const Slot, const UuidHashTable> const_iterator;
+
+	/**
+	 * Constructor creates an empty table without allocating.
+	 */
+	UuidHashTable();
+
+	/**
+	 * Copy constructor.
+	 *
+	 * @param table The table to copy.
+	 */
+	UuidHashTable(const UuidHashTable& table);
+
+	/**
+	 * Destructor.
+	 */
+	~UuidHashTable();
+
+	/**
+	 * Assignment operator.
+	 *
+	 * @param table The table to copy.
+	 * @return This table.
+	 */
+	UuidHashTable& operator=(const UuidHashTable& table);
+
+	/** Returns an iterator to the first element. */
+	iterator begin() { return iterator(this, nextFull(0)); }
+
+	/** Returns an iterator past the last element. */
+	iterator end() { return iterator(this, _capacity); }
+
+	/** Returns a const iterator to the first element. */
+	const_iterator begin() const { return const_iterator(this, nextFull(0)); }
+
+	/** Returns a const iterator past the last element. */
+	const_iterator end() const { return const_iterator(this, _capacity); }
+
+	/** Returns the number of elements. */
+	std::size_t size() const { return _size; }
+
+	/** Returns whether there are no elements. */
+	bool empty() const { return _size == 0; }
+
+	/** Returns the number of slots currently allocated. */
+	std::size_t capacity() const { return _capacity; }
+
+	/**
+	 * Removes all the elements, keeping the allocated slots.
+	 */
+	void clear();
+
+	/**
+	 * Allocates enough slots to hold the number of elements without growing.
+	 *
+	 * @param count The number of elements to make room for.
+	 */
+	void reserve(std::size_t count);
+
+	/**
+	 * Finds the element with the given key.
+	 *
+	 * @param key The key to search for.
+	 * @return An iterator to the element or end() if there is no such element.
+	 */
+	iterator find(const Uuid& key) { return iterator(this, findIndex(key)); }
+
+	/**
+	 * Finds the element with the given key.
+	 *
+	 * @param key The key to search for.
+	 * @return A const iterator to the element or end() if there is no such element.
+	 */
+	const_iterator find(const Uuid& key) const { return const_iterator(this, findIndex(key)); }
+
+	/**
+	 * Determines whether there is an element with the given key.
+	 *
+	 * @param key The key to search for.
+	 * @return True if there is such an element, otherwise false.
+	 */
+	bool contains(const Uuid& key) const { return findIndex(key) != _capacity; }
+
+	/**
+	 * Counts the elements with the given key.
+	 *
+	 * @param key The key to search for.
+	 * @return 1 if there is such an element, otherwise 0.
+	 */
+	std::size_t count(const Uuid& key) const { return contains(key) ? 1 : 0; }
+
+	/**
+	 * Inserts the slot if there is no element with the same key.
+	 *
+	 * @param slot The slot to insert.
+	 * @return An iterator to the element with the key, and whether the slot was inserted.
+	 */
+	std::pair<iterator, bool> insert(const Slot& slot);
+
+	/**
+	 * Removes the element with the given key.
+	 *
+	 * @param key The key of the element to remove.
+	 * @return The number of elements removed (0 or 1).
+	 */
+	std::size_t erase(const Uuid& key);
+
+	/**
+	 * Removes the element the iterator points to.
+	 *
+	 * @param position An iterator to the element to remove.
+	 */
+	void erase(const_iterator position);
+
+protected:
+
+	/**
+	 * @internal
+	 * Returns the index of the slot holding the key, or the capacity if there is none.
+	 */
+	std::size_t findIndex(const Uuid& key) const;
+
+	/**
+	 * @internal
+	 * Returns the index of the first full slot at or after the index, or the capacity if there is none.
+	 */
+	std::size_t nextFull(std::size_t index) const;
+
+	/**
+	 * @internal
+	 * Marks the slot as no longer in use and destroys its contents.
+	 */
+	void eraseIndex(std::size_t index);
+
+	/**
+	 * @internal
+	 * Reallocates the table with the given number of slots and reinserts every element.
+	 */
+	void rehash(std::size_t capacity);
+
+	/**
+	 * @internal
+	 * Stores the slot at the first free position of its probe sequence without checking for duplicates.
+	 */
+	std::size_t insertUnique(const Slot& slot, unsigned long long hash);
+
+	/**
+	 * @internal
+	 * Destroys every element and frees the arrays.
+	 */
+	void destroy();
+
+	/**
+	 * @internal
+	 * Mixes the uuid hash so both its low bits (the group) and high bits (the control byte) are usable.
+	 */
+	static unsigned long long hashKey(const Uuid& key);
+
+	/**
+	 * @internal
+	 * Returns a bit mask of the control bytes in the group equal to the value.
+	 */
+	static unsigned int matchGroup(const signed char* group, signed char value);
+
+	/**
+	 * @internal
+	 * Returns a bit mask of the control bytes in the group that are empty or deleted.
+	 */
+	static unsigned int matchFree(const signed char* group);
+
+	/**
+	 * @internal
+	 * Returns the index of the lowest set bit of a non-zero mask.
+	 */
+	static unsigned int firstBit(unsigned int mask);
+
+	// Instance member variables
+	signed char*		_controls;		/**< @internal The control byte of each slot. */
+	Slot*				_slots;			/**< @internal The slots. */
+	std::size_t			_capacity;		/**< @internal The number of slots, a power of two multiple of the group size. */
+	std::size_t			_size;			/**< @internal The number of full slots. */
+	std::size_t			_deleted;		/**< @internal The number of deleted slots. */
+	std::allocator<Slot>	_allocator;	/**< @internal Allocates the slots. */
+};
+
+/**
+ * A hash map from Uuid keys to values, built on the open addressing UuidHashTable. It is
+ * much more cache friendly than a std::map<Uuid, T> and supports the common subset of the
+ * std::map interface:
+ *
+ *   bump::UuidHashMap<Session> sessions;
+ *   sessions[uuid] = session;
+ *   bump::UuidHashMap<Session>::iterator iter = sessions.find(uuid);
+ *   if (iter != sessions.end()) { iter->second ... }
+ */
+template <class T>
+class UuidHashMap : public UuidHashTable<std::pair<const Uuid, T>, UuidMapKey<T> >
+{
+public:
+
+	// Typedefs
+	typedef UuidHashTable<std::pair<const Uuid, T>, UuidMapKey<T> > Table;
+	typedef Uuid key_type;
+	typedef T mapped_type;
+
+	// Bring the table insert overloads into scope
+	using Table::insert;
+
+	/**
+	 * Inserts the value if there is no element with the same key.
+	 *
+	 * @param key The key of the element.
+	 * @param value The value of the element.
+	 * @return An iterator to the element with the key, and whether the value was inserted.
+	 */
+	std::pair<typename Table::iterator, bool> insert(const Uuid& key, const T& value);
+
+	/**
+	 * Returns the value for the key, inserting a default constructed value if there is none.
+	 *
+	 * @param key The key of the element.
+	 * @return The value of the element.
+	 */
+	T& operator[](const Uuid& key);
+};
+
+/**
+ * A hash set of Uuids, built on the open addressing UuidHashTable. It is much more cache
+ * friendly than a std::set<Uuid> and supports the common subset of the std::set interface.
+ */
+class UuidHashSet : public UuidHashTable<Uuid, UuidSetKey>
+{
+};
+
+}	// End of bump namespace
+
+// Pull in the UuidHashTable template implementations
+#include <bump/UuidHashTable_impl.h>
+
+#endif	// End of BUMP_UUID_HASH_TABLE_H
@@ -0,0 +1,394 @@
+//
+//	UuidHashTable_impl.h
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+#ifndef BUMP_UUID_HASH_TABLE_IMPL_H
+#define BUMP_UUID_HASH_TABLE_IMPL_H
+
+// C++ headers
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+namespace bump {
+
+//====================================================================================
+//                                   UuidHashTable
+//====================================================================================
+
+// Control byte values. Full slots store the top 7 bits of their hash (0 - 127), so
+// empty and deleted slots are the only ones with the sign bit set.
+static const signed char UUID_HASH_TABLE_EMPTY = -128;
+static const signed char UUID_HASH_TABLE_DELETED = -2;
+
+// The number of control bytes compared at once
+static const std::size_t UUID_HASH_TABLE_GROUP_SIZE = 16;
+
+template <class Slot, class KeyOf>
+inline UuidHashTable<Slot, KeyOf>::UuidHashTable() :
+	_controls(NULL),
+	_slots(NULL),
+	_capacity(0),
+	_size(0),
+	_deleted(0)
+{
+	;
+}
+
+template <class Slot, class KeyOf>
+inline UuidHashTable<Slot, KeyOf>::UuidHashTable(const UuidHashTable& table) :
+	_controls(NULL),
+	_slots(NULL),
+	_capacity(0),
+	_size(0),
+	_deleted(0)
+{
+	// Reinserting rather than copying the arrays also drops the source's deleted slots
+	reserve(table._size);
+	for (std::size_t i = 0; i < table._capacity; ++i)
+	{
+		if (table._controls[i] >= 0)
+		{
+			insertUnique(table._slots[i], hashKey(KeyOf::key(table._slots[i])));
+		}
+	}
+}
+
+template <class Slot, class KeyOf>
+inline UuidHashTable<Slot, KeyOf>::~UuidHashTable()
+{
+	destroy();
+}
+
+template <class Slot, class KeyOf>
+inline UuidHashTable<Slot, KeyOf>& UuidHashTable<Slot, KeyOf>::operator=(const UuidHashTable& table)
+{
+	if (this != &table)
+	{
+		UuidHashTable copy(table);
+		std::swap(_controls, copy._controls);
+		std::swap(_slots, copy._slots);
+		std::swap(_capacity, copy._capacity);
+		std::swap(_size, copy._size);
+		std::swap(_deleted, copy._deleted);
+	}
+
+	return *this;
+}
+
+template <class Slot, class KeyOf>
+inline void UuidHashTable<Slot, KeyOf>::clear()
+{
+	for (std::size_t i = 0; i < _capacity; ++i)
+	{
+		if (_controls[i] >= 0)
+		{
+			_slots[i].~Slot();
+		}
+	}
+
+	if (_capacity > 0)
+	{
+		std::memset(_controls, UUID_HASH_TABLE_EMPTY, _capacity);
+	}
+
+	_size = 0;
+	_deleted = 0;
+}
+
+template <class Slot, class KeyOf>
+inline void UuidHashTable<Slot, KeyOf>::reserve(std::size_t count)
+{
+	std::size_t capacity = UUID_HASH_TABLE_GROUP_SIZE;
+	while (capacity / 8 * 7 < count)
+	{
+		capacity *= 2;
+	}
+
+	if (capacity > _capacity)
+	{
+		rehash(capacity);
+	}
+}
+
+template <class Slot, class KeyOf>
+inline std::pair<typename UuidHashTable<Slot, KeyOf>::iterator, bool> UuidHashTable<Slot, KeyOf>::insert(const Slot& slot)
+{
+	const Uuid& key = KeyOf::key(slot);
+	std::size_t index = findIndex(key);
+	if (index != _capacity)
+	{
+		return std::make_pair(iterator(this, index), false);
+	}
+
+	// Keep at least 1/8 of the slots empty so every probe sequence ends. When the table is
+	// mostly deleted slots, rehash at the same capacity to clear them out rather than growing.
+	if ((_size + _deleted + 1) * 8 > _capacity * 7)
+	{
+		if (_capacity == 0)
+		{
+			rehash(UUID_HASH_TABLE_GROUP_SIZE);
+		}
+		else if ((_size + 1) * 16 > _capacity * 7)
+		{
+			rehash(_capacity * 2);
+		}
+		else
+		{
+			rehash(_capacity);
+		}
+	}
+
+	index = insertUnique(slot, hashKey(key));
+	return std::make_pair(iterator(this, index), true);
+}
+
+template <class Slot, class KeyOf>
+inline std::size_t UuidHashTable<Slot, KeyOf>::erase(const Uuid& key)
+{
+	const std::size_t index = findIndex(key);
+	if (index == _capacity)
+	{
+		return 0;
+	}
+
+	eraseIndex(index);
+	return 1;
+}
+
+template <class Slot, class KeyOf>
+inline void UuidHashTable<Slot, KeyOf>::erase(const_iterator position)
+{
+	eraseIndex(position.index());
+}
+
+template <class Slot, class KeyOf>
+inline std::size_t UuidHashTable<Slot, KeyOf>::findIndex(const Uuid& key) const
+{
+	if (_size == 0)
+	{
+		return _capacity;
+	}
+
+	const unsigned long long hash = hashKey(key);
+	const signed char hashBits = static_cast<signed char>(hash >> 57);
+	const std::size_t groupMask = _capacity / UUID_HASH_TABLE_GROUP_SIZE - 1;
+	std::size_t group = static_cast<std::size_t>(hash ^ (hash >> 32)) & groupMask;
+
+	// Triangular probing visits every group once when the group count is a power of two
+	for (std::size_t probe = 1; ; ++probe)
+	{
+		const signed char* controls = _controls + group * UUID_HASH_TABLE_GROUP_SIZE;
+		for (unsigned int matches = matchGroup(controls, hashBits); matches != 0; matches &= matches - 1)
+		{
+			const std::size_t index = group * UUID_HASH_TABLE_GROUP_SIZE + firstBit(matches);
+			if (KeyOf::key(_slots[index]) == key)
+			{
+				return index;
+			}
+		}
+
+		// An empty slot means the key was never pushed past this group
+		if (matchGroup(controls, UUID_HASH_TABLE_EMPTY) != 0)
+		{
+			return _capacity;
+		}
+
+		group = (group + probe) & groupMask;
+	}
+}
+
+template <class Slot, class KeyOf>
+inline std::size_t UuidHashTable<Slot, KeyOf>::nextFull(std::size_t index) const
+{
+	while (index < _capacity && _controls[index] < 0)
+	{
+		++index;
+	}
+
+	return index;
+}
+
+template <class Slot, class KeyOf>
+inline void UuidHashTable<Slot, KeyOf>::eraseIndex(std::size_t index)
+{
+	_slots[index].~Slot();
+	--_size;
+
+	// If the group already has an empty slot, no probe continues past it and the slot can
+	// become empty again. Otherwise later keys may have probed past it, so leave a tombstone.
+	const signed char* controls = _controls + (index & ~(UUID_HASH_TABLE_GROUP_SIZE - 1));
+	if (matchGroup(controls, UUID_HASH_TABLE_EMPTY) != 0)
+	{
+		_controls[index] = UUID_HASH_TABLE_EMPTY;
+	}
+	else
+	{
+		_controls[index] = UUID_HASH_TABLE_DELETED;
+		++_deleted;
+	}
+}
+
+template <class Slot, class KeyOf>
+inline void UuidHashTable<Slot, KeyOf>::rehash(std::size_t capacity)
+{
+	signed char* oldControls = _controls;
+	Slot* oldSlots = _slots;
+	const std::size_t oldCapacity = _capacity;
+
+	_slots = _allocator.allocate(capacity);
+	_controls = new signed char[capacity];
+	std::memset(_controls, UUID_HASH_TABLE_EMPTY, capacity);
+	_capacity = capacity;
+	_size = 0;
+	_deleted = 0;
+
+	for (std::size_t i = 0; i < oldCapacity; ++i)
+	{
+		if (oldControls[i] >= 0)
+		{
+			insertUnique(oldSlots[i], hashKey(KeyOf::key(oldSlots[i])));
+			oldSlots[i].~Slot();
+		}
+	}
+
+	delete [] oldControls;
+	if (oldSlots != NULL)
+	{
+		_allocator.deallocate(oldSlots, oldCapacity);
+	}
+}
+
+template <class Slot, class KeyOf>
+inline std::size_t UuidHashTable<Slot, KeyOf>::insertUnique(const Slot& slot, unsigned long long hash)
+{
+	const std::size_t groupMask = _capacity / UUID_HASH_TABLE_GROUP_SIZE - 1;
+	std::size_t group = static_cast<std::size_t>(hash ^ (hash >> 32)) & groupMask;
+
+	for (std::size_t probe = 1; ; ++probe)
+	{
+		const unsigned int matches = matchFree(_controls + group * UUID_HASH_TABLE_GROUP_SIZE);
+		if (matches != 0)
+		{
+			const std::size_t index = group * UUID_HASH_TABLE_GROUP_SIZE + firstBit(matches);
+			::new (static_cast<void*>(_slots + index)) Slot(slot);
+
+			if (_controls[index] == UUID_HASH_TABLE_DELETED)
+			{
+				--_deleted;
+			}
+			_controls[index] = static_cast<signed char>(hash >> 57);
+			++_size;
+
+			return index;
+		}
+
+		group = (group + probe) & groupMask;
+	}
+}
+
+template <class Slot, class KeyOf>
+inline void UuidHashTable<Slot, KeyOf>::destroy()
+{
+	if (_capacity == 0)
+	{
+		return;
+	}
+
+	clear();
+	delete [] _controls;
+	_allocator.deallocate(_slots, _capacity);
+
+	_controls = NULL;
+	_slots = NULL;
+	_capacity = 0;
+}
+
+template <class Slot, class KeyOf>
+inline unsigned long long UuidHashTable<Slot, KeyOf>::hashKey(const Uuid& key)
+{
+	// The uuid bits are random, but the multiply also spreads a 32 bit size_t across all 64 bits
+	return static_cast<unsigned long long>(hash_value(key)) * 0x9e3779b97f4a7c15ULL;
+}
+
+template <class Slot, class KeyOf>
+inline unsigned int UuidHashTable<Slot, KeyOf>::matchGroup(const signed char* group, signed char value)
+{
+#ifdef BUMP_UUID_HASH_TABLE_SSE2
+	const __m128i controls = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+	return static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(controls, _mm_set1_epi8(value))));
+#else
+	unsigned int matches = 0;
+	for (unsigned int i = 0; i < UUID_HASH_TABLE_GROUP_SIZE; ++i)
+	{
+		matches |= static_cast<unsigned int>(group[i] == value) << i;
+	}
+	return matches;
+#endif
+}
+
+template <class Slot, class KeyOf>
+inline unsigned int UuidHashTable<Slot, KeyOf>::matchFree(const signed char* group)
+{
+#ifdef BUMP_UUID_HASH_TABLE_SSE2
+	// Empty and deleted are the only control bytes with the sign bit set
+	return static_cast<unsigned int>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(group))));
+#else
+	unsigned int matches = 0;
+	for (unsigned int i = 0; i < UUID_HASH_TABLE_GROUP_SIZE; ++i)
+	{
+		matches |= static_cast<unsigned int>(group[i] < 0) << i;
+	}
+	return matches;
+#endif
+}
+
+template <class Slot, class KeyOf>
+inline unsigned int UuidHashTable<Slot, KeyOf>::firstBit(unsigned int mask)
+{
+#if defined(__GNUC__)
+	return static_cast<unsigned int>(__builtin_ctz(mask));
+#elif defined(_MSC_VER)
+	unsigned long index;
+	_BitScanForward(&index, mask);
+	return static_cast<unsigned int>(index);
+#else
+	unsigned int index = 0;
+	while ((mask & 1) == 0)
+	{
+		mask >>= 1;
+		++index;
+	}
+	return index;
+#endif
+}
+
+//====================================================================================
+//                                    UuidHashMap
+//====================================================================================
+
+template <class T>
+inline std::pair<typename UuidHashMap<T>::Table::iterator, bool> UuidHashMap<T>::insert(const Uuid& key, const T& value)
+{
+	return Table::insert(std::pair<const Uuid, T>(key, value));
+}
+
+template <class T>
+inline T& UuidHashMap<T>::operator[](const Uuid& key)
+{
+	typename Table::iterator iter = Table::find(key);
+	if (iter == Table::end())
+	{
+		iter = insert(key, T()).first;
+	}
+
+	return iter->second;
+}
+
+}	// End of bump namespace
+
+#endif	// End of BUMP_UUID_HASH_TABLE_IMPL_H
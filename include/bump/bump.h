@@ -9,26 +9,42 @@
 #ifndef BUMP_BUMP_H
 #define BUMP_BUMP_H
 
+#include <bump/Arena.h>
+#include <bump/Arena_fwd.h>
 #include <bump/AutoTimer.h>
 #include <bump/Environment.h>
+#include <bump/EnvironmentSetting.h>
 #include <bump/Exception.h>
+#include <bump/Executor.h>
+#include <bump/Expected.h>
 #include <bump/Export.h>
+#include <bump/FastHash.h>
 #include <bump/FileInfo.h>
 #include <bump/FileSystem.h>
 #include <bump/FileSystemError.h>
+#include <bump/Hex.h>
 #include <bump/InvalidArgumentError.h>
+#include <bump/LatencyHistogram.h>
 #include <bump/Log.h>
 #include <bump/NotificationCenter.h>
 #include <bump/NotificationCenter_impl.h>
 #include <bump/NotificationError.h>
 #include <bump/NotImplementedError.h>
 #include <bump/OutOfRangeError.h>
+#include <bump/Profiler.h>
+#include <bump/Scheduler.h>
 #include <bump/String.h>
 #include <bump/StringSearchError.h>
+#include <bump/StringTable.h>
 #include <bump/Timeline.h>
+#include <bump/TimelineCurve.h>
+#include <bump/TimelineGroup.h>
 #include <bump/Timer.h>
+#include <bump/Tracer.h>
 #include <bump/TypeCastError.h>
 #include <bump/Uuid.h>
+#include <bump/UuidHashTable.h>
+#include <bump/UuidHashTable_impl.h>
 #include <bump/Version.h>
 
 /**
@@ -44,6 +44,48 @@ namespace sha1
      */
     void toHexString(const unsigned char* hash, char* hexstring);
 
+    /**
+     Holds the running state of an incremental hash. Use init, then update any number of times, then finalize.
+     */
+    struct Context
+    {
+        unsigned int result[5];
+        unsigned char block[64];
+        unsigned long long bytelength;
+    };
+
+    /**
+     @param context is reset to the sha1 initial state.
+     */
+    void init(Context& context);
+
+    /**
+     @param context is the running hash state previously set up with init.
+     @param src points to the next chunk of data to be hashed.
+     @param bytelength the number of bytes to hash from the src pointer.
+     */
+    void update(Context& context, const void* src, const unsigned long long bytelength);
+
+    /**
+     @param context is the running hash state. It must be passed to init again before being reused.
+     @param hash should point to a buffer of at least 20 bytes of size for storing the sha1 result in.
+     */
+    void finalize(Context& context, unsigned char* hash);
+
+    /**
+     Hashes many independent messages at once. Several messages are pushed through the compression function
+     side by side in the lanes of each vector register (multi-buffer hashing), and a lane is refilled with the
+     next message as soon as its current one finishes. Builds that target SSE2 hash four messages at a time.
+     GCC and Clang builds for x86 also compile an AVX2 path that hashes eight at a time, and pick it on each
+     call when __builtin_cpu_supports("avx2") reports that the CPU has AVX2. Without SSE2 the messages are
+     hashed one after another with calc.
+     @param srcs points to count pointers, each to the data of one message.
+     @param bytelengths points to count byte lengths, one per message.
+     @param count the number of messages to hash.
+     @param hashes should point to a buffer of at least 20 * count bytes. Message i's result is stored at hashes + 20 * i.
+     */
+    void calcMultiple(const void* const* srcs, const int* bytelengths, const int count, unsigned char* hashes);
+
 } // namespace sha1
 
 #endif // SHA1_DEFINED
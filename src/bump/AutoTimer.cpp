@@ -6,34 +6,90 @@
 //  Copyright (c) 2012 Christian Noon. All rights reserved.
 //
 
+// C++ headers
+#include <iostream>
+
+// Boost headers
+#include <boost/utility/in_place_factory.hpp>
+
 // Bump headers
 #include <bump/AutoTimer.h>
+#include <bump/LatencyHistogram.h>
+#include <bump/Tracer.h>
 
 namespace bump {
 
 AutoTimer::AutoTimer(const OutputType& outputType) :
-	_outputType(outputType)
+	_outputType(outputType),
+	_histogram(NULL),
+	_traceCategory(NULL),
+	_traceName(NULL),
+	_timer(boost::in_place())
+{
+	;
+}
+
+AutoTimer::AutoTimer(LatencyHistogram& histogram) :
+	_outputType(NANOSECONDS),
+	_histogram(&histogram),
+	_traceCategory(NULL),
+	_traceName(NULL),
+	_timer(boost::in_place(Timer::TIME_STAMP_COUNTER))
 {
-	_timer.start();
+	;
+}
+
+AutoTimer::AutoTimer(const String& histogramName) :
+	_outputType(NANOSECONDS),
+	_histogram(LatencyHistogram::named(histogramName)),
+	_traceCategory(NULL),
+	_traceName(NULL),
+	_timer(boost::in_place(Timer::TIME_STAMP_COUNTER))
+{
+	;
+}
+
+AutoTimer::AutoTimer(const char* traceCategory, const char* traceName) :
+	_outputType(NANOSECONDS),
+	_histogram(NULL),
+	_traceCategory(traceCategory),
+	_traceName(Tracer::sampleScope() ? traceName : NULL),
+	_timer()
+{
+	if (_traceName != NULL)
+	{
+		Tracer::beginEvent(_traceCategory, _traceName);
+	}
 }
 
 AutoTimer::~AutoTimer()
 {
-	if (_outputType == SECONDS)
+	if (_traceCategory != NULL)
+	{
+		if (_traceName != NULL)
+		{
+			Tracer::endEvent(_traceCategory, _traceName);
+		}
+	}
+	else if (_histogram != NULL)
+	{
+		_histogram->record(_timer->elapsedNanoseconds());
+	}
+	else if (_outputType == SECONDS)
 	{
-		std::cout << "Elapsed Time: " << _timer.secondsElapsed() << " secs" << std::endl;
+		std::cout << "Elapsed Time: " << _timer->secondsElapsed() << " secs" << std::endl;
 	}
 	else if (_outputType == MILLISECONDS)
 	{
-		std::cout << "Elapsed Time: " << _timer.millisecondsElapsed() << " msecs" << std::endl;
+		std::cout << "Elapsed Time: " << _timer->millisecondsElapsed() << " msecs" << std::endl;
 	}
 	else if (_outputType == MICROSECONDS)
 	{
-		std::cout << "Elapsed Time: " << _timer.microsecondsElapsed() << " usecs" << std::endl;
+		std::cout << "Elapsed Time: " << _timer->microsecondsElapsed() << " usecs" << std::endl;
 	}
 	else // _outputType == NANOSECONDS
 	{
-		std::cout << "Elapsed Time: " << _timer.nanosecondsElapsed() << " nsecs" << std::endl;
+		std::cout << "Elapsed Time: " << _timer->nanosecondsElapsed() << " nsecs" << std::endl;
 	}
 }
 
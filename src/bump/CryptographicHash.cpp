@@ -6,14 +6,167 @@
 //  Copyright (c) 2013 Christian Noon. All rights reserved.
 //
 
+// C++ headers
+#include <fstream>
+
+// Boost headers
+#include <boost/bind.hpp>
+#include <boost/scoped_array.hpp>
+#include <boost/thread.hpp>
+
 // Bump headers
 #include <bump/CryptographicHash.h>
+#include <bump/Executor.h>
+#include <bump/FileInfo.h>
+#include <bump/FileSystemError.h>
+#include <bump/Hex.h>
 
 // Smallsha1 headers
 #include <smallsha1/sha1.h>
 
 namespace bump {
 
+// Files at or above this size are memory mapped instead of read
+static const unsigned long long gMemoryMapThreshold = 4 * 1024 * 1024;
+
+// The size of each read buffer used when streaming a file
+static const unsigned int gReadChunkSize = 1024 * 1024;
+
+namespace {
+
+/**
+ * @internal
+ * Reads a file into two alternating buffers on a background thread. While the caller hashes
+ * one buffer, the reader thread fills the other one.
+ */
+class DoubleBufferedReader
+{
+public:
+
+	DoubleBufferedReader(std::ifstream& stream) :
+		_stream(stream),
+		_failed(false),
+		_stopped(false),
+		_thread()
+	{
+		for (unsigned int i = 0; i < 2; ++i)
+		{
+			_buffers[i].reset(new char[gReadChunkSize]);
+			_lengths[i] = 0;
+			_isFull[i] = false;
+		}
+		_done[0] = _done[1] = false;
+		_thread = boost::thread(&DoubleBufferedReader::run, this);
+	}
+
+	~DoubleBufferedReader()
+	{
+		{
+			boost::mutex::scoped_lock lock(_mutex);
+			_stopped = true;
+		}
+		_condition.notify_all();
+		_thread.join();
+	}
+
+	/** Waits for the next buffer, returning false once the end of the file has been reached. */
+	bool next(unsigned int index, const char*& data, std::streamsize& length)
+	{
+		boost::mutex::scoped_lock lock(_mutex);
+		while (!_isFull[index])
+		{
+			_condition.wait(lock);
+		}
+
+		if (_failed)
+		{
+			throw FileSystemError("Could not read the file contents", BUMP_LOCATION);
+		}
+
+		data = _buffers[index].get();
+		length = _lengths[index];
+		return !_done[index];
+	}
+
+	/** Hands the buffer back to the reader thread once it has been hashed. */
+	void release(unsigned int index)
+	{
+		{
+			boost::mutex::scoped_lock lock(_mutex);
+			_isFull[index] = false;
+		}
+		_condition.notify_all();
+	}
+
+protected:
+
+	void run()
+	{
+		for (unsigned int index = 0; ; index = 1 - index)
+		{
+			// Wait for the buffer to be handed back
+			{
+				boost::mutex::scoped_lock lock(_mutex);
+				while (_isFull[index] && !_stopped)
+				{
+					_condition.wait(lock);
+				}
+
+				if (_stopped)
+				{
+					return;
+				}
+			}
+
+			// Fill the buffer outside the lock so hashing can continue on the other one
+			_stream.read(_buffers[index].get(), gReadChunkSize);
+			std::streamsize length = _stream.gcount();
+			bool failed = _stream.bad();
+			bool done = failed || length == 0;
+
+			{
+				boost::mutex::scoped_lock lock(_mutex);
+				_lengths[index] = length;
+				_done[index] = done;
+				_failed = failed;
+				_isFull[index] = true;
+			}
+			_condition.notify_all();
+
+			if (done)
+			{
+				return;
+			}
+		}
+	}
+
+	std::ifstream&				_stream;
+	boost::scoped_array<char>	_buffers[2];
+	std::streamsize				_lengths[2];
+	bool						_isFull[2];
+	bool						_done[2];
+	bool						_failed;
+	bool						_stopped;
+	boost::mutex				_mutex;
+	boost::condition_variable	_condition;
+	boost::thread				_thread;
+};
+
+/** Hashes one of the files, leaving its hash empty if it could not be read. */
+void hashFileAtIndex(const StringList* paths, StringList* hashes, const CryptographicHash::Algorithm* algorithm, std::size_t index)
+{
+	try
+	{
+		(*hashes)[index] = CryptographicHash::hashFile(paths->at(index), *algorithm);
+	}
+	catch (const FileSystemError& /*e*/)
+	{
+		// Leave the hash empty for files we could not read
+	}
+}
+
+}	// End of anonymous namespace
+
 CryptographicHash::CryptographicHash(const Algorithm& algorithm) :
 	_algorithm(algorithm),
 	_data(NULL),
@@ -55,12 +208,106 @@ String CryptographicHash::result()
 
 	// Compute the hash using the sha1 algorithm
 	unsigned char hash[20];
-	char hexstring[41];
-	hexstring[40] = 0;
 	sha1::calc(_data, _length, hash);
-	sha1::toHexString(hash, hexstring);
 
-	return String(hexstring);
+	return Hex::encode(hash, 20);
+}
+
+Sha1Digest CryptographicHash::resultBytes()
+{
+	Sha1Digest digest;
+	digest.fill(0);
+
+	// Make sure the data has been set
+	if (_data == NULL || _length == 0)
+	{
+		return digest;
+	}
+
+	// Compute the hash using the sha1 algorithm
+	sha1::calc(_data, _length, digest.data());
+
+	return digest;
+}
+
+String CryptographicHash::hashFile(const String& path, const Algorithm& /*algorithm*/)
+{
+	// Throws a FileSystemError if the path is not a valid file
+	unsigned long long file_size = FileInfo(path).fileSize();
+
+	// Map large files straight into memory and stream everything else
+	unsigned char hash[20];
+	bool mapped = false;
+	if (file_size >= gMemoryMapThreshold)
+	{
+		mapped = hashMappedFile(path, file_size, hash);
+	}
+	if (!mapped)
+	{
+		hashStreamedFile(path, file_size, hash);
+	}
+
+	return Hex::encode(hash, 20);
+}
+
+StringList CryptographicHash::hashFiles(const StringList& paths, const Algorithm& algorithm)
+{
+	StringList hashes(paths.size());
+	if (paths.empty())
+	{
+		return hashes;
+	}
+
+	// Spread the files across the shared executor's workers, with the calling thread helping out
+	Executor::instance()->parallelFor(0, paths.size(), boost::bind(&hashFileAtIndex, &paths, &hashes, &algorithm, _1));
+
+	return hashes;
+}
+
+void CryptographicHash::hashMessages(const char* const* messages, const int* lengths, unsigned int count,
+									 unsigned char* digests, const Algorithm& /*algorithm*/)
+{
+	sha1::calcMultiple(reinterpret_cast<const void* const*>(messages), lengths, count, digests);
+}
+
+void CryptographicHash::hashStreamedFile(const String& path, unsigned long long fileSize, unsigned char* hash)
+{
+	std::ifstream stream(path.c_str(), std::ios::in | std::ios::binary);
+	if (!stream.is_open())
+	{
+		throw FileSystemError(String("Could not open file: ") + path, BUMP_LOCATION);
+	}
+
+	sha1::Context context;
+	sha1::init(context);
+
+	// Small files fit in a single read so there is nothing to overlap
+	if (fileSize <= gReadChunkSize)
+	{
+		boost::scoped_array<char> buffer(new char[gReadChunkSize]);
+		while (stream)
+		{
+			stream.read(buffer.get(), gReadChunkSize);
+			if (stream.bad())
+			{
+				throw FileSystemError(String("Could not read file: ") + path, BUMP_LOCATION);
+			}
+			sha1::update(context, buffer.get(), stream.gcount());
+		}
+	}
+	else
+	{
+		DoubleBufferedReader reader(stream);
+		const char* data = NULL;
+		std::streamsize length = 0;
+		for (unsigned int index = 0; reader.next(index, data, length); index = 1 - index)
+		{
+			sha1::update(context, data, length);
+			reader.release(index);
+		}
+	}
+
+	sha1::finalize(context, hash);
 }
 
 }	// End of bump namespace
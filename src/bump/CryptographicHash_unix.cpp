@@ -0,0 +1,55 @@
+//
+//  CryptographicHash_unix.cpp
+//  Bump
+//
+//  Created by Christian Noon on 10/17/26.
+//  Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+// Bump headers
+#include <bump/CryptographicHash.h>
+
+// Smallsha1 headers
+#include <smallsha1/sha1.h>
+
+// Unix headers
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace bump {
+
+bool CryptographicHash::hashMappedFile(const String& path, unsigned long long fileSize, unsigned char* hash)
+{
+	// Make sure the whole file fits into the address space
+	if (fileSize == 0 || fileSize > (unsigned long long)(size_t)-1)
+	{
+		return false;
+	}
+
+	int file = open(path.c_str(), O_RDONLY);
+	if (file == -1)
+	{
+		return false;
+	}
+
+	void* data = mmap(NULL, (size_t)fileSize, PROT_READ, MAP_PRIVATE, file, 0);
+	close(file);
+	if (data == MAP_FAILED)
+	{
+		return false;
+	}
+
+	// Let the kernel read ahead aggressively since we touch every page exactly once
+	madvise(data, (size_t)fileSize, MADV_SEQUENTIAL);
+
+	sha1::Context context;
+	sha1::init(context);
+	sha1::update(context, data, fileSize);
+	sha1::finalize(context, hash);
+
+	munmap(data, (size_t)fileSize);
+	return true;
+}
+
+}	// End of bump namespace
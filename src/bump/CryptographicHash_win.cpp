@@ -0,0 +1,58 @@
+//
+//  CryptographicHash_win.cpp
+//  Bump
+//
+//  Created by Christian Noon on 10/17/26.
+//  Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+// Bump headers
+#include <bump/CryptographicHash.h>
+
+// Smallsha1 headers
+#include <smallsha1/sha1.h>
+
+// Windows headers
+#include <windows.h>
+
+namespace bump {
+
+bool CryptographicHash::hashMappedFile(const String& path, unsigned long long fileSize, unsigned char* hash)
+{
+	// Make sure the whole file fits into the address space
+	if (fileSize == 0 || fileSize > (unsigned long long)(SIZE_T)-1)
+	{
+		return false;
+	}
+
+	HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+							  FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+	if (file == INVALID_HANDLE_VALUE)
+	{
+		return false;
+	}
+
+	HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	CloseHandle(file);
+	if (mapping == NULL)
+	{
+		return false;
+	}
+
+	const void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(mapping);
+	if (data == NULL)
+	{
+		return false;
+	}
+
+	sha1::Context context;
+	sha1::init(context);
+	sha1::update(context, data, fileSize);
+	sha1::finalize(context, hash);
+
+	UnmapViewOfFile(data);
+	return true;
+}
+
+}	// End of bump namespace
@@ -6,18 +6,259 @@
 //	Copyright (c) 2012 Christian Noon. All rights reserved.
 //
 
+// C++ headers
+#include <set>
+#include <string>
+#include <vector>
+
+// Boost headers
+#include <boost/algorithm/string/case_conv.hpp>
+#include <boost/algorithm/string/predicate.hpp>
+#include <boost/atomic.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/unordered_map.hpp>
+
 // Bump headers
 #include <bump/Environment.h>
+#include <bump/FastHash.h>
 #include <bump/String.h>
 
 namespace bump {
 
 namespace Environment {
 
+// Implemented in Environment_unix.cpp and Environment_win.cpp
+std::vector<std::string> systemEnvironment();
+bool setSystemEnvironmentVariable(const String& name, const String& value);
+bool unsetSystemEnvironmentVariable(const String& name);
+
+}	// End of Environment namespace
+
+namespace {
+
+/**
+ * Hashes names stored as strings and looked up as views the same way. Windows matches names
+ * ignoring case, so they are hashed as upper case there.
+ */
+struct NameHash
+{
+	std::size_t operator()(boost::string_ref name) const
+	{
+#ifdef _WIN32
+		std::string folded(name.begin(), name.end());
+		boost::algorithm::to_upper(folded);
+		return static_cast<std::size_t>(FastHash::hash64(folded.data(), folded.size()));
+#else
+		return static_cast<std::size_t>(FastHash::hash64(name.data(), name.size()));
+#endif
+	}
+};
+
+/** Compares names stored as strings with names looked up as views, ignoring case on Windows. */
+struct NameEqual
+{
+	bool operator()(boost::string_ref lhs, boost::string_ref rhs) const
+	{
+#ifdef _WIN32
+		return boost::algorithm::iequals(lhs, rhs);
+#else
+		return lhs == rhs;
+#endif
+	}
+};
+
+// The values point into the cache's pool of interned values, so copying a snapshot never copies them
+typedef boost::unordered_map<std::string, const std::string*, NameHash, NameEqual> VariableMap;
+
+/** An immutable copy of the environment, which is never modified once it is published. */
+struct Snapshot
+{
+	VariableMap			variables;		/**< The values of the variables, keyed by name. */
+};
+
+/**
+ * Holds the published snapshot and the pool of every value ever seen, and is never destroyed.
+ *
+ * Views point into the pool rather than the snapshots, so a retired snapshot only has to live
+ * until the lookups that loaded it have finished. Lookups count themselves in and out, and a
+ * snapshot is freed by the first publish that sees no lookup in flight.
+ */
+struct Cache
+{
+	Cache() : snapshot(NULL), generation(0), readers(0)
+	{
+		Snapshot* initial = new Snapshot();
+		parse(initial->variables);
+		snapshot.store(initial, boost::memory_order_seq_cst);
+	}
+
+	/** Parses the process environment into the given variables. Must be called with the mutex held. */
+	void parse(VariableMap& variables)
+	{
+		const std::vector<std::string> entries = Environment::systemEnvironment();
+		for (unsigned int i = 0; i < entries.size(); ++i)
+		{
+			// Windows names hidden variables with a leading '=', so the separator is never first
+			const std::string::size_type separator = entries[i].find('=', 1);
+			if (separator != std::string::npos)
+			{
+				variables[entries[i].substr(0, separator)] = intern(entries[i].substr(separator + 1));
+			}
+		}
+	}
+
+	/** Returns the pooled copy of the value, which is never freed. Must be called with the mutex held. */
+	const std::string* intern(const std::string& value)
+	{
+		return &*values.insert(value).first;
+	}
+
+	/** Publishes the next snapshot. Must be called with the mutex held. */
+	void publish(Snapshot* next)
+	{
+		retired.push_back(snapshot.load(boost::memory_order_relaxed));
+		snapshot.store(next, boost::memory_order_seq_cst);
+		generation.fetch_add(1, boost::memory_order_release);
+
+		// A lookup that counts itself in after this load can only find the new snapshot, which pairs
+		// with lookups counting themselves in before loading the snapshot
+		if (readers.load(boost::memory_order_seq_cst) == 0)
+		{
+			for (std::size_t i = 0; i < retired.size(); ++i)
+			{
+				delete retired[i];
+			}
+			retired.clear();
+		}
+	}
+
+	boost::atomic<const Snapshot*>			snapshot;
+	boost::atomic<unsigned long long>		generation;
+	boost::atomic<unsigned int>				readers;
+	std::vector<const Snapshot*>			retired;
+	std::set<std::string>					values;
+	boost::mutex							mutex;
+};
+
+/**
+ * Returns the cache, which is leaked on purpose so the views it hands out stay valid for the life
+ * of the process, including in static destructors that run after it would have been destroyed.
+ */
+Cache& cache()
+{
+	static Cache* cache = new Cache();
+	return *cache;
+}
+
+/** Keeps the snapshot a lookup loaded alive until the lookup finishes. */
+class SnapshotReader
+{
+public:
+
+	SnapshotReader() : _cache(cache())
+	{
+		_cache.readers.fetch_add(1, boost::memory_order_seq_cst);
+		_snapshot = _cache.snapshot.load(boost::memory_order_seq_cst);
+	}
+
+	~SnapshotReader()
+	{
+		_cache.readers.fetch_sub(1, boost::memory_order_release);
+	}
+
+	const Snapshot& snapshot() const
+	{
+		return *_snapshot;
+	}
+
+private:
+
+	Cache& _cache;
+	const Snapshot* _snapshot;
+};
+
+}	// End of anonymous namespace
+
+namespace Environment {
+
 String environmentVariable(const String& name)
 {
-	char* value = getenv(name.c_str());
-	return value == NULL ? String("") : String(value);
+	const boost::string_ref value = environmentVariableView(name);
+	return String(std::string(value.data(), value.size()));
+}
+
+boost::string_ref environmentVariableView(boost::string_ref name)
+{
+	const SnapshotReader reader;
+	const VariableMap& variables = reader.snapshot().variables;
+	VariableMap::const_iterator iter = variables.find(name, NameHash(), NameEqual());
+	if (iter == variables.end())
+	{
+		return boost::string_ref();
+	}
+
+	return boost::string_ref(*iter->second);
+}
+
+bool setEnvironmentVariable(const String& name, const String& value, bool overwrite)
+{
+	Cache& environment = cache();
+	boost::mutex::scoped_lock lock(environment.mutex);
+
+	// Leaving an existing variable alone is not a failure
+	const Snapshot* snapshot = environment.snapshot.load(boost::memory_order_relaxed);
+	VariableMap::const_iterator iter = snapshot->variables.find(name);
+	if (iter != snapshot->variables.end() && (!overwrite || *iter->second == value))
+	{
+		return true;
+	}
+
+	if (!setSystemEnvironmentVariable(name, value))
+	{
+		return false;
+	}
+
+	Snapshot* next = new Snapshot(*snapshot);
+	next->variables[name] = environment.intern(value);
+	environment.publish(next);
+
+	return true;
+}
+
+bool unsetEnvironmentVariable(const String& name)
+{
+	Cache& environment = cache();
+	boost::mutex::scoped_lock lock(environment.mutex);
+
+	if (!unsetSystemEnvironmentVariable(name))
+	{
+		return false;
+	}
+
+	const Snapshot* snapshot = environment.snapshot.load(boost::memory_order_relaxed);
+	if (snapshot->variables.find(name) != snapshot->variables.end())
+	{
+		Snapshot* next = new Snapshot(*snapshot);
+		next->variables.erase(name);
+		environment.publish(next);
+	}
+
+	return true;
+}
+
+unsigned long long environmentGeneration()
+{
+	return cache().generation.load(boost::memory_order_acquire);
+}
+
+void reloadEnvironment()
+{
+	Cache& environment = cache();
+	boost::mutex::scoped_lock lock(environment.mutex);
+
+	Snapshot* next = new Snapshot();
+	environment.parse(next->variables);
+	environment.publish(next);
 }
 
 }	// End of Environment namespace
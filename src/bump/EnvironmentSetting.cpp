@@ -0,0 +1,518 @@
+//
+//	EnvironmentSetting.cpp
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+// C++ headers
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+// Boost headers
+#include <boost/algorithm/string/predicate.hpp>
+#include <boost/thread/mutex.hpp>
+
+// Bump headers
+#include <bump/Environment.h>
+#include <bump/EnvironmentSetting.h>
+
+namespace bump {
+
+namespace {
+
+/** Holds every setting that currently exists. */
+struct Registry
+{
+	boost::mutex						mutex;
+	std::vector<EnvironmentSetting*>	settings;
+};
+
+Registry& registry()
+{
+	static Registry registry;
+	return registry;
+}
+
+/** Orders settings by the name of their environment variable. */
+bool compareNames(const EnvironmentSetting* lhs, const EnvironmentSetting* rhs)
+{
+	return lhs->name() < rhs->name();
+}
+
+/** A unit of a duration or size, and how many nanoseconds or bytes it holds. */
+struct Unit
+{
+	const char*			name;
+	unsigned long long	scale;
+};
+
+const Unit gDurationUnits[] =
+{
+	{ "h", 3600000000000ULL },
+	{ "m", 60000000000ULL },
+	{ "s", 1000000000ULL },
+	{ "ms", 1000000ULL },
+	{ "us", 1000ULL },
+	{ "ns", 1ULL }
+};
+
+const Unit gSizeUnits[] =
+{
+	{ "T", 1099511627776ULL },
+	{ "G", 1073741824ULL },
+	{ "M", 1048576ULL },
+	{ "K", 1024ULL },
+	{ "B", 1ULL }
+};
+
+/**
+ * Parses a non-negative number followed by an optional unit, where each unit may also be written
+ * with the given suffix, such as "KB" or "KiB". Returns false if the number or the unit is invalid
+ * or the result does not fit.
+ */
+bool parseQuantity(boost::string_ref text, const Unit* units, std::size_t unitCount, const char* unitSuffix,
+	unsigned long long defaultScale, unsigned long long& result)
+{
+	// Split the number from the unit
+	std::size_t split = text.find_first_not_of("0123456789.");
+	split = split == boost::string_ref::npos ? text.size() : split;
+	const Expected<double> number = String(std::string(text.data(), split)).tryToDouble();
+	if (!number.hasValue())
+	{
+		return false;
+	}
+
+	// Units are matched whole, since "m" and "ms" share a prefix
+	unsigned long long scale = defaultScale;
+	const boost::string_ref unit = text.substr(split);
+	if (!unit.empty())
+	{
+		scale = 0;
+		for (std::size_t i = 0; i < unitCount && scale == 0; ++i)
+		{
+			const String name(units[i].name);
+			if (boost::algorithm::iequals(unit, name) || (unitSuffix != NULL && units[i].scale > 1 &&
+				(boost::algorithm::iequals(unit, name + unitSuffix) || boost::algorithm::iequals(unit, name + "i" + unitSuffix))))
+			{
+				scale = units[i].scale;
+			}
+		}
+	}
+
+	const double scaled = number.value() * static_cast<double>(scale);
+	if (scale == 0 || scaled >= 18446744073709551615.0)
+	{
+		return false;
+	}
+
+	result = static_cast<unsigned long long>(scaled + 0.5);
+	return true;
+}
+
+/** Formats a quantity in the largest unit that divides it evenly. */
+String formatQuantity(unsigned long long value, const Unit* units, std::size_t unitCount)
+{
+	for (std::size_t i = 0; i < unitCount; ++i)
+	{
+		if (value % units[i].scale == 0 && (value != 0 || units[i].scale == 1))
+		{
+			String text(value / units[i].scale);
+			text += units[i].name;
+			return text;
+		}
+	}
+
+	return String(value);
+}
+
+}	// End of anonymous namespace
+
+//====================================================================================
+//                               EnvironmentSetting
+//====================================================================================
+
+EnvironmentSetting::EnvironmentSetting(const String& name, const String& description, Type type) :
+	_name(name),
+	_description(description),
+	_type(type),
+	_isSet(false)
+{
+	;
+}
+
+EnvironmentSetting::~EnvironmentSetting()
+{
+	unregisterSetting();
+}
+
+bool EnvironmentSetting::reload()
+{
+	const boost::string_ref text = Environment::environmentVariableView(_name);
+	if (text.empty())
+	{
+		reset();
+		_isSet.store(false, boost::memory_order_relaxed);
+		return true;
+	}
+
+	if (!parse(text))
+	{
+		std::cout << "[bump] WARNING: Your " << _name << " environment variable: [" << text
+			<< "] does not match any of the possible options: [ " << acceptedValues() << " ]" << std::endl;
+		reset();
+		_isSet.store(false, boost::memory_order_relaxed);
+		return false;
+	}
+
+	_isSet.store(true, boost::memory_order_relaxed);
+	return true;
+}
+
+bool EnvironmentSetting::reloadAll()
+{
+	Registry& settings = registry();
+	boost::mutex::scoped_lock lock(settings.mutex);
+
+	bool isValid = true;
+	for (unsigned int i = 0; i < settings.settings.size(); ++i)
+	{
+		isValid = settings.settings[i]->reload() && isValid;
+	}
+
+	return isValid;
+}
+
+void EnvironmentSetting::registerSetting()
+{
+	Registry& settings = registry();
+	boost::mutex::scoped_lock lock(settings.mutex);
+	settings.settings.push_back(this);
+}
+
+void EnvironmentSetting::unregisterSetting()
+{
+	Registry& settings = registry();
+	boost::mutex::scoped_lock lock(settings.mutex);
+	settings.settings.erase(std::remove(settings.settings.begin(), settings.settings.end(), this), settings.settings.end());
+}
+
+String EnvironmentSetting::dump()
+{
+	Registry& settings = registry();
+	boost::mutex::scoped_lock lock(settings.mutex);
+
+	std::vector<EnvironmentSetting*> sorted = settings.settings;
+	std::sort(sorted.begin(), sorted.end(), compareNames);
+
+	String output;
+	for (unsigned int i = 0; i < sorted.size(); ++i)
+	{
+		output += sorted[i]->name();
+		output += "=";
+		output += sorted[i]->toString();
+		output += sorted[i]->isSet() ? " (environment) - " : " (default) - ";
+		output += sorted[i]->description();
+		output += "\n";
+	}
+
+	return output;
+}
+
+//====================================================================================
+//                                  BoolSetting
+//====================================================================================
+
+BoolSetting::BoolSetting(const String& name, bool defaultValue, const String& description) :
+	EnvironmentSetting(name, description, BOOL_SETTING),
+	_defaultValue(defaultValue),
+	_value(defaultValue)
+{
+	reload();
+	registerSetting();
+}
+
+BoolSetting::~BoolSetting()
+{
+	unregisterSetting();
+}
+
+String BoolSetting::toString() const
+{
+	return value() ? "true" : "false";
+}
+
+String BoolSetting::defaultString() const
+{
+	return _defaultValue ? "true" : "false";
+}
+
+bool BoolSetting::parse(boost::string_ref text)
+{
+	static const char* trueValues[] = { "yes", "true", "on", "enable", "1" };
+	static const char* falseValues[] = { "no", "false", "off", "disable", "nope", "0" };
+
+	for (unsigned int i = 0; i < sizeof(trueValues) / sizeof(trueValues[0]); ++i)
+	{
+		if (boost::algorithm::iequals(text, trueValues[i]))
+		{
+			_value.store(true, boost::memory_order_relaxed);
+			return true;
+		}
+	}
+
+	for (unsigned int i = 0; i < sizeof(falseValues) / sizeof(falseValues[0]); ++i)
+	{
+		if (boost::algorithm::iequals(text, falseValues[i]))
+		{
+			_value.store(false, boost::memory_order_relaxed);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void BoolSetting::reset()
+{
+	_value.store(_defaultValue, boost::memory_order_relaxed);
+}
+
+String BoolSetting::acceptedValues() const
+{
+	return "YES | TRUE | ON | ENABLE | 1 | NO | FALSE | OFF | DISABLE | NOPE | 0";
+}
+
+//====================================================================================
+//                                   IntSetting
+//====================================================================================
+
+IntSetting::IntSetting(const String& name, long long defaultValue, const String& description, long long minimum, long long maximum) :
+	EnvironmentSetting(name, description, INT_SETTING),
+	_defaultValue(defaultValue),
+	_minimum(minimum),
+	_maximum(maximum),
+	_value(defaultValue)
+{
+	reload();
+	registerSetting();
+}
+
+IntSetting::~IntSetting()
+{
+	unregisterSetting();
+}
+
+String IntSetting::toString() const
+{
+	return String(value());
+}
+
+String IntSetting::defaultString() const
+{
+	return String(_defaultValue);
+}
+
+bool IntSetting::parse(boost::string_ref text)
+{
+	const Expected<long long> number = String(std::string(text.data(), text.size())).tryToLongLong();
+	if (!number.hasValue() || number.value() < _minimum || number.value() > _maximum)
+	{
+		return false;
+	}
+
+	_value.store(number.value(), boost::memory_order_relaxed);
+	return true;
+}
+
+void IntSetting::reset()
+{
+	_value.store(_defaultValue, boost::memory_order_relaxed);
+}
+
+String IntSetting::acceptedValues() const
+{
+	String values("integers from ");
+	values += String(_minimum);
+	values += " to ";
+	values += String(_maximum);
+	return values;
+}
+
+//====================================================================================
+//                                   EnumSetting
+//====================================================================================
+
+EnumSetting::EnumSetting(const String& name, const Choice* choices, std::size_t choiceCount, int defaultValue, const String& description) :
+	EnvironmentSetting(name, description, ENUM_SETTING),
+	_choices(choices),
+	_choiceCount(choiceCount),
+	_defaultValue(defaultValue),
+	_value(defaultValue)
+{
+	reload();
+	registerSetting();
+}
+
+EnumSetting::~EnumSetting()
+{
+	unregisterSetting();
+}
+
+String EnumSetting::toString() const
+{
+	return nameOf(value());
+}
+
+String EnumSetting::defaultString() const
+{
+	return nameOf(_defaultValue);
+}
+
+bool EnumSetting::parse(boost::string_ref text)
+{
+	for (std::size_t i = 0; i < _choiceCount; ++i)
+	{
+		if (boost::algorithm::iequals(text, _choices[i].name))
+		{
+			_value.store(_choices[i].value, boost::memory_order_relaxed);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void EnumSetting::reset()
+{
+	_value.store(_defaultValue, boost::memory_order_relaxed);
+}
+
+String EnumSetting::acceptedValues() const
+{
+	String values;
+	for (std::size_t i = 0; i < _choiceCount; ++i)
+	{
+		values += i == 0 ? "" : " | ";
+		values += _choices[i].name;
+	}
+
+	return values;
+}
+
+String EnumSetting::nameOf(int value) const
+{
+	for (std::size_t i = 0; i < _choiceCount; ++i)
+	{
+		if (_choices[i].value == value)
+		{
+			return _choices[i].name;
+		}
+	}
+
+	return String(value);
+}
+
+//====================================================================================
+//                                 DurationSetting
+//====================================================================================
+
+DurationSetting::DurationSetting(const String& name, unsigned long long defaultNanoseconds, const String& description) :
+	EnvironmentSetting(name, description, DURATION_SETTING),
+	_defaultNanoseconds(defaultNanoseconds),
+	_nanoseconds(defaultNanoseconds)
+{
+	reload();
+	registerSetting();
+}
+
+DurationSetting::~DurationSetting()
+{
+	unregisterSetting();
+}
+
+String DurationSetting::toString() const
+{
+	return formatQuantity(nanoseconds(), gDurationUnits, sizeof(gDurationUnits) / sizeof(gDurationUnits[0]));
+}
+
+String DurationSetting::defaultString() const
+{
+	return formatQuantity(_defaultNanoseconds, gDurationUnits, sizeof(gDurationUnits) / sizeof(gDurationUnits[0]));
+}
+
+bool DurationSetting::parse(boost::string_ref text)
+{
+	unsigned long long nanoseconds = 0;
+	if (!parseQuantity(text, gDurationUnits, sizeof(gDurationUnits) / sizeof(gDurationUnits[0]), NULL, 1000000000ULL, nanoseconds))
+	{
+		return false;
+	}
+
+	_nanoseconds.store(nanoseconds, boost::memory_order_relaxed);
+	return true;
+}
+
+void DurationSetting::reset()
+{
+	_nanoseconds.store(_defaultNanoseconds, boost::memory_order_relaxed);
+}
+
+String DurationSetting::acceptedValues() const
+{
+	return "numbers of ns | us | ms | s | m | h";
+}
+
+//====================================================================================
+//                                   SizeSetting
+//====================================================================================
+
+SizeSetting::SizeSetting(const String& name, unsigned long long defaultBytes, const String& description) :
+	EnvironmentSetting(name, description, SIZE_SETTING),
+	_defaultBytes(defaultBytes),
+	_bytes(defaultBytes)
+{
+	reload();
+	registerSetting();
+}
+
+SizeSetting::~SizeSetting()
+{
+	unregisterSetting();
+}
+
+String SizeSetting::toString() const
+{
+	return formatQuantity(bytes(), gSizeUnits, sizeof(gSizeUnits) / sizeof(gSizeUnits[0]));
+}
+
+String SizeSetting::defaultString() const
+{
+	return formatQuantity(_defaultBytes, gSizeUnits, sizeof(gSizeUnits) / sizeof(gSizeUnits[0]));
+}
+
+bool SizeSetting::parse(boost::string_ref text)
+{
+	unsigned long long bytes = 0;
+	if (!parseQuantity(text, gSizeUnits, sizeof(gSizeUnits) / sizeof(gSizeUnits[0]), "B", 1, bytes))
+	{
+		return false;
+	}
+
+	_bytes.store(bytes, boost::memory_order_relaxed);
+	return true;
+}
+
+void SizeSetting::reset()
+{
+	_bytes.store(_defaultBytes, boost::memory_order_relaxed);
+}
+
+String SizeSetting::acceptedValues() const
+{
+	return "numbers of B | K | M | G | T";
+}
+
+}	// End of bump namespace
@@ -6,21 +6,40 @@
 //	Copyright (c) 2012 Christian Noon. All rights reserved.
 //
 
+// C++ headers
+#include <cstdlib>
+#include <string>
+#include <vector>
+
 // Bump headers
 #include <bump/Environment.h>
 #include <bump/String.h>
 
+// The process environment as "NAME=VALUE" entries
+extern char** environ;
+
 namespace bump {
 
 namespace Environment {
 
-bool setEnvironmentVariable(const String& name, const String& value, bool overwrite)
+std::vector<std::string> systemEnvironment()
+{
+	std::vector<std::string> entries;
+	for (char** entry = environ; entry != NULL && *entry != NULL; ++entry)
+	{
+		entries.push_back(*entry);
+	}
+
+	return entries;
+}
+
+bool setSystemEnvironmentVariable(const String& name, const String& value)
 {
-	int result = setenv(name.c_str(), value.c_str(), overwrite);
+	int result = setenv(name.c_str(), value.c_str(), 1);
 	return result == 0;
 }
 
-bool unsetEnvironmentVariable(const String& name)
+bool unsetSystemEnvironmentVariable(const String& name)
 {
 	int result = unsetenv(name.c_str());
 	return result == 0;
@@ -6,6 +6,11 @@
 //	Copyright (c) 2012 Christian Noon. All rights reserved.
 //
 
+// C++ headers
+#include <cstdlib>
+#include <string>
+#include <vector>
+
 // Bump headers
 #include <bump/Environment.h>
 #include <bump/String.h>
@@ -18,19 +23,24 @@ namespace bump {
 
 namespace Environment {
 
-bool setEnvironmentVariable(const String& name, const String& value, bool overwrite)
+std::vector<std::string> systemEnvironment()
 {
-	int result = 0;
-	bool exists = !environmentVariable(name).isEmpty();
-	if (overwrite || !exists)
+	std::vector<std::string> entries;
+	for (char** entry = _environ; entry != NULL && *entry != NULL; ++entry)
 	{
-		result = _putenv_s(name.c_str(), value.c_str());
+		entries.push_back(*entry);
 	}
 
+	return entries;
+}
+
+bool setSystemEnvironmentVariable(const String& name, const String& value)
+{
+	int result = _putenv_s(name.c_str(), value.c_str());
 	return result == 0;
 }
 
-bool unsetEnvironmentVariable(const String& name)
+bool unsetSystemEnvironmentVariable(const String& name)
 {
 	int result = _putenv_s(name.c_str(), "");
 	return result == 0;
@@ -6,17 +6,103 @@
 //	Copyright (c) 2013 Christian Noon. All rights reserved.
 //
 
+// C++ headers
+#include <cstdio>
+#include <set>
+#include <string>
+
+// Boost headers
+#include <boost/thread/mutex.hpp>
+
 // Bump headers
 #include <bump/Exception.h>
 
 namespace bump {
 
+namespace {
+
+/**
+ * Returns a copy of the class name that lives as long as the process, so exceptions can keep a
+ * pointer to it. The names are leaked on purpose since exceptions may be thrown and described
+ * during static destruction.
+ */
+const char* internClassName(const String& className)
+{
+	static boost::mutex* mutex = new boost::mutex();
+	static std::set<std::string>* classNames = new std::set<std::string>();
+
+	boost::mutex::scoped_lock lock(*mutex);
+	return classNames->insert(className).first->c_str();
+}
+
+}	// End of anonymous namespace
+
+//====================================================================================
+//                                    SourceLocation
+//====================================================================================
+
+SourceLocation::SourceLocation(const char* function, const char* file, int line) :
+	_function(function),
+	_file(file),
+	_line(line),
+	_location()
+{
+	;
+}
+
+SourceLocation::SourceLocation(const String& location) :
+	_function(NULL),
+	_file(NULL),
+	_line(0),
+	_location(location)
+{
+	;
+}
+
+SourceLocation::SourceLocation(const char* location) :
+	_function(NULL),
+	_file(NULL),
+	_line(0),
+	_location(location)
+{
+	;
+}
+
+String SourceLocation::description() const
+{
+	if (_function == NULL)
+	{
+		return _location;
+	}
+
+	char line[16];
+	std::sprintf(line, "%d", _line);
+
+	String location("Function: ");
+	location += _function;
+	location += " File: ";
+	location += _file;
+	location += " Line: ";
+	location += line;
+
+	return location;
+}
+
 //====================================================================================
 //                                      Exception
 //====================================================================================
 
-Exception::Exception(const String& className, const String& description, const String& location) throw() :
-	_className(className)
+Exception::Exception(const char* className, const String& description, const SourceLocation& location) throw() :
+	_className(className),
+	_descriptions()
+{
+	// Add the description
+	extendDescription(description, location);
+}
+
+Exception::Exception(const String& className, const String& description, const SourceLocation& location) throw() :
+	_className(internClassName(className)),
+	_descriptions()
 {
 	// Add the description
 	extendDescription(description, location);
@@ -29,21 +115,43 @@ Exception::~Exception() throw()
 
 String Exception::description() const throw()
 {
-	return String::join(_descriptions, "\n");
+	// The descriptions are only formatted when they are asked for, which is far less often than they are thrown
+	String full_description;
+	for (std::size_t i = 0; i < _descriptions.size(); ++i)
+	{
+		if (i > 0)
+		{
+			full_description += "\n";
+		}
+
+		full_description += _className;
+		full_description += ": \"";
+		full_description += _descriptions[i].text;
+		full_description += "\" ";
+		full_description += _descriptions[i].location.description();
+	}
+
+	return full_description;
 }
 
-void Exception::extendDescription(const String& description, const String& location)
+void Exception::extendDescription(const String& description, const SourceLocation& location)
 {
-	String new_description;
-	new_description << _className << ": \"" << description << "\" " << location;
-	_descriptions.push_back(new_description);
+	// Assigning the text once it is in place saves copying it through a temporary
+	_descriptions.push_back(Description(String(), location));
+	_descriptions.back().text = description;
 }
 
 //====================================================================================
 //                                       LogicError
 //====================================================================================
 
-LogicError::LogicError(const String& className, const String& description, const String& location) throw() :
+LogicError::LogicError(const char* className, const String& description, const SourceLocation& location) throw() :
+	Exception(className, description, location)
+{
+	;
+}
+
+LogicError::LogicError(const String& className, const String& description, const SourceLocation& location) throw() :
 	Exception(className, description, location)
 {
 	;
@@ -58,7 +166,13 @@ LogicError::~LogicError() throw()
 //                                    RuntimeError
 //====================================================================================
 
-RuntimeError::RuntimeError(const String& className, const String& description, const String& location) throw() :
+RuntimeError::RuntimeError(const char* className, const String& description, const SourceLocation& location) throw() :
+	Exception(className, description, location)
+{
+	;
+}
+
+RuntimeError::RuntimeError(const String& className, const String& description, const SourceLocation& location) throw() :
 	Exception(className, description, location)
 {
 	;
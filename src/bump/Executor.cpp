@@ -0,0 +1,333 @@
+//
+//	Executor.cpp
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+// Boost headers
+#include <boost/bind.hpp>
+
+// Bump headers
+#include <bump/EnvironmentSetting.h>
+#include <bump/Exception.h>
+#include <bump/Executor.h>
+#include <bump/Log.h>
+#include "ThreadLocal.h"
+
+namespace bump {
+
+namespace {
+
+// The executor the calling thread is a worker of, and its index in that executor
+BUMP_THREAD_LOCAL const Executor* tExecutor = NULL;
+BUMP_THREAD_LOCAL unsigned int tWorkerIndex = 0;
+
+}	// End of anonymous namespace
+
+struct Executor::ParallelFor
+{
+	const IndexTask*				body;			/**< @internal The function to run for each index. */
+	std::size_t						grainSize;		/**< @internal The largest piece of the range not to split. */
+	boost::atomic<std::size_t>		remaining;		/**< @internal The number of indices that have not run. */
+	boost::atomic<bool>				failed;			/**< @internal Whether the body has thrown. */
+	boost::mutex					doneMutex;		/**< @internal Guards whether every index has run. */
+	boost::condition_variable		doneCondition;	/**< @internal Signaled when every index has run. */
+	bool							isDone;			/**< @internal Whether every index has run. */
+	boost::mutex					errorMutex;		/**< @internal Guards the error. */
+	boost::exception_ptr			error;			/**< @internal The first exception the body threw. */
+};
+
+Executor::Executor(unsigned int threadCount, bool pinThreads) :
+	_workers(),
+	_injectedMutex(),
+	_injectedTasks(),
+	_pendingTasks(0),
+	_sleepingWorkers(0),
+	_stolenTasks(0),
+	_sleepMutex(),
+	_wakeCondition(),
+	_isStopping(false)
+{
+	if (threadCount == 0)
+	{
+		threadCount = boost::thread::hardware_concurrency();
+	}
+	if (threadCount == 0)
+	{
+		threadCount = 1;
+	}
+
+	// Every deque exists before any worker can try to steal from it
+	for (unsigned int i = 0; i < threadCount; ++i)
+	{
+		Worker* worker = new Worker();
+		worker->thread = NULL;
+		_workers.push_back(worker);
+	}
+	for (unsigned int i = 0; i < threadCount; ++i)
+	{
+		_workers[i]->thread = new boost::thread(boost::bind(&Executor::runWorker, this, i, pinThreads));
+	}
+}
+
+Executor::~Executor()
+{
+	{
+		boost::mutex::scoped_lock lock(_sleepMutex);
+		_isStopping = true;
+	}
+	_wakeCondition.notify_all();
+
+	// Workers still steal from each other until the last one stops, so none can be deleted before then
+	for (unsigned int i = 0; i < _workers.size(); ++i)
+	{
+		_workers[i]->thread->join();
+	}
+	for (unsigned int i = 0; i < _workers.size(); ++i)
+	{
+		delete _workers[i]->thread;
+		delete _workers[i];
+	}
+}
+
+Executor* Executor::instance()
+{
+	static const IntSetting threadsSetting(BUMP_EXECUTOR_THREADS, 0, "The number of threads of the shared executor, where 0 uses one per core", 0, 1024);
+	static const BoolSetting affinitySetting(BUMP_EXECUTOR_AFFINITY, false, "Whether to pin each thread of the shared executor to its own core");
+	static Executor executor(static_cast<unsigned int>(threadsSetting.value()), affinitySetting.value());
+	return &executor;
+}
+
+unsigned int Executor::threadCount() const
+{
+	return _workers.size();
+}
+
+void Executor::post(const Task& task)
+{
+	if (tExecutor == this)
+	{
+		Worker* worker = _workers[tWorkerIndex];
+		boost::mutex::scoped_lock lock(worker->mutex);
+		worker->tasks.push_back(task);
+	}
+	else
+	{
+		boost::mutex::scoped_lock lock(_injectedMutex);
+		_injectedTasks.push_back(task);
+	}
+
+	// Publishing the task before checking for sleepers pairs with the workers announcing they are
+	// about to sleep before checking for tasks, so a worker can never sleep through a new task
+	_pendingTasks.fetch_add(1, boost::memory_order_seq_cst);
+	if (_sleepingWorkers.load(boost::memory_order_seq_cst) > 0)
+	{
+		boost::mutex::scoped_lock lock(_sleepMutex);
+		_wakeCondition.notify_one();
+	}
+}
+
+void Executor::parallelFor(std::size_t begin, std::size_t end, const IndexTask& body, std::size_t grainSize)
+{
+	if (begin >= end)
+	{
+		return;
+	}
+
+	ParallelFor state;
+	state.body = &body;
+	state.grainSize = grainSize == 0 ? 1 : grainSize;
+	state.remaining.store(end - begin, boost::memory_order_relaxed);
+	state.failed.store(false, boost::memory_order_relaxed);
+	state.isDone = false;
+
+	// Run a share of the range here, then help with whatever is left while there are tasks to take
+	runRange(&state, begin, end);
+	while (state.remaining.load(boost::memory_order_acquire) > 0)
+	{
+		Task task;
+		if (!takeTask(task))
+		{
+			break;
+		}
+		runTask(task);
+	}
+
+	// The rest of the range is running on other threads, so sleep until the last piece finishes
+	{
+		boost::mutex::scoped_lock lock(state.doneMutex);
+		while (!state.isDone)
+		{
+			state.doneCondition.wait(lock);
+		}
+	}
+
+	if (state.error)
+	{
+		boost::rethrow_exception(state.error);
+	}
+}
+
+bool Executor::isWorkerThread() const
+{
+	return tExecutor == this;
+}
+
+unsigned long long Executor::stolenTasks() const
+{
+	return _stolenTasks.load(boost::memory_order_relaxed);
+}
+
+bool Executor::takeTask(Task& task)
+{
+	const bool isWorker = tExecutor == this;
+	const unsigned int workerCount = _workers.size();
+
+	// Take the most recently posted task from our own deque while it is still in the cache
+	if (isWorker)
+	{
+		Worker* worker = _workers[tWorkerIndex];
+		boost::mutex::scoped_lock lock(worker->mutex);
+		if (!worker->tasks.empty())
+		{
+			task.swap(worker->tasks.back());
+			worker->tasks.pop_back();
+			_pendingTasks.fetch_sub(1, boost::memory_order_relaxed);
+			return true;
+		}
+	}
+
+	// Then the oldest task posted from outside of the workers
+	{
+		boost::mutex::scoped_lock lock(_injectedMutex);
+		if (!_injectedTasks.empty())
+		{
+			task.swap(_injectedTasks.front());
+			_injectedTasks.pop_front();
+			_pendingTasks.fetch_sub(1, boost::memory_order_relaxed);
+			return true;
+		}
+	}
+
+	// Then steal the oldest task of another worker, which is usually the largest piece of its work
+	const unsigned int first = isWorker ? tWorkerIndex + 1 : 0;
+	for (unsigned int i = 0; i < workerCount; ++i)
+	{
+		Worker* victim = _workers[(first + i) % workerCount];
+		if (isWorker && victim == _workers[tWorkerIndex])
+		{
+			continue;
+		}
+
+		boost::mutex::scoped_lock lock(victim->mutex);
+		if (!victim->tasks.empty())
+		{
+			task.swap(victim->tasks.front());
+			victim->tasks.pop_front();
+			_pendingTasks.fetch_sub(1, boost::memory_order_relaxed);
+			_stolenTasks.fetch_add(1, boost::memory_order_relaxed);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void Executor::runTask(const Task& task)
+{
+	try
+	{
+		task();
+	}
+	catch (const Exception& e)
+	{
+		bumpERROR_P("Executor: ", "A task threw: " + e.description());
+	}
+	catch (const std::exception& e)
+	{
+		bumpERROR_P("Executor: ", "A task threw: " + String(e.what()));
+	}
+	catch (...)
+	{
+		bumpERROR_P("Executor: ", "A task threw an unknown exception");
+	}
+}
+
+void Executor::runWorker(unsigned int index, bool pinThread)
+{
+	tExecutor = this;
+	tWorkerIndex = index;
+	// The number of cores is 0 when it cannot be determined, and then there is nothing to pin to
+	const unsigned int coreCount = boost::thread::hardware_concurrency();
+	if (pinThread && coreCount > 0)
+	{
+		pinCurrentThread(index % coreCount);
+	}
+
+	Task task;
+	while (true)
+	{
+		if (takeTask(task))
+		{
+			runTask(task);
+			task.clear();
+			continue;
+		}
+
+		boost::mutex::scoped_lock lock(_sleepMutex);
+		_sleepingWorkers.fetch_add(1, boost::memory_order_seq_cst);
+		while (_pendingTasks.load(boost::memory_order_seq_cst) == 0 && !_isStopping)
+		{
+			_wakeCondition.wait(lock);
+		}
+		_sleepingWorkers.fetch_sub(1, boost::memory_order_relaxed);
+
+		// Queued tasks still run after the destructor starts stopping the workers
+		if (_isStopping && _pendingTasks.load(boost::memory_order_seq_cst) == 0)
+		{
+			return;
+		}
+	}
+}
+
+void Executor::runRange(ParallelFor* parallelFor, std::size_t begin, std::size_t end)
+{
+	// Split off the upper halves for idle workers to steal, keeping the lower half to run here
+	while (end - begin > parallelFor->grainSize)
+	{
+		const std::size_t middle = begin + (end - begin) / 2;
+		post(boost::bind(&Executor::runRange, this, parallelFor, middle, end));
+		end = middle;
+	}
+
+	for (std::size_t i = begin; i < end && !parallelFor->failed.load(boost::memory_order_relaxed); ++i)
+	{
+		try
+		{
+			(*parallelFor->body)(i);
+		}
+		catch (...)
+		{
+			boost::mutex::scoped_lock lock(parallelFor->errorMutex);
+			if (!parallelFor->error)
+			{
+				parallelFor->error = boost::current_exception();
+			}
+			parallelFor->failed.store(true, boost::memory_order_relaxed);
+		}
+	}
+
+	// The caller of parallelFor() returns once the last piece marks the loop done, so that is the
+	// last access
+	const std::size_t count = end - begin;
+	if (parallelFor->remaining.fetch_sub(count, boost::memory_order_acq_rel) == count)
+	{
+		boost::mutex::scoped_lock lock(parallelFor->doneMutex);
+		parallelFor->isDone = true;
+		parallelFor->doneCondition.notify_all();
+	}
+}
+
+}	// End of bump namespace
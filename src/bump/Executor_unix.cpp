@@ -0,0 +1,32 @@
+//
+//	Executor_unix.cpp
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+// Bump headers
+#include <bump/Executor.h>
+
+// Unix headers
+#include <pthread.h>
+#include <sched.h>
+
+namespace bump {
+
+bool Executor::pinCurrentThread(unsigned int cpu)
+{
+#if defined(__linux__)
+	cpu_set_t cpus;
+	CPU_ZERO(&cpus);
+	CPU_SET(cpu % CPU_SETSIZE, &cpus);
+	return pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus) == 0;
+#else
+	// Mac OS X only supports affinity hints between threads rather than pinning to a core
+	(void) cpu;
+	return false;
+#endif
+}
+
+}	// End of bump namespace
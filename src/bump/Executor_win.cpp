@@ -0,0 +1,23 @@
+//
+//	Executor_win.cpp
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+// Bump headers
+#include <bump/Executor.h>
+
+// Windows headers
+#include <windows.h>
+
+namespace bump {
+
+bool Executor::pinCurrentThread(unsigned int cpu)
+{
+	const DWORD_PTR mask = static_cast<DWORD_PTR>(1) << (cpu % (sizeof(DWORD_PTR) * 8));
+	return SetThreadAffinityMask(GetCurrentThread(), mask) != 0;
+}
+
+}	// End of bump namespace
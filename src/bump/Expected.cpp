@@ -0,0 +1,79 @@
+//
+//	Expected.cpp
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+// Bump headers
+#include <bump/Expected.h>
+#include <bump/FileSystemError.h>
+#include <bump/InvalidArgumentError.h>
+#include <bump/OutOfRangeError.h>
+#include <bump/StringSearchError.h>
+#include <bump/TypeCastError.h>
+
+namespace bump {
+
+Result::Result() :
+	_type(SUCCESS),
+	_description(""),
+	_code()
+{
+	;
+}
+
+Result::Result(Type type, const char* description, const boost::system::error_code& code) :
+	_type(type),
+	_description(description),
+	_code(code)
+{
+	;
+}
+
+Result::Result(Type type, const char* description, boost::system::errc::errc_t code) :
+	_type(type),
+	_description(description),
+	_code(boost::system::errc::make_error_code(code))
+{
+	;
+}
+
+String Result::message() const
+{
+	if (_type == SUCCESS)
+	{
+		return String();
+	}
+
+	String message(_description);
+	if (_code)
+	{
+		message += ": ";
+		message += _code.message();
+	}
+
+	return message;
+}
+
+void Result::throwError() const
+{
+	switch (_type)
+	{
+		case FILE_SYSTEM_ERROR:
+			throw FileSystemError(message(), BUMP_LOCATION);
+		case INVALID_ARGUMENT_ERROR:
+			throw InvalidArgumentError(message(), BUMP_LOCATION);
+		case OUT_OF_RANGE_ERROR:
+			throw OutOfRangeError(message(), BUMP_LOCATION);
+		case STRING_SEARCH_ERROR:
+			throw StringSearchError(message(), BUMP_LOCATION);
+		case TYPE_CAST_ERROR:
+			throw TypeCastError(message(), BUMP_LOCATION);
+		default:
+			break;
+	}
+}
+
+}	// End of bump namespace
@@ -0,0 +1,826 @@
+//
+//	FastHash.cpp
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+// C++ headers
+#include <cstring>
+
+// Boost headers
+#include <boost/predef/other/endian.h>
+
+// Bump headers
+#include <bump/FastHash.h>
+
+// Use the vectorized accumulators when the target guarantees SSE2, and AVX2 when the CPU supports it at runtime
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define BUMP_FAST_HASH_SSE2
+	#include <emmintrin.h>
+	#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+		#define BUMP_FAST_HASH_AVX2
+		#include <immintrin.h>
+	#endif
+#endif
+
+#if defined(_MSC_VER) && defined(_M_X64)
+	#include <intrin.h>
+#endif
+
+namespace bump {
+
+namespace {
+
+// Typedefs
+typedef unsigned int uint32;
+typedef unsigned long long uint64;
+
+// Algorithm constants
+const uint32 gPrime32_1 = 0x9e3779b1U;
+const uint32 gPrime32_2 = 0x85ebca77U;
+const uint32 gPrime32_3 = 0xc2b2ae3dU;
+const uint64 gPrime64_1 = 0x9e3779b185ebca87ULL;
+const uint64 gPrime64_2 = 0xc2b2ae3d27d4eb4fULL;
+const uint64 gPrime64_3 = 0x165667b19e3779f9ULL;
+const uint64 gPrime64_4 = 0x85ebca77c2b2ae63ULL;
+const uint64 gPrime64_5 = 0x27d4eb2f165667c5ULL;
+const uint64 gPrimeMx1 = 0x165667919e3779f9ULL;
+const uint64 gPrimeMx2 = 0x9fb21c651e98df25ULL;
+
+// Input is consumed in 64 byte stripes, 16 stripes to a block when using the default secret size
+const std::size_t gStripeLength = 64;
+const std::size_t gSecretSize = 192;
+const std::size_t gSecretSizeMin = 136;
+const std::size_t gStripesPerBlock = (gSecretSize - gStripeLength) / 8;
+const std::size_t gBlockLength = gStripeLength * gStripesPerBlock;
+const std::size_t gBufferSize = 256;
+const std::size_t gMidSizeMax = 240;
+
+/** The default secret of the XXH3 algorithm. */
+const unsigned char gDefaultSecret[gSecretSize] =
+{
+	0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+	0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+	0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+	0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+	0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+	0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+	0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+	0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+	0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+	0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+	0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+	0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e
+};
+
+//====================================================================================
+//                                 Primitive Helpers
+//====================================================================================
+
+inline uint32 swap32(uint32 value)
+{
+	return ((value << 24) & 0xff000000U) | ((value << 8) & 0x00ff0000U) |
+		((value >> 8) & 0x0000ff00U) | ((value >> 24) & 0x000000ffU);
+}
+
+inline uint64 swap64(uint64 value)
+{
+	return ((uint64) swap32((uint32) value) << 32) | swap32((uint32) (value >> 32));
+}
+
+/** Reads a little endian 32 bit value from unaligned memory. */
+inline uint32 read32(const unsigned char* data)
+{
+	uint32 value;
+	std::memcpy(&value, data, sizeof(value));
+#if BOOST_ENDIAN_BIG_BYTE
+	value = swap32(value);
+#endif
+	return value;
+}
+
+/** Reads a little endian 64 bit value from unaligned memory. */
+inline uint64 read64(const unsigned char* data)
+{
+	uint64 value;
+	std::memcpy(&value, data, sizeof(value));
+#if BOOST_ENDIAN_BIG_BYTE
+	value = swap64(value);
+#endif
+	return value;
+}
+
+/** Writes a little endian 64 bit value to unaligned memory. */
+inline void write64(unsigned char* data, uint64 value)
+{
+#if BOOST_ENDIAN_BIG_BYTE
+	value = swap64(value);
+#endif
+	std::memcpy(data, &value, sizeof(value));
+}
+
+inline uint32 rotl32(uint32 value, int steps)
+{
+	return (value << steps) | (value >> (32 - steps));
+}
+
+inline uint64 rotl64(uint64 value, int steps)
+{
+	return (value << steps) | (value >> (64 - steps));
+}
+
+/** Multiplies two 64 bit values into a full 128 bit product. */
+inline Hash128 multiply64To128(uint64 lhs, uint64 rhs)
+{
+	Hash128 product;
+
+#if defined(__SIZEOF_INT128__)
+	const unsigned __int128 full = (unsigned __int128) lhs * rhs;
+	product.low = (uint64) full;
+	product.high = (uint64) (full >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+	product.low = _umul128(lhs, rhs, &product.high);
+#else
+	const uint64 lowLow = (lhs & 0xffffffffULL) * (rhs & 0xffffffffULL);
+	const uint64 highLow = (lhs >> 32) * (rhs & 0xffffffffULL);
+	const uint64 lowHigh = (lhs & 0xffffffffULL) * (rhs >> 32);
+	const uint64 highHigh = (lhs >> 32) * (rhs >> 32);
+	const uint64 cross = (lowLow >> 32) + (highLow & 0xffffffffULL) + lowHigh;
+	product.high = (highLow >> 32) + (cross >> 32) + highHigh;
+	product.low = (cross << 32) | (lowLow & 0xffffffffULL);
+#endif
+
+	return product;
+}
+
+/** Multiplies two 64 bit values and folds the 128 bit product back into 64 bits. */
+inline uint64 multiplyFold64(uint64 lhs, uint64 rhs)
+{
+	const Hash128 product = multiply64To128(lhs, rhs);
+	return product.low ^ product.high;
+}
+
+inline uint64 xorShift64(uint64 value, int shift)
+{
+	return value ^ (value >> shift);
+}
+
+/** The final mix of the XXH64 algorithm, used for the smallest inputs. */
+inline uint64 avalancheXxh64(uint64 hash)
+{
+	hash ^= hash >> 33;
+	hash *= gPrime64_2;
+	hash ^= hash >> 29;
+	hash *= gPrime64_3;
+	hash ^= hash >> 32;
+	return hash;
+}
+
+inline uint64 avalanche(uint64 hash)
+{
+	hash = xorShift64(hash, 37);
+	hash *= gPrimeMx1;
+	hash = xorShift64(hash, 32);
+	return hash;
+}
+
+/** A stronger avalanche used for 4 to 8 byte inputs. */
+inline uint64 rrmxmx(uint64 hash, uint64 length)
+{
+	hash ^= rotl64(hash, 49) ^ rotl64(hash, 24);
+	hash *= gPrimeMx2;
+	hash ^= (hash >> 35) + length;
+	hash *= gPrimeMx2;
+	return xorShift64(hash, 28);
+}
+
+inline uint64 mix16Bytes(const unsigned char* input, const unsigned char* secret, uint64 seed)
+{
+	const uint64 inputLow = read64(input);
+	const uint64 inputHigh = read64(input + 8);
+	return multiplyFold64(inputLow ^ (read64(secret) + seed), inputHigh ^ (read64(secret + 8) - seed));
+}
+
+inline void mix32Bytes(Hash128& accumulator, const unsigned char* input1, const unsigned char* input2,
+					   const unsigned char* secret, uint64 seed)
+{
+	accumulator.low += mix16Bytes(input1, secret, seed);
+	accumulator.low ^= read64(input2) + read64(input2 + 8);
+	accumulator.high += mix16Bytes(input2, secret + 16, seed);
+	accumulator.high ^= read64(input1) + read64(input1 + 8);
+}
+
+/** Derives a secret from the default secret and the seed. */
+void initSecret(unsigned char* secret, uint64 seed)
+{
+	for (std::size_t i = 0; i < gSecretSize / 16; ++i)
+	{
+		write64(secret + 16 * i, read64(gDefaultSecret + 16 * i) + seed);
+		write64(secret + 16 * i + 8, read64(gDefaultSecret + 16 * i + 8) - seed);
+	}
+}
+
+//====================================================================================
+//                               Short Input Hashing
+//====================================================================================
+
+uint64 hash64Short(const unsigned char* input, std::size_t length, const unsigned char* secret, uint64 seed)
+{
+	if (length > 8)
+	{
+		const uint64 bitflip1 = (read64(secret + 24) ^ read64(secret + 32)) + seed;
+		const uint64 bitflip2 = (read64(secret + 40) ^ read64(secret + 48)) - seed;
+		const uint64 inputLow = read64(input) ^ bitflip1;
+		const uint64 inputHigh = read64(input + length - 8) ^ bitflip2;
+		const uint64 accumulator = length + swap64(inputLow) + inputHigh + multiplyFold64(inputLow, inputHigh);
+		return avalanche(accumulator);
+	}
+	else if (length >= 4)
+	{
+		seed ^= (uint64) swap32((uint32) seed) << 32;
+		const uint32 input1 = read32(input);
+		const uint32 input2 = read32(input + length - 4);
+		const uint64 bitflip = (read64(secret + 8) ^ read64(secret + 16)) - seed;
+		const uint64 input64 = input2 + ((uint64) input1 << 32);
+		return rrmxmx(input64 ^ bitflip, length);
+	}
+	else if (length > 0)
+	{
+		const uint32 combined = ((uint32) input[0] << 16) | ((uint32) input[length >> 1] << 24) |
+			((uint32) input[length - 1]) | ((uint32) length << 8);
+		const uint64 bitflip = (read32(secret) ^ read32(secret + 4)) + seed;
+		return avalancheXxh64((uint64) combined ^ bitflip);
+	}
+
+	return avalancheXxh64(seed ^ (read64(secret + 56) ^ read64(secret + 64)));
+}
+
+Hash128 hash128Short(const unsigned char* input, std::size_t length, const unsigned char* secret, uint64 seed)
+{
+	Hash128 hash;
+
+	if (length > 8)
+	{
+		const uint64 bitflipLow = (read64(secret + 32) ^ read64(secret + 40)) - seed;
+		const uint64 bitflipHigh = (read64(secret + 48) ^ read64(secret + 56)) + seed;
+		const uint64 inputLow = read64(input);
+		uint64 inputHigh = read64(input + length - 8);
+		Hash128 mixed = multiply64To128(inputLow ^ inputHigh ^ bitflipLow, gPrime64_1);
+		mixed.low += (uint64) (length - 1) << 54;
+		inputHigh ^= bitflipHigh;
+		mixed.high += inputHigh + (uint64) (uint32) inputHigh * (gPrime32_2 - 1);
+		mixed.low ^= swap64(mixed.high);
+		hash = multiply64To128(mixed.low, gPrime64_2);
+		hash.high += mixed.high * gPrime64_2;
+		hash.low = avalanche(hash.low);
+		hash.high = avalanche(hash.high);
+	}
+	else if (length >= 4)
+	{
+		seed ^= (uint64) swap32((uint32) seed) << 32;
+		const uint32 inputLow = read32(input);
+		const uint32 inputHigh = read32(input + length - 4);
+		const uint64 input64 = inputLow + ((uint64) inputHigh << 32);
+		const uint64 bitflip = (read64(secret + 16) ^ read64(secret + 24)) + seed;
+		hash = multiply64To128(input64 ^ bitflip, gPrime64_1 + (length << 2));
+		hash.high += hash.low << 1;
+		hash.low ^= hash.high >> 3;
+		hash.low = xorShift64(hash.low, 35);
+		hash.low *= gPrimeMx2;
+		hash.low = xorShift64(hash.low, 28);
+		hash.high = avalanche(hash.high);
+	}
+	else if (length > 0)
+	{
+		const uint32 combinedLow = ((uint32) input[0] << 16) | ((uint32) input[length >> 1] << 24) |
+			((uint32) input[length - 1]) | ((uint32) length << 8);
+		const uint32 combinedHigh = rotl32(swap32(combinedLow), 13);
+		const uint64 bitflipLow = (read32(secret) ^ read32(secret + 4)) + seed;
+		const uint64 bitflipHigh = (read32(secret + 8) ^ read32(secret + 12)) - seed;
+		hash.low = avalancheXxh64((uint64) combinedLow ^ bitflipLow);
+		hash.high = avalancheXxh64((uint64) combinedHigh ^ bitflipHigh);
+	}
+	else
+	{
+		hash.low = avalancheXxh64(seed ^ read64(secret + 64) ^ read64(secret + 72));
+		hash.high = avalancheXxh64(seed ^ read64(secret + 80) ^ read64(secret + 88));
+	}
+
+	return hash;
+}
+
+//====================================================================================
+//                              Medium Input Hashing
+//====================================================================================
+
+uint64 hash64Medium(const unsigned char* input, std::size_t length, const unsigned char* secret, uint64 seed)
+{
+	uint64 accumulator = length * gPrime64_1;
+
+	if (length <= 128)
+	{
+		if (length > 32)
+		{
+			if (length > 64)
+			{
+				if (length > 96)
+				{
+					accumulator += mix16Bytes(input + 48, secret + 96, seed);
+					accumulator += mix16Bytes(input + length - 64, secret + 112, seed);
+				}
+				accumulator += mix16Bytes(input + 32, secret + 64, seed);
+				accumulator += mix16Bytes(input + length - 48, secret + 80, seed);
+			}
+			accumulator += mix16Bytes(input + 16, secret + 32, seed);
+			accumulator += mix16Bytes(input + length - 32, secret + 48, seed);
+		}
+		accumulator += mix16Bytes(input, secret, seed);
+		accumulator += mix16Bytes(input + length - 16, secret + 16, seed);
+		return avalanche(accumulator);
+	}
+
+	const std::size_t rounds = length / 16;
+	for (std::size_t i = 0; i < 8; ++i)
+	{
+		accumulator += mix16Bytes(input + 16 * i, secret + 16 * i, seed);
+	}
+	accumulator = avalanche(accumulator);
+	for (std::size_t i = 8; i < rounds; ++i)
+	{
+		accumulator += mix16Bytes(input + 16 * i, secret + 16 * (i - 8) + 3, seed);
+	}
+	accumulator += mix16Bytes(input + length - 16, secret + gSecretSizeMin - 17, seed);
+	return avalanche(accumulator);
+}
+
+Hash128 hash128Medium(const unsigned char* input, std::size_t length, const unsigned char* secret, uint64 seed)
+{
+	Hash128 accumulator;
+	accumulator.low = length * gPrime64_1;
+	accumulator.high = 0;
+
+	if (length <= 128)
+	{
+		if (length > 32)
+		{
+			if (length > 64)
+			{
+				if (length > 96)
+				{
+					mix32Bytes(accumulator, input + 48, input + length - 64, secret + 96, seed);
+				}
+				mix32Bytes(accumulator, input + 32, input + length - 48, secret + 64, seed);
+			}
+			mix32Bytes(accumulator, input + 16, input + length - 32, secret + 32, seed);
+		}
+		mix32Bytes(accumulator, input, input + length - 16, secret, seed);
+	}
+	else
+	{
+		const std::size_t rounds = length / 32;
+		for (std::size_t i = 0; i < 4; ++i)
+		{
+			mix32Bytes(accumulator, input + 32 * i, input + 32 * i + 16, secret + 32 * i, seed);
+		}
+		accumulator.low = avalanche(accumulator.low);
+		accumulator.high = avalanche(accumulator.high);
+		for (std::size_t i = 4; i < rounds; ++i)
+		{
+			mix32Bytes(accumulator, input + 32 * i, input + 32 * i + 16, secret + 3 + 32 * (i - 4), seed);
+		}
+		mix32Bytes(accumulator, input + length - 16, input + length - 32, secret + gSecretSizeMin - 17 - 16, 0 - seed);
+	}
+
+	Hash128 hash;
+	hash.low = avalanche(accumulator.low + accumulator.high);
+	hash.high = 0 - avalanche(accumulator.low * gPrime64_1 + accumulator.high * gPrime64_4 + (length - seed) * gPrime64_2);
+	return hash;
+}
+
+//====================================================================================
+//                                Long Input Kernels
+//====================================================================================
+
+/** Accumulates consecutive stripes, each one using the secret shifted by another 8 bytes. */
+typedef void (*AccumulateFunction)(uint64* accumulators, const unsigned char* input, const unsigned char* secret,
+								   std::size_t stripes);
+
+/** Scrambles the accumulators at the end of each block. */
+typedef void (*ScrambleFunction)(uint64* accumulators, const unsigned char* secret);
+
+void accumulateScalar(uint64* accumulators, const unsigned char* input, const unsigned char* secret, std::size_t stripes)
+{
+	for (std::size_t stripe = 0; stripe < stripes; ++stripe)
+	{
+		const unsigned char* stripeInput = input + stripe * gStripeLength;
+		const unsigned char* stripeSecret = secret + stripe * 8;
+		for (std::size_t lane = 0; lane < 8; ++lane)
+		{
+			const uint64 value = read64(stripeInput + 8 * lane);
+			const uint64 key = value ^ read64(stripeSecret + 8 * lane);
+			accumulators[lane ^ 1] += value;
+			accumulators[lane] += (key & 0xffffffffULL) * (key >> 32);
+		}
+	}
+}
+
+void scrambleScalar(uint64* accumulators, const unsigned char* secret)
+{
+	for (std::size_t lane = 0; lane < 8; ++lane)
+	{
+		uint64 accumulator = accumulators[lane];
+		accumulator = xorShift64(accumulator, 47);
+		accumulator ^= read64(secret + 8 * lane);
+		accumulator *= gPrime32_1;
+		accumulators[lane] = accumulator;
+	}
+}
+
+#ifdef BUMP_FAST_HASH_SSE2
+
+void accumulateSse2(uint64* accumulators, const unsigned char* input, const unsigned char* secret, std::size_t stripes)
+{
+	__m128i vectors[4];
+	for (std::size_t i = 0; i < 4; ++i)
+	{
+		vectors[i] = _mm_loadu_si128((const __m128i*) accumulators + i);
+	}
+
+	for (std::size_t stripe = 0; stripe < stripes; ++stripe)
+	{
+		const unsigned char* stripeInput = input + stripe * gStripeLength;
+		const unsigned char* stripeSecret = secret + stripe * 8;
+		for (std::size_t i = 0; i < 4; ++i)
+		{
+			const __m128i data = _mm_loadu_si128((const __m128i*) stripeInput + i);
+			const __m128i key = _mm_xor_si128(data, _mm_loadu_si128((const __m128i*) stripeSecret + i));
+			const __m128i product = _mm_mul_epu32(key, _mm_shuffle_epi32(key, _MM_SHUFFLE(0, 3, 0, 1)));
+			const __m128i swapped = _mm_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+			vectors[i] = _mm_add_epi64(vectors[i], _mm_add_epi64(product, swapped));
+		}
+	}
+
+	for (std::size_t i = 0; i < 4; ++i)
+	{
+		_mm_storeu_si128((__m128i*) accumulators + i, vectors[i]);
+	}
+}
+
+void scrambleSse2(uint64* accumulators, const unsigned char* secret)
+{
+	const __m128i prime = _mm_set1_epi32((int) gPrime32_1);
+	for (std::size_t i = 0; i < 4; ++i)
+	{
+		const __m128i accumulator = _mm_loadu_si128((const __m128i*) accumulators + i);
+		const __m128i shifted = _mm_xor_si128(accumulator, _mm_srli_epi64(accumulator, 47));
+		const __m128i key = _mm_xor_si128(shifted, _mm_loadu_si128((const __m128i*) secret + i));
+		const __m128i productLow = _mm_mul_epu32(key, prime);
+		const __m128i productHigh = _mm_mul_epu32(_mm_shuffle_epi32(key, _MM_SHUFFLE(0, 3, 0, 1)), prime);
+		_mm_storeu_si128((__m128i*) accumulators + i, _mm_add_epi64(productLow, _mm_slli_epi64(productHigh, 32)));
+	}
+}
+
+#endif // BUMP_FAST_HASH_SSE2
+
+#ifdef BUMP_FAST_HASH_AVX2
+
+__attribute__((target("avx2")))
+void accumulateAvx2(uint64* accumulators, const unsigned char* input, const unsigned char* secret, std::size_t stripes)
+{
+	__m256i first = _mm256_loadu_si256((const __m256i*) accumulators);
+	__m256i second = _mm256_loadu_si256((const __m256i*) accumulators + 1);
+
+	for (std::size_t stripe = 0; stripe < stripes; ++stripe)
+	{
+		const __m256i* stripeInput = (const __m256i*) (input + stripe * gStripeLength);
+		const __m256i* stripeSecret = (const __m256i*) (secret + stripe * 8);
+
+		const __m256i data1 = _mm256_loadu_si256(stripeInput);
+		const __m256i key1 = _mm256_xor_si256(data1, _mm256_loadu_si256(stripeSecret));
+		const __m256i product1 = _mm256_mul_epu32(key1, _mm256_shuffle_epi32(key1, _MM_SHUFFLE(0, 3, 0, 1)));
+		first = _mm256_add_epi64(first, _mm256_add_epi64(product1, _mm256_shuffle_epi32(data1, _MM_SHUFFLE(1, 0, 3, 2))));
+
+		const __m256i data2 = _mm256_loadu_si256(stripeInput + 1);
+		const __m256i key2 = _mm256_xor_si256(data2, _mm256_loadu_si256(stripeSecret + 1));
+		const __m256i product2 = _mm256_mul_epu32(key2, _mm256_shuffle_epi32(key2, _MM_SHUFFLE(0, 3, 0, 1)));
+		second = _mm256_add_epi64(second, _mm256_add_epi64(product2, _mm256_shuffle_epi32(data2, _MM_SHUFFLE(1, 0, 3, 2))));
+	}
+
+	_mm256_storeu_si256((__m256i*) accumulators, first);
+	_mm256_storeu_si256((__m256i*) accumulators + 1, second);
+}
+
+__attribute__((target("avx2")))
+void scrambleAvx2(uint64* accumulators, const unsigned char* secret)
+{
+	const __m256i prime = _mm256_set1_epi32((int) gPrime32_1);
+	for (std::size_t i = 0; i < 2; ++i)
+	{
+		const __m256i accumulator = _mm256_loadu_si256((const __m256i*) accumulators + i);
+		const __m256i shifted = _mm256_xor_si256(accumulator, _mm256_srli_epi64(accumulator, 47));
+		const __m256i key = _mm256_xor_si256(shifted, _mm256_loadu_si256((const __m256i*) secret + i));
+		const __m256i productLow = _mm256_mul_epu32(key, prime);
+		const __m256i productHigh = _mm256_mul_epu32(_mm256_shuffle_epi32(key, _MM_SHUFFLE(0, 3, 0, 1)), prime);
+		_mm256_storeu_si256((__m256i*) accumulators + i, _mm256_add_epi64(productLow, _mm256_slli_epi64(productHigh, 32)));
+	}
+}
+
+#endif // BUMP_FAST_HASH_AVX2
+
+/** The fastest kernels supported by this CPU, chosen once on first use. */
+struct Kernels
+{
+	Kernels()
+	{
+		accumulate = accumulateScalar;
+		scramble = scrambleScalar;
+#ifdef BUMP_FAST_HASH_SSE2
+		accumulate = accumulateSse2;
+		scramble = scrambleSse2;
+#endif
+#ifdef BUMP_FAST_HASH_AVX2
+		if (__builtin_cpu_supports("avx2"))
+		{
+			accumulate = accumulateAvx2;
+			scramble = scrambleAvx2;
+		}
+#endif
+	}
+
+	AccumulateFunction accumulate;
+	ScrambleFunction scramble;
+};
+
+const Kernels& kernels()
+{
+	static const Kernels instance;
+	return instance;
+}
+
+//====================================================================================
+//                               Long Input Hashing
+//====================================================================================
+
+void initAccumulators(uint64* accumulators)
+{
+	accumulators[0] = gPrime32_3;
+	accumulators[1] = gPrime64_1;
+	accumulators[2] = gPrime64_2;
+	accumulators[3] = gPrime64_3;
+	accumulators[4] = gPrime64_4;
+	accumulators[5] = gPrime32_2;
+	accumulators[6] = gPrime64_5;
+	accumulators[7] = gPrime32_1;
+}
+
+/** Accumulates whole blocks followed by the remaining stripes and the final (possibly overlapping) stripe. */
+void accumulateLong(uint64* accumulators, const unsigned char* input, std::size_t length, const unsigned char* secret)
+{
+	const Kernels& functions = kernels();
+	initAccumulators(accumulators);
+
+	const std::size_t blocks = (length - 1) / gBlockLength;
+	for (std::size_t block = 0; block < blocks; ++block)
+	{
+		functions.accumulate(accumulators, input + block * gBlockLength, secret, gStripesPerBlock);
+		functions.scramble(accumulators, secret + gSecretSize - gStripeLength);
+	}
+
+	const std::size_t stripes = ((length - 1) - gBlockLength * blocks) / gStripeLength;
+	functions.accumulate(accumulators, input + blocks * gBlockLength, secret, stripes);
+	functions.accumulate(accumulators, input + length - gStripeLength, secret + gSecretSize - gStripeLength - 7, 1);
+}
+
+/**
+ * Accumulates stripes that continue the current block, scrambling when the block is completed.
+ * Returns the new number of stripes accumulated in the current block.
+ */
+unsigned int consumeStripes(uint64* accumulators, unsigned int stripesSoFar, const unsigned char* input,
+							std::size_t stripes, const unsigned char* secret)
+{
+	const Kernels& functions = kernels();
+	if (gStripesPerBlock - stripesSoFar > stripes)
+	{
+		functions.accumulate(accumulators, input, secret + stripesSoFar * 8, stripes);
+		return stripesSoFar + (unsigned int) stripes;
+	}
+
+	const std::size_t stripesToEnd = gStripesPerBlock - stripesSoFar;
+	functions.accumulate(accumulators, input, secret + stripesSoFar * 8, stripesToEnd);
+	functions.scramble(accumulators, secret + gSecretSize - gStripeLength);
+	functions.accumulate(accumulators, input + stripesToEnd * gStripeLength, secret, stripes - stripesToEnd);
+	return (unsigned int) (stripes - stripesToEnd);
+}
+
+uint64 mergeAccumulators(const uint64* accumulators, const unsigned char* secret, uint64 start)
+{
+	uint64 result = start;
+	for (std::size_t i = 0; i < 4; ++i)
+	{
+		result += multiplyFold64(accumulators[2 * i] ^ read64(secret + 16 * i),
+								 accumulators[2 * i + 1] ^ read64(secret + 16 * i + 8));
+	}
+	return avalanche(result);
+}
+
+uint64 finish64(const uint64* accumulators, const unsigned char* secret, uint64 length)
+{
+	return mergeAccumulators(accumulators, secret + 11, length * gPrime64_1);
+}
+
+Hash128 finish128(const uint64* accumulators, const unsigned char* secret, uint64 length)
+{
+	Hash128 hash;
+	hash.low = mergeAccumulators(accumulators, secret + 11, length * gPrime64_1);
+	hash.high = mergeAccumulators(accumulators, secret + gSecretSize - gStripeLength - 11, ~(length * gPrime64_2));
+	return hash;
+}
+
+/** Returns the default secret when unseeded, otherwise derives one into the storage. */
+const unsigned char* longSecret(unsigned char* storage, uint64 seed)
+{
+	if (seed == 0)
+	{
+		return gDefaultSecret;
+	}
+
+	initSecret(storage, seed);
+	return storage;
+}
+
+}	// End of anonymous namespace
+
+FastHash::FastHash(unsigned long long seed)
+{
+	reset(seed);
+}
+
+FastHash::~FastHash()
+{
+	;
+}
+
+void FastHash::update(const String& data)
+{
+	update(data.c_str(), data.size());
+}
+
+void FastHash::update(const char* data, std::size_t length)
+{
+	const unsigned char* input = reinterpret_cast<const unsigned char*>(data);
+	const unsigned char* end = input + length;
+	_totalLength += length;
+
+	// Keep buffering until there is more data than fits in the buffer
+	if (length <= gBufferSize - _bufferedSize)
+	{
+		if (length > 0)
+		{
+			std::memcpy(_buffer + _bufferedSize, input, length);
+		}
+		_bufferedSize += (unsigned int) length;
+		return;
+	}
+
+	const std::size_t bufferStripes = gBufferSize / gStripeLength;
+
+	// Fill up and consume the partially filled buffer
+	if (_bufferedSize > 0)
+	{
+		const std::size_t loadSize = gBufferSize - _bufferedSize;
+		std::memcpy(_buffer + _bufferedSize, input, loadSize);
+		input += loadSize;
+		_stripesSoFar = consumeStripes(_accumulators, _stripesSoFar, _buffer, bufferStripes, _secret);
+		_bufferedSize = 0;
+	}
+
+	// Consume the input directly, always leaving some of it to be buffered
+	if ((std::size_t) (end - input) > gBufferSize)
+	{
+		do
+		{
+			_stripesSoFar = consumeStripes(_accumulators, _stripesSoFar, input, bufferStripes, _secret);
+			input += gBufferSize;
+		}
+		while ((std::size_t) (end - input) > gBufferSize);
+
+		// Keep the last consumed stripe around in case the final stripe needs to overlap it
+		std::memcpy(_buffer + gBufferSize - gStripeLength, input - gStripeLength, gStripeLength);
+	}
+
+	std::memcpy(_buffer, input, end - input);
+	_bufferedSize = (unsigned int) (end - input);
+}
+
+void FastHash::reset(unsigned long long seed)
+{
+	initAccumulators(_accumulators);
+	initSecret(_secret, seed);
+	std::memset(_buffer, 0, sizeof(_buffer));
+	_bufferedSize = 0;
+	_stripesSoFar = 0;
+	_totalLength = 0;
+	_seed = seed;
+}
+
+unsigned long long FastHash::result64() const
+{
+	if (_totalLength <= gMidSizeMax)
+	{
+		return hash64(reinterpret_cast<const char*>(_buffer), (std::size_t) _totalLength, _seed);
+	}
+
+	uint64 accumulators[8];
+	finishAccumulators(accumulators);
+	return finish64(accumulators, _secret, _totalLength);
+}
+
+Hash128 FastHash::result128() const
+{
+	if (_totalLength <= gMidSizeMax)
+	{
+		return hash128(reinterpret_cast<const char*>(_buffer), (std::size_t) _totalLength, _seed);
+	}
+
+	uint64 accumulators[8];
+	finishAccumulators(accumulators);
+	return finish128(accumulators, _secret, _totalLength);
+}
+
+unsigned long long FastHash::hash64(const String& data, unsigned long long seed)
+{
+	return hash64(data.c_str(), data.size(), seed);
+}
+
+unsigned long long FastHash::hash64(const char* data, std::size_t length, unsigned long long seed)
+{
+	const unsigned char* input = reinterpret_cast<const unsigned char*>(data);
+
+	if (length <= 16)
+	{
+		return hash64Short(input, length, gDefaultSecret, seed);
+	}
+	else if (length <= gMidSizeMax)
+	{
+		return hash64Medium(input, length, gDefaultSecret, seed);
+	}
+
+	unsigned char storage[gSecretSize];
+	const unsigned char* secret = longSecret(storage, seed);
+	uint64 accumulators[8];
+	accumulateLong(accumulators, input, length, secret);
+	return finish64(accumulators, secret, length);
+}
+
+Hash128 FastHash::hash128(const String& data, unsigned long long seed)
+{
+	return hash128(data.c_str(), data.size(), seed);
+}
+
+Hash128 FastHash::hash128(const char* data, std::size_t length, unsigned long long seed)
+{
+	const unsigned char* input = reinterpret_cast<const unsigned char*>(data);
+
+	if (length <= 16)
+	{
+		return hash128Short(input, length, gDefaultSecret, seed);
+	}
+	else if (length <= gMidSizeMax)
+	{
+		return hash128Medium(input, length, gDefaultSecret, seed);
+	}
+
+	unsigned char storage[gSecretSize];
+	const unsigned char* secret = longSecret(storage, seed);
+	uint64 accumulators[8];
+	accumulateLong(accumulators, input, length, secret);
+	return finish128(accumulators, secret, length);
+}
+
+void FastHash::finishAccumulators(unsigned long long* accumulators) const
+{
+	std::memcpy(accumulators, _accumulators, sizeof(_accumulators));
+
+	unsigned char lastStripe[gStripeLength];
+	const unsigned char* lastStripeInput = _buffer + _bufferedSize - gStripeLength;
+	if (_bufferedSize >= gStripeLength)
+	{
+		// Consume all the complete buffered stripes except the last one
+		const std::size_t stripes = (_bufferedSize - 1) / gStripeLength;
+		consumeStripes(accumulators, _stripesSoFar, _buffer, stripes, _secret);
+	}
+	else
+	{
+		// The last stripe overlaps the end of the previously consumed data
+		const std::size_t catchupSize = gStripeLength - _bufferedSize;
+		std::memcpy(lastStripe, _buffer + gBufferSize - catchupSize, catchupSize);
+		std::memcpy(lastStripe + catchupSize, _buffer, _bufferedSize);
+		lastStripeInput = lastStripe;
+	}
+
+	kernels().accumulate(accumulators, lastStripeInput, _secret + gSecretSize - gStripeLength - 7, 1);
+}
+
+}	// End of bump namespace
@@ -73,6 +73,30 @@ unsigned long long FileInfo::fileSize() const
 	return boost::filesystem::file_size(path);
 }
 
+Expected<unsigned long long> FileInfo::tryFileSize() const
+{
+	// Look up the status once, following any symlinks, rather than probing the path repeatedly
+	boost::system::error_code error;
+	const boost::filesystem::file_status status = boost::filesystem::status(_path, error);
+	if (!boost::filesystem::exists(status))
+	{
+		return Result(Result::FILE_SYSTEM_ERROR, "The path is invalid", error ? error : boost::system::errc::make_error_code(boost::system::errc::no_such_file_or_directory));
+	}
+	else if (!boost::filesystem::is_regular_file(status))
+	{
+		return Result(Result::FILE_SYSTEM_ERROR, "The path is not a file", boost::filesystem::is_directory(status) ?
+			boost::system::errc::is_a_directory : boost::system::errc::invalid_argument);
+	}
+
+	const boost::uintmax_t size = boost::filesystem::file_size(_path, error);
+	if (error)
+	{
+		return Result(Result::FILE_SYSTEM_ERROR, "Could not read the file size", error);
+	}
+
+	return static_cast<unsigned long long>(size);
+}
+
 bool FileInfo::isAbsolute() const
 {
 	return _path.has_root_path();
@@ -116,6 +140,18 @@ bool FileInfo::isEmpty() const
 	}
 }
 
+Expected<bool> FileInfo::tryIsEmpty() const
+{
+	boost::system::error_code error;
+	const bool isEmpty = boost::filesystem::is_empty(_path, error);
+	if (error)
+	{
+		return Result(Result::FILE_SYSTEM_ERROR, "Could not check if the path is empty", error);
+	}
+
+	return isEmpty;
+}
+
 bool FileInfo::isHidden() const
 {
 	// It is not a hidden file if it isn't even a file
@@ -251,6 +287,18 @@ std::time_t FileInfo::modifiedDate() const
 	return boost::filesystem::last_write_time(_path);
 }
 
+Expected<std::time_t> FileInfo::tryModifiedDate() const
+{
+	boost::system::error_code error;
+	const std::time_t date = boost::filesystem::last_write_time(_path, error);
+	if (error)
+	{
+		return Result(Result::FILE_SYSTEM_ERROR, "Could not read the modified date", error);
+	}
+
+	return date;
+}
+
 void FileInfo::validatePath() const
 {
 	try
@@ -11,16 +11,95 @@
 #include <boost/foreach.hpp>
 
 // Bump headers
+#include <bump/Arena.h>
 #include <bump/FileSystem.h>
 #include <bump/FileSystemError.h>
 
 // C++ headers
+#include <algorithm>
+#include <cerrno>
 #include <fstream>
 
 namespace bump {
 
 namespace FileSystem {
 
+namespace {
+
+/** Creates a failed result from the error, or from the fallback when the operation failed without one. */
+Result failure(const char* description, const boost::system::error_code& error, boost::system::errc::errc_t fallback)
+{
+	if (error)
+	{
+		return Result(Result::FILE_SYSTEM_ERROR, description, error);
+	}
+
+	return Result(Result::FILE_SYSTEM_ERROR, description, fallback);
+}
+
+/** Checks whether the path is a directory or a file, reading its status only once. */
+Result checkType(const String& path, bool isDirectory, const char* description)
+{
+	boost::system::error_code error;
+	const boost::filesystem::file_status status = boost::filesystem::status(boost::filesystem::path(path.c_str()), error);
+	if (!boost::filesystem::exists(status))
+	{
+		return failure(description, error, boost::system::errc::no_such_file_or_directory);
+	}
+	else if (isDirectory && !boost::filesystem::is_directory(status))
+	{
+		return Result(Result::FILE_SYSTEM_ERROR, description, boost::system::errc::not_a_directory);
+	}
+	else if (!isDirectory && !boost::filesystem::is_regular_file(status))
+	{
+		return Result(Result::FILE_SYSTEM_ERROR, description, boost::filesystem::is_directory(status) ?
+			boost::system::errc::is_a_directory : boost::system::errc::invalid_argument);
+	}
+
+	return Result();
+}
+
+/** Appends a directory item path to an arena list. */
+void appendItem(ArenaStringList& items, const String& item)
+{
+	items.emplace_back(item.data(), item.size());
+}
+
+/** Appends a directory item path to a table. */
+void appendItem(StringTable& items, const String& item)
+{
+	items.append(item);
+}
+
+/** Appends the unix path of every item in the directory, in no particular order. */
+template <class List>
+void appendDirectoryItems(const String& path, List& items)
+{
+	// Throw an exception if the path does not exist
+	if (!FileInfo(path).exists())
+	{
+		String msg = String("The following path is not valid: %1").arg(path);
+		throw FileSystemError(msg, BUMP_LOCATION);
+	}
+
+	// Throw an exception if the path is not a directory
+	if (!FileInfo(path).isDirectory())
+	{
+		String msg = String("The following path is not a directory: %1").arg(path);
+		throw FileSystemError(msg, BUMP_LOCATION);
+	}
+
+	boost::filesystem::path directory_path(path.c_str());
+	boost::filesystem::directory_iterator iter(directory_path);
+	boost::filesystem::directory_iterator end_iter;
+	BOOST_FOREACH (const boost::filesystem::path& item, std::make_pair(iter, end_iter))
+	{
+		appendItem(items, convertToUnixPath(item.string()));
+	}
+}
+
+}	// End of anonymous namespace
+
 //====================================================================================
 //                               Path Coversion Methods
 //====================================================================================
@@ -221,77 +300,105 @@ bool isSymbolicLink(const String& path)
 
 bool createDirectory(const String& path)
 {
-	try
-	{
-		return boost::filesystem::create_directory(boost::filesystem::path(path.c_str()));
-	}
-	catch (const boost::filesystem::filesystem_error& /*e*/)
+	return tryCreateDirectory(path).isSuccess();
+}
+
+Result tryCreateDirectory(const String& path)
+{
+	boost::system::error_code error;
+	if (!boost::filesystem::create_directory(boost::filesystem::path(path.c_str()), error))
 	{
-		return false;
+		return failure("Could not create the directory", error, boost::system::errc::file_exists);
 	}
+
+	return Result();
 }
 
 bool createFullDirectoryPath(const String& path)
 {
-	return boost::filesystem::create_directories(boost::filesystem::path(path.c_str()));
+	return tryCreateFullDirectoryPath(path).isSuccess();
 }
 
-bool removeDirectory(const String& path)
+Result tryCreateFullDirectoryPath(const String& path)
 {
-	// Fail if the path is not a directory
-	if (!FileInfo(path).isDirectory())
+	boost::system::error_code error;
+	if (!boost::filesystem::create_directories(boost::filesystem::path(path.c_str()), error))
 	{
-		return false;
+		return failure("Could not create the directory path", error, boost::system::errc::file_exists);
 	}
 
-	try
+	return Result();
+}
+
+bool removeDirectory(const String& path)
+{
+	return tryRemoveDirectory(path).isSuccess();
+}
+
+Result tryRemoveDirectory(const String& path)
+{
+	// Fail if the path is not a directory
+	const Result result = checkType(path, true, "The path is not a directory");
+	if (result.isError())
 	{
-		return boost::filesystem::remove(boost::filesystem::path(path.c_str()));
+		return result;
 	}
-	catch (const boost::filesystem::filesystem_error& /*e*/)
+
+	boost::system::error_code error;
+	if (!boost::filesystem::remove(boost::filesystem::path(path.c_str()), error))
 	{
-		return false;
+		return failure("Could not remove the directory", error, boost::system::errc::no_such_file_or_directory);
 	}
+
+	return Result();
 }
 
 bool removeDirectoryAndContents(const String& path)
+{
+	return tryRemoveDirectoryAndContents(path).isSuccess();
+}
+
+Result tryRemoveDirectoryAndContents(const String& path)
 {
 	// Fail if the path is not a directory
-	if (!FileInfo(path).isDirectory())
+	const Result result = checkType(path, true, "The path is not a directory");
+	if (result.isError())
 	{
-		return false;
+		return result;
 	}
 
-	try
+	boost::system::error_code error;
+	boost::filesystem::remove_all(boost::filesystem::path(path.c_str()), error);
+	if (error)
 	{
-		boost::filesystem::remove_all(boost::filesystem::path(path.c_str()));
-		return true;
-	}
-	catch (const boost::filesystem::filesystem_error& /*e*/)
-	{
-		return false;
+		return Result(Result::FILE_SYSTEM_ERROR, "Could not remove the directory and its contents", error);
 	}
+
+	return Result();
 }
 
 bool copyDirectory(const String& source, const String& destination)
+{
+	return tryCopyDirectory(source, destination).isSuccess();
+}
+
+Result tryCopyDirectory(const String& source, const String& destination)
 {
 	// Fail if the source path is not a directory
-	if (!FileInfo(source).isDirectory())
+	const Result result = checkType(source, true, "The source path is not a directory");
+	if (result.isError())
 	{
-		return false;
+		return result;
 	}
 
-	try
+	boost::system::error_code error;
+	boost::filesystem::copy(boost::filesystem::path(source.c_str()), boost::filesystem::path(destination.c_str()), error);
+	if (error)
 	{
-		boost::filesystem::path source_path(source.c_str());
-		boost::filesystem::path destination_path(destination.c_str());
-		boost::filesystem::copy(source_path, destination_path);
-		return true;
-	}
-	catch (const boost::filesystem::filesystem_error& /*e*/)
-	{
-		return false;
+		return Result(Result::FILE_SYSTEM_ERROR, "Could not copy the directory", error);
 	}
+
+	return Result();
 }
 
 bool copyDirectoryAndContents(const String& source, const String& destination)
@@ -365,24 +472,27 @@ bool copyDirectoryAndContents(const String& source, const String& destination)
 }
 
 bool renameDirectory(const String& source, const String& destination)
+{
+	return tryRenameDirectory(source, destination).isSuccess();
+}
+
+Result tryRenameDirectory(const String& source, const String& destination)
 {
 	// Fail if the source path is not a directory
-	if (!FileInfo(source).isDirectory())
+	const Result result = checkType(source, true, "The source path is not a directory");
+	if (result.isError())
 	{
-		return false;
+		return result;
 	}
 
-	try
-	{
-		boost::filesystem::path source_path(source.c_str());
-		boost::filesystem::path destination_path(destination.c_str());
-		boost::filesystem::rename(source_path, destination_path);
-		return true;
-	}
-	catch (const boost::filesystem::filesystem_error& /*e*/)
+	boost::system::error_code error;
+	boost::filesystem::rename(boost::filesystem::path(source.c_str()), boost::filesystem::path(destination.c_str()), error);
+	if (error)
 	{
-		return false;
+		return Result(Result::FILE_SYSTEM_ERROR, "Could not rename the directory", error);
 	}
+
+	return Result();
 }
 
 StringList directoryList(const String& path)
@@ -424,6 +534,25 @@ StringList directoryList(const String& path)
 	return directory_list;
 }
 
+ArenaStringList directoryList(const String& path, MemoryResource* resource)
+{
+	// Collect the item paths straight into the arena, then sort them in place rather than through a set
+	ArenaStringList directory_list(resource);
+	appendDirectoryItems(path, directory_list);
+	std::sort(directory_list.begin(), directory_list.end());
+
+	return directory_list;
+}
+
+StringTable directoryTable(const String& path)
+{
+	StringTable directory_table;
+	appendDirectoryItems(path, directory_table);
+	directory_table.sort();
+
+	return directory_table;
+}
+
 FileInfoList directoryInfoList(const String& path)
 {
 	// Throw an exception if the path does not exist
@@ -469,73 +598,100 @@ FileInfoList directoryInfoList(const String& path)
 //====================================================================================
 
 bool createFile(const String& path)
+{
+	return tryCreateFile(path).isSuccess();
+}
+
+Result tryCreateFile(const String& path)
 {
 	// Make sure the file doesn't already exist
-	FileInfo path_info(path);
-	if (path_info.exists())
+	boost::system::error_code error;
+	if (boost::filesystem::exists(boost::filesystem::status(boost::filesystem::path(path.c_str()), error)))
 	{
-		return false;
+		return Result(Result::FILE_SYSTEM_ERROR, "The file already exists", boost::system::errc::file_exists);
 	}
 
 	// Create the file and close it
+	errno = 0;
 	std::ofstream stream(path.c_str());
-	bool success = !stream.fail();
-	stream.close();
+	if (stream.fail())
+	{
+		const boost::system::error_code cause(errno, boost::system::generic_category());
+		return failure("Could not create the file", cause, boost::system::errc::io_error);
+	}
 
-	return success;
+	return Result();
 }
 
 bool removeFile(const String& path)
+{
+	return tryRemoveFile(path).isSuccess();
+}
+
+Result tryRemoveFile(const String& path)
 {
 	// Fail if path is not a file
-	if (!FileInfo(path).isFile())
+	const Result result = checkType(path, false, "The path is not a file");
+	if (result.isError())
 	{
-		return false;
+		return result;
 	}
 
-	return boost::filesystem::remove(boost::filesystem::path(path.c_str()));
+	boost::system::error_code error;
+	if (!boost::filesystem::remove(boost::filesystem::path(path.c_str()), error))
+	{
+		return failure("Could not remove the file", error, boost::system::errc::no_such_file_or_directory);
+	}
+
+	return Result();
 }
 
 bool copyFile(const String& source, const String& destination)
 {
-	// Fail if source is not a file
-	if (!FileInfo(source).isFile())
-	{
-		return false;
-	}
+	return tryCopyFile(source, destination).isSuccess();
+}
 
-	try
+Result tryCopyFile(const String& source, const String& destination)
+{
+	// Fail if the source path is not a file
+	const Result result = checkType(source, false, "The source path is not a file");
+	if (result.isError())
 	{
-		boost::filesystem::path source_path(source.c_str());
-		boost::filesystem::path destination_path(destination.c_str());
-		boost::filesystem::copy(source_path, destination_path);
-		return true;
+		return result;
 	}
-	catch (const boost::filesystem::filesystem_error& /*e*/)
+
+	boost::system::error_code error;
+	boost::filesystem::copy(boost::filesystem::path(source.c_str()), boost::filesystem::path(destination.c_str()), error);
+	if (error)
 	{
-		return false;
+		return Result(Result::FILE_SYSTEM_ERROR, "Could not copy the file", error);
 	}
+
+	return Result();
 }
 
 bool renameFile(const String& source, const String& destination)
 {
-	// Fail if source is not a file
-	if (!FileInfo(source).isFile())
-	{
-		return false;
-	}
+	return tryRenameFile(source, destination).isSuccess();
+}
 
-	try
+Result tryRenameFile(const String& source, const String& destination)
+{
+	// Fail if the source path is not a file
+	const Result result = checkType(source, false, "The source path is not a file");
+	if (result.isError())
 	{
-		boost::filesystem::path source_path(source.c_str());
-		boost::filesystem::path destination_path(destination.c_str());
-		boost::filesystem::rename(source_path, destination_path);
-		return true;
+		return result;
 	}
-	catch (const boost::filesystem::filesystem_error& /*e*/)
+
+	boost::system::error_code error;
+	boost::filesystem::rename(boost::filesystem::path(source.c_str()), boost::filesystem::path(destination.c_str()), error);
+	if (error)
 	{
-		return false;
+		return Result(Result::FILE_SYSTEM_ERROR, "Could not rename the file", error);
 	}
+
+	return Result();
 }
 
 //====================================================================================
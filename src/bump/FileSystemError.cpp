@@ -11,7 +11,7 @@
 
 namespace bump {
 
-FileSystemError::FileSystemError(const String& description, const String& location) throw() :
+FileSystemError::FileSystemError(const String& description, const SourceLocation& location) throw() :
 	RuntimeError("bump::FileSystemError", description, location)
 {
 	;
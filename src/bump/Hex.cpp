@@ -0,0 +1,263 @@
+//
+//	Hex.cpp
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+// C++ headers
+#include <cstring>
+
+// Bump headers
+#include <bump/Hex.h>
+
+// Use the vectorized conversions when the target guarantees SSE2
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define BUMP_HEX_SSE2
+	#include <emmintrin.h>
+#endif
+
+namespace bump {
+
+namespace Hex {
+
+namespace {
+
+/** Converts a nibble to its lowercase hex digit. */
+inline char encodeNibble(unsigned char nibble)
+{
+	return "0123456789abcdef"[nibble];
+}
+
+/** Converts a hex digit to its nibble, returning -1 for anything else. */
+inline int decodeDigit(char digit)
+{
+	if (digit >= '0' && digit <= '9')
+	{
+		return digit - '0';
+	}
+	else if (digit >= 'a' && digit <= 'f')
+	{
+		return digit - 'a' + 10;
+	}
+	else if (digit >= 'A' && digit <= 'F')
+	{
+		return digit - 'A' + 10;
+	}
+
+	return -1;
+}
+
+#ifdef BUMP_HEX_SSE2
+
+/** Converts each nibble byte to its lowercase hex digit. */
+inline __m128i encodeNibbles(const __m128i nibbles)
+{
+	// '0' + nibble, plus the gap between '9' and 'a' for nibbles above 9
+	const __m128i letters = _mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9));
+	const __m128i digits = _mm_add_epi8(nibbles, _mm_set1_epi8('0'));
+	return _mm_add_epi8(digits, _mm_and_si128(letters, _mm_set1_epi8('a' - '0' - 10)));
+}
+
+/** Converts 16 hex digits to nibble bytes, clearing valid to false if any character is not a hex digit. */
+inline __m128i decodeDigits(const __m128i digits, bool& valid)
+{
+	// Characters above 127 are negative as signed bytes and fail both range checks
+	const __m128i isDigit = _mm_and_si128(_mm_cmpgt_epi8(digits, _mm_set1_epi8('0' - 1)),
+										  _mm_cmplt_epi8(digits, _mm_set1_epi8('9' + 1)));
+	const __m128i lower = _mm_or_si128(digits, _mm_set1_epi8(0x20));
+	const __m128i isLetter = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)),
+										   _mm_cmplt_epi8(lower, _mm_set1_epi8('f' + 1)));
+	if (_mm_movemask_epi8(_mm_or_si128(isDigit, isLetter)) != 0xffff)
+	{
+		valid = false;
+	}
+
+	const __m128i digitValues = _mm_and_si128(isDigit, _mm_sub_epi8(digits, _mm_set1_epi8('0')));
+	const __m128i letterValues = _mm_and_si128(isLetter, _mm_sub_epi8(lower, _mm_set1_epi8('a' - 10)));
+	const __m128i nibbles = _mm_or_si128(digitValues, letterValues);
+
+	// Each 16 bit word holds the high nibble in its low byte and the low nibble in its high byte
+	const __m128i high = _mm_slli_epi16(_mm_and_si128(nibbles, _mm_set1_epi16(0x00ff)), 4);
+	const __m128i low = _mm_srli_epi16(nibbles, 8);
+	return _mm_or_si128(high, low);
+}
+
+/** Builds a byte mask selecting the bytes from first to last inclusive. */
+inline __m128i byteRange(int first, int last)
+{
+	const __m128i indices = _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+	return _mm_and_si128(_mm_cmpgt_epi8(indices, _mm_set1_epi8((char) (first - 1))),
+						 _mm_cmplt_epi8(indices, _mm_set1_epi8((char) (last + 1))));
+}
+
+/** Encodes 16 bytes into two vectors holding the 32 hex digits. */
+inline void encodeVectors(const unsigned char* data, __m128i& first, __m128i& second)
+{
+	const __m128i lowMask = _mm_set1_epi8(0x0f);
+	const __m128i bytes = _mm_loadu_si128((const __m128i*) data);
+	const __m128i high = _mm_and_si128(_mm_srli_epi16(bytes, 4), lowMask);
+	const __m128i low = _mm_and_si128(bytes, lowMask);
+	first = encodeNibbles(_mm_unpacklo_epi8(high, low));
+	second = encodeNibbles(_mm_unpackhi_epi8(high, low));
+}
+
+#endif // BUMP_HEX_SSE2
+
+}	// End of anonymous namespace
+
+void encode(const unsigned char* data, unsigned int length, char* hex)
+{
+	unsigned int i = 0;
+
+#ifdef BUMP_HEX_SSE2
+	for (; i + 16 <= length; i += 16)
+	{
+		__m128i first;
+		__m128i second;
+		encodeVectors(data + i, first, second);
+		_mm_storeu_si128((__m128i*) (hex + 2 * i), first);
+		_mm_storeu_si128((__m128i*) (hex + 2 * i + 16), second);
+	}
+#endif
+
+	for (; i < length; ++i)
+	{
+		hex[2 * i] = encodeNibble(data[i] >> 4);
+		hex[2 * i + 1] = encodeNibble(data[i] & 0x0f);
+	}
+}
+
+String encode(const unsigned char* data, unsigned int length)
+{
+	String hex;
+	hex.resize(2 * length);
+	if (length > 0)
+	{
+		encode(data, length, &hex[0]);
+	}
+
+	return hex;
+}
+
+bool decode(const char* hex, unsigned int length, unsigned char* data)
+{
+	if (length % 2 != 0)
+	{
+		return false;
+	}
+
+	unsigned int i = 0;
+	bool valid = true;
+
+#ifdef BUMP_HEX_SSE2
+	for (; i + 32 <= length; i += 32)
+	{
+		const __m128i first = decodeDigits(_mm_loadu_si128((const __m128i*) (hex + i)), valid);
+		const __m128i second = decodeDigits(_mm_loadu_si128((const __m128i*) (hex + i + 16)), valid);
+		_mm_storeu_si128((__m128i*) (data + i / 2), _mm_packus_epi16(first, second));
+	}
+	if (!valid)
+	{
+		return false;
+	}
+#endif
+
+	for (; i < length; i += 2)
+	{
+		const int high = decodeDigit(hex[i]);
+		const int low = decodeDigit(hex[i + 1]);
+		if (high < 0 || low < 0)
+		{
+			return false;
+		}
+		data[i / 2] = (unsigned char) ((high << 4) | low);
+	}
+
+	return valid;
+}
+
+void encodeUuid(const unsigned char* data, char* chars)
+{
+#ifdef BUMP_HEX_SSE2
+	// Shift the digit groups into place and merge in the dashes, writing three overlapping vectors
+	__m128i digits0to15;
+	__m128i digits16to31;
+	encodeVectors(data, digits0to15, digits16to31);
+	const __m128i dashes = _mm_set1_epi8('-');
+
+	__m128i chars0to15 = _mm_and_si128(digits0to15, byteRange(0, 7));
+	chars0to15 = _mm_or_si128(chars0to15, _mm_and_si128(dashes, byteRange(8, 8)));
+	chars0to15 = _mm_or_si128(chars0to15, _mm_and_si128(_mm_slli_si128(digits0to15, 1), byteRange(9, 12)));
+	chars0to15 = _mm_or_si128(chars0to15, _mm_and_si128(dashes, byteRange(13, 13)));
+	chars0to15 = _mm_or_si128(chars0to15, _mm_and_si128(_mm_slli_si128(digits0to15, 2), byteRange(14, 15)));
+
+	__m128i chars16to31 = _mm_and_si128(_mm_srli_si128(digits0to15, 14), byteRange(0, 1));
+	chars16to31 = _mm_or_si128(chars16to31, _mm_and_si128(dashes, byteRange(2, 2)));
+	chars16to31 = _mm_or_si128(chars16to31, _mm_and_si128(_mm_slli_si128(digits16to31, 3), byteRange(3, 6)));
+	chars16to31 = _mm_or_si128(chars16to31, _mm_and_si128(dashes, byteRange(7, 7)));
+	chars16to31 = _mm_or_si128(chars16to31, _mm_and_si128(_mm_slli_si128(digits16to31, 4), byteRange(8, 15)));
+
+	__m128i chars20to35 = _mm_and_si128(_mm_srli_si128(digits16to31, 1), byteRange(0, 2));
+	chars20to35 = _mm_or_si128(chars20to35, _mm_and_si128(dashes, byteRange(3, 3)));
+	chars20to35 = _mm_or_si128(chars20to35, _mm_and_si128(digits16to31, byteRange(4, 15)));
+
+	_mm_storeu_si128((__m128i*) chars, chars0to15);
+	_mm_storeu_si128((__m128i*) (chars + 16), chars16to31);
+	_mm_storeu_si128((__m128i*) (chars + 20), chars20to35);
+#else
+	char digits[32];
+	encode(data, 16, digits);
+	std::memcpy(chars, digits, 8);
+	chars[8] = '-';
+	std::memcpy(chars + 9, digits + 8, 4);
+	chars[13] = '-';
+	std::memcpy(chars + 14, digits + 12, 4);
+	chars[18] = '-';
+	std::memcpy(chars + 19, digits + 16, 4);
+	chars[23] = '-';
+	std::memcpy(chars + 24, digits + 20, 12);
+#endif
+}
+
+bool decodeUuid(const char* chars, unsigned char* data)
+{
+	if (chars[8] != '-' || chars[13] != '-' || chars[18] != '-' || chars[23] != '-')
+	{
+		return false;
+	}
+
+#ifdef BUMP_HEX_SSE2
+	// Gather the digits around the dashes with overlapping loads of the input
+	const __m128i load0 = _mm_loadu_si128((const __m128i*) chars);
+	const __m128i load1 = _mm_loadu_si128((const __m128i*) (chars + 1));
+	const __m128i load2 = _mm_loadu_si128((const __m128i*) (chars + 2));
+	const __m128i load19 = _mm_loadu_si128((const __m128i*) (chars + 19));
+	const __m128i load20 = _mm_loadu_si128((const __m128i*) (chars + 20));
+
+	__m128i digits0to15 = _mm_and_si128(load0, byteRange(0, 7));
+	digits0to15 = _mm_or_si128(digits0to15, _mm_and_si128(load1, byteRange(8, 11)));
+	digits0to15 = _mm_or_si128(digits0to15, _mm_and_si128(load2, byteRange(12, 15)));
+	__m128i digits16to31 = _mm_and_si128(load19, byteRange(0, 3));
+	digits16to31 = _mm_or_si128(digits16to31, _mm_and_si128(load20, byteRange(4, 15)));
+
+	bool valid = true;
+	const __m128i first = decodeDigits(digits0to15, valid);
+	const __m128i second = decodeDigits(digits16to31, valid);
+	_mm_storeu_si128((__m128i*) data, _mm_packus_epi16(first, second));
+	return valid;
+#else
+	char digits[32];
+	std::memcpy(digits, chars, 8);
+	std::memcpy(digits + 8, chars + 9, 4);
+	std::memcpy(digits + 12, chars + 14, 4);
+	std::memcpy(digits + 16, chars + 19, 4);
+	std::memcpy(digits + 20, chars + 24, 12);
+	return decode(digits, 32, data);
+#endif
+}
+
+}	// End of Hex namespace
+
+}	// End of bump namespace
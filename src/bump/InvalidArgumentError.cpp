@@ -11,7 +11,7 @@
 
 namespace bump {
 
-InvalidArgumentError::InvalidArgumentError(const String& description, const String& location) throw() :
+InvalidArgumentError::InvalidArgumentError(const String& description, const SourceLocation& location) throw() :
 	LogicError("bump::InvalidArgumentError", description, location)
 {
 	;
@@ -0,0 +1,513 @@
+//
+//	LatencyHistogram.cpp
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+// C++ headers
+#include <algorithm>
+#include <map>
+
+// Boost headers
+#include <boost/atomic.hpp>
+#include <boost/chrono.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/tss.hpp>
+
+// Bump headers
+#include <bump/LatencyHistogram.h>
+#include <bump/Log.h>
+#include "ThreadLocal.h"
+
+#if defined(_MSC_VER)
+	#include <intrin.h>
+#endif
+
+namespace bump {
+
+namespace {
+
+// Typedefs
+typedef unsigned long long uint64;
+typedef std::map<uint64, void*> ShardMap;
+
+/**
+ * A thread's shards of every histogram, keyed by the histogram id. Each shard shares ownership of
+ * its thread's map, so a histogram can erase its id from the map even after the thread has exited.
+ */
+struct ThreadShards
+{
+	boost::mutex mutex;
+	ShardMap shards;
+};
+
+typedef boost::shared_ptr<ThreadShards> ThreadShardsPtr;
+
+// Every power of two range is split into 2^SUB_BUCKET_BITS sub-buckets
+const unsigned int SUB_BUCKET_BITS = 6;
+const uint64 SUB_BUCKET_COUNT = 1ULL << SUB_BUCKET_BITS;
+const std::size_t BUCKET_COUNT = (64 - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT;
+
+// The number of histograms each thread remembers its shard of without a thread_specific_ptr lookup
+const unsigned int SHARD_CACHE_SIZE = 8;
+
+// The source of the histogram ids, which are never reused so a cached shard can never be stale
+boost::atomic<uint64> gNextHistogramId(1);
+
+// Each thread's most recently used shards, indexed by the low bits of the histogram id
+BUMP_THREAD_LOCAL uint64 tCachedShardIds[SHARD_CACHE_SIZE];
+BUMP_THREAD_LOCAL void* tCachedShards[SHARD_CACHE_SIZE];
+
+/**
+ * Returns the calling thread's shards of every histogram.
+ *
+ * The ids are never reused, so a histogram created at the address of a destroyed one can never
+ * find a shard it does not own. The thread only releases its reference to the map when it exits,
+ * since the shards are owned by their histograms, which erase their ids when they are destroyed.
+ */
+const ThreadShardsPtr& threadShards()
+{
+	static boost::thread_specific_ptr<ThreadShardsPtr> shards;
+	ThreadShardsPtr* map = shards.get();
+	if (map == NULL)
+	{
+		map = new ThreadShardsPtr(new ThreadShards());
+		shards.reset(map);
+	}
+
+	return *map;
+}
+
+/** Returns the index of the highest set bit of a non-zero value. */
+inline unsigned int highestBit(uint64 value)
+{
+#if defined(__GNUC__)
+	return 63 - (unsigned int) __builtin_clzll(value);
+#elif defined(_MSC_VER) && defined(_M_X64)
+	unsigned long index;
+	_BitScanReverse64(&index, value);
+	return (unsigned int) index;
+#else
+	unsigned int index = 0;
+	while (value >>= 1)
+	{
+		++index;
+	}
+	return index;
+#endif
+}
+
+/** Returns the bucket a value is counted in. */
+inline std::size_t bucketIndex(uint64 value)
+{
+	if (value < SUB_BUCKET_COUNT)
+	{
+		return (std::size_t) value;
+	}
+
+	const unsigned int shift = highestBit(value) - SUB_BUCKET_BITS;
+	return (std::size_t) (((uint64) (shift + 1) << SUB_BUCKET_BITS) + ((value >> shift) - SUB_BUCKET_COUNT));
+}
+
+/** Returns the largest value counted in a bucket. */
+inline uint64 bucketUpperBound(std::size_t index)
+{
+	const unsigned int range = (unsigned int) (index >> SUB_BUCKET_BITS);
+	const uint64 subBucket = index & (SUB_BUCKET_COUNT - 1);
+	if (range == 0)
+	{
+		return subBucket;
+	}
+
+	const uint64 lowerBound = (SUB_BUCKET_COUNT + subBucket) << (range - 1);
+	return lowerBound + ((1ULL << (range - 1)) - 1);
+}
+
+/** Adds to a counter that only the calling thread writes, avoiding a locked read-modify-write. */
+inline void add(boost::atomic<uint64>& counter, uint64 value)
+{
+	counter.store(counter.load(boost::memory_order_relaxed) + value, boost::memory_order_relaxed);
+}
+
+// The periodic logging thread, defined before the registry so they outlive it
+boost::mutex gPeriodicLoggingMutex;
+boost::thread* gPeriodicLoggingThread = NULL;
+
+/** The registry of named histograms. */
+struct Registry
+{
+	~Registry()
+	{
+		// The periodic logging thread reads the histograms, so it must stop before they are deleted
+		LatencyHistogram::stopPeriodicLogging();
+
+		for (std::map<String, LatencyHistogram*>::iterator iter = histograms.begin(); iter != histograms.end(); ++iter)
+		{
+			delete iter->second;
+		}
+	}
+
+	boost::mutex mutex;
+	std::map<String, LatencyHistogram*> histograms;
+};
+
+Registry& registry()
+{
+	static Registry registry;
+	return registry;
+}
+
+/** Logs every histogram at a fixed interval until interrupted. */
+void logPeriodically(unsigned int intervalSeconds)
+{
+	try
+	{
+		while (true)
+		{
+			boost::this_thread::sleep_for(boost::chrono::seconds(intervalSeconds));
+			LatencyHistogram::logAll();
+		}
+	}
+	catch (const boost::thread_interrupted&)
+	{
+		// Stopped
+	}
+}
+
+}	// End of anonymous namespace
+
+//====================================================================================
+//                                       Shard
+//====================================================================================
+
+struct LatencyHistogram::Shard
+{
+	Shard()
+	{
+		clear();
+	}
+
+	/** Zeroes the counters, which only the owning thread may do once the shard is in use. */
+	void clear()
+	{
+		for (std::size_t i = 0; i < BUCKET_COUNT; ++i)
+		{
+			counts[i].store(0, boost::memory_order_relaxed);
+		}
+		count.store(0, boost::memory_order_relaxed);
+		sum.store(0, boost::memory_order_relaxed);
+		min.store(~0ULL, boost::memory_order_relaxed);
+		max.store(0, boost::memory_order_relaxed);
+		isCleared.store(false, boost::memory_order_release);
+	}
+
+	/** Returns whether reset() has marked the shard as empty since its owner last cleared it. */
+	bool isEmpty() const
+	{
+		return isCleared.load(boost::memory_order_acquire);
+	}
+
+	boost::atomic<bool> isCleared;
+	boost::atomic<uint64> counts[BUCKET_COUNT];
+	boost::atomic<uint64> count;
+	boost::atomic<uint64> sum;
+	boost::atomic<uint64> min;
+	boost::atomic<uint64> max;
+	ThreadShardsPtr owner;
+};
+
+//====================================================================================
+//                                  LatencyHistogram
+//====================================================================================
+
+// The shards are owned by the histogram rather than the threads, so they keep their samples after
+// a thread exits
+LatencyHistogram::LatencyHistogram(const String& name) :
+	_name(name),
+	_id(gNextHistogramId.fetch_add(1, boost::memory_order_relaxed))
+{
+	;
+}
+
+LatencyHistogram::~LatencyHistogram()
+{
+	for (std::size_t i = 0; i < _shards.size(); ++i)
+	{
+		ThreadShards& owner = *_shards[i]->owner;
+		{
+			boost::mutex::scoped_lock lock(owner.mutex);
+			owner.shards.erase(_id);
+		}
+		delete _shards[i];
+	}
+}
+
+LatencyHistogram* LatencyHistogram::named(const String& name)
+{
+	Registry& histograms = registry();
+	boost::mutex::scoped_lock lock(histograms.mutex);
+	LatencyHistogram*& histogram = histograms.histograms[name];
+	if (histogram == NULL)
+	{
+		histogram = new LatencyHistogram(name);
+	}
+
+	return histogram;
+}
+
+void LatencyHistogram::logAll()
+{
+	Registry& histograms = registry();
+	boost::mutex::scoped_lock lock(histograms.mutex);
+	std::map<String, LatencyHistogram*>::const_iterator iter;
+	for (iter = histograms.histograms.begin(); iter != histograms.histograms.end(); ++iter)
+	{
+		if (iter->second->count() > 0)
+		{
+			bumpINFO_P("LatencyHistogram: ", iter->first + " " + iter->second->summary());
+		}
+	}
+}
+
+void LatencyHistogram::startPeriodicLogging(unsigned int intervalSeconds)
+{
+	// Create the registry first, so its destructor stops the thread at exit
+	registry();
+	stopPeriodicLogging();
+
+	boost::mutex::scoped_lock lock(gPeriodicLoggingMutex);
+	gPeriodicLoggingThread = new boost::thread(logPeriodically, intervalSeconds);
+}
+
+void LatencyHistogram::stopPeriodicLogging()
+{
+	boost::mutex::scoped_lock lock(gPeriodicLoggingMutex);
+	if (gPeriodicLoggingThread != NULL)
+	{
+		gPeriodicLoggingThread->interrupt();
+		gPeriodicLoggingThread->join();
+		delete gPeriodicLoggingThread;
+		gPeriodicLoggingThread = NULL;
+	}
+}
+
+const String& LatencyHistogram::name() const
+{
+	return _name;
+}
+
+void LatencyHistogram::record(unsigned long long nanoseconds)
+{
+	Shard* shard = threadShard();
+	add(shard->counts[bucketIndex(nanoseconds)], 1);
+	add(shard->count, 1);
+	add(shard->sum, nanoseconds);
+	if (nanoseconds < shard->min.load(boost::memory_order_relaxed))
+	{
+		shard->min.store(nanoseconds, boost::memory_order_relaxed);
+	}
+	if (nanoseconds > shard->max.load(boost::memory_order_relaxed))
+	{
+		shard->max.store(nanoseconds, boost::memory_order_relaxed);
+	}
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& histogram)
+{
+	Totals other;
+	histogram.totals(other);
+	if (other.count == 0)
+	{
+		return;
+	}
+
+	// Only the calling thread writes its shard, so the samples can be added without locking
+	Shard* shard = threadShard();
+	for (std::size_t i = 0; i < BUCKET_COUNT; ++i)
+	{
+		if (other.counts[i] > 0)
+		{
+			add(shard->counts[i], other.counts[i]);
+		}
+	}
+	add(shard->count, other.count);
+	add(shard->sum, other.sum);
+	if (other.min < shard->min.load(boost::memory_order_relaxed))
+	{
+		shard->min.store(other.min, boost::memory_order_relaxed);
+	}
+	if (other.max > shard->max.load(boost::memory_order_relaxed))
+	{
+		shard->max.store(other.max, boost::memory_order_relaxed);
+	}
+}
+
+void LatencyHistogram::reset()
+{
+	boost::mutex::scoped_lock lock(_shardsMutex);
+	for (std::size_t i = 0; i < _shards.size(); ++i)
+	{
+		_shards[i]->isCleared.store(true, boost::memory_order_release);
+	}
+}
+
+unsigned long long LatencyHistogram::count() const
+{
+	boost::mutex::scoped_lock lock(_shardsMutex);
+	uint64 count = 0;
+	for (std::size_t i = 0; i < _shards.size(); ++i)
+	{
+		if (!_shards[i]->isEmpty())
+		{
+			count += _shards[i]->count.load(boost::memory_order_relaxed);
+		}
+	}
+
+	return count;
+}
+
+unsigned long long LatencyHistogram::min() const
+{
+	Totals histogramTotals;
+	totals(histogramTotals);
+	return histogramTotals.min;
+}
+
+unsigned long long LatencyHistogram::max() const
+{
+	Totals histogramTotals;
+	totals(histogramTotals);
+	return histogramTotals.max;
+}
+
+double LatencyHistogram::mean() const
+{
+	Totals histogramTotals;
+	totals(histogramTotals);
+	return histogramTotals.count == 0 ? 0.0 : double(histogramTotals.sum) / double(histogramTotals.count);
+}
+
+unsigned long long LatencyHistogram::percentile(double percentile) const
+{
+	Totals histogramTotals;
+	totals(histogramTotals);
+	return LatencyHistogram::percentile(histogramTotals, percentile);
+}
+
+String LatencyHistogram::summary() const
+{
+	Totals histogramTotals;
+	totals(histogramTotals);
+
+	String summary = "count=" + String(histogramTotals.count);
+	summary += " min=" + String(histogramTotals.min);
+	summary += " p50=" + String(percentile(histogramTotals, 50.0));
+	summary += " p90=" + String(percentile(histogramTotals, 90.0));
+	summary += " p99=" + String(percentile(histogramTotals, 99.0));
+	summary += " p999=" + String(percentile(histogramTotals, 99.9));
+	summary += " max=" + String(histogramTotals.max);
+	summary += " (ns)";
+
+	return summary;
+}
+
+LatencyHistogram::Shard* LatencyHistogram::threadShard()
+{
+	Shard* shard = NULL;
+	const unsigned int slot = (unsigned int) (_id & (SHARD_CACHE_SIZE - 1));
+	if (tCachedShardIds[slot] == _id)
+	{
+		shard = static_cast<Shard*>(tCachedShards[slot]);
+	}
+	else
+	{
+		// Only this thread inserts into its map, but destroyed histograms erase from it
+		const ThreadShardsPtr& owner = threadShards();
+		boost::mutex::scoped_lock ownerLock(owner->mutex);
+		void*& mappedShard = owner->shards[_id];
+		if (mappedShard == NULL)
+		{
+			Shard* newShard = new Shard();
+			newShard->owner = owner;
+			mappedShard = newShard;
+
+			boost::mutex::scoped_lock lock(_shardsMutex);
+			_shards.push_back(newShard);
+		}
+
+		shard = static_cast<Shard*>(mappedShard);
+		tCachedShardIds[slot] = _id;
+		tCachedShards[slot] = shard;
+	}
+
+	// Finish a reset() here, on the only thread that writes the shard's counters
+	if (shard->isCleared.load(boost::memory_order_relaxed))
+	{
+		shard->clear();
+	}
+
+	return shard;
+}
+
+void LatencyHistogram::totals(Totals& totals) const
+{
+	totals.counts.assign(BUCKET_COUNT, 0);
+	totals.count = 0;
+	totals.sum = 0;
+	totals.min = ~0ULL;
+	totals.max = 0;
+
+	boost::mutex::scoped_lock lock(_shardsMutex);
+	for (std::size_t i = 0; i < _shards.size(); ++i)
+	{
+		const Shard& shard = *_shards[i];
+		if (shard.isEmpty())
+		{
+			continue;
+		}
+
+		for (std::size_t j = 0; j < BUCKET_COUNT; ++j)
+		{
+			totals.counts[j] += shard.counts[j].load(boost::memory_order_relaxed);
+		}
+		totals.count += shard.count.load(boost::memory_order_relaxed);
+		totals.sum += shard.sum.load(boost::memory_order_relaxed);
+		totals.min = std::min(totals.min, shard.min.load(boost::memory_order_relaxed));
+		totals.max = std::max(totals.max, shard.max.load(boost::memory_order_relaxed));
+	}
+
+	if (totals.count == 0)
+	{
+		totals.min = 0;
+	}
+}
+
+unsigned long long LatencyHistogram::percentile(const Totals& totals, double percentile)
+{
+	if (totals.count == 0)
+	{
+		return 0;
+	}
+
+	// The rank of the sample at the percentile, rounded up so p100 is the largest sample
+	uint64 rank = (uint64) (percentile / 100.0 * totals.count + 0.9999999);
+	rank = std::max<uint64>(1, std::min<uint64>(rank, totals.count));
+
+	uint64 seen = 0;
+	for (std::size_t i = 0; i < BUCKET_COUNT; ++i)
+	{
+		seen += totals.counts[i];
+		if (seen >= rank)
+		{
+			// Report the top of the bucket, but never beyond the recorded extremes
+			return std::max(totals.min, std::min(bucketUpperBound(i), totals.max));
+		}
+	}
+
+	return totals.max;
+}
+
+}	// End of bump namespace
@@ -14,6 +14,7 @@
 
 // Bump headers
 #include <bump/Environment.h>
+#include <bump/EnvironmentSetting.h>
 #include <bump/Log.h>
 
 namespace bump {
@@ -21,6 +22,29 @@ namespace bump {
 // Global singleton mutex
 static boost::mutex gLogSingletonMutex;
 
+/** Returns the setting read from the "BUMP_LOG_ENABLED" environment variable. */
+static const BoolSetting& logEnabledSetting()
+{
+	static const BoolSetting setting(BUMP_LOG_ENABLED, true, "Whether the log is enabled");
+	return setting;
+}
+
+/** Returns the setting read from the "BUMP_LOG_LEVEL" environment variable. */
+static const EnumSetting& logLevelSetting()
+{
+	static const EnumSetting::Choice choices[] =
+	{
+		{ "ALWAYS_LVL", Log::ALWAYS_LVL },
+		{ "ERROR_LVL", Log::ERROR_LVL },
+		{ "WARNING_LVL", Log::WARNING_LVL },
+		{ "INFO_LVL", Log::INFO_LVL },
+		{ "DEBUG_LVL", Log::DEBUG_LVL }
+	};
+	static const EnumSetting setting(BUMP_LOG_LEVEL, choices, sizeof(choices) / sizeof(choices[0]), Log::WARNING_LVL,
+		"The maximum output level of the log");
+	return setting;
+}
+
 Log::Log() :
 	_isEnabled(true),
 	_logLevel(WARNING_LVL),
@@ -31,51 +55,19 @@ Log::Log() :
 	_convenienceFunctionMutex()
 {
 	// Attempt to disable the entire log system based on the "BUMP_LOG_ENABLED" environment variable
-	String logEnabled = bump::Environment::environmentVariable(BUMP_LOG_ENABLED);
-	logEnabled.toLowerCase();
-	if (logEnabled == "no" || logEnabled == "false" || logEnabled == "nope" || logEnabled == "disable")
+	if (!logEnabledSetting().value())
 	{
 		_isEnabled = false;
 		std::cout << "[bump] Setting LOG_ENABLED to NO" << std::endl;
 		return;
 	}
 
-	// Attempt to set the log level based on the "BUMP_LOG_LEVEL" environment variable
-	String logLevel = bump::Environment::environmentVariable(BUMP_LOG_LEVEL);
-	if (logLevel == "ALWAYS_LVL")
-	{
-		_logLevel = ALWAYS_LVL;
-		std::cout << "[bump] Setting BUMP_LOG_LEVEL to ALWAYS" << std::endl;
-	}
-	else if (logLevel == "ERROR_LVL")
-	{
-		_logLevel = ERROR_LVL;
-		std::cout << "[bump] Setting BUMP_LOG_LEVEL to ERROR" << std::endl;
-	}
-	else if (logLevel == "WARNING_LVL")
-	{
-		_logLevel = WARNING_LVL;
-		std::cout << "[bump] Setting BUMP_LOG_LEVEL to WARNING" << std::endl;
-	}
-	else if (logLevel == "INFO_LVL")
-	{
-		_logLevel = INFO_LVL;
-		std::cout << "[bump] Setting BUMP_LOG_LEVEL to INFO" << std::endl;
-	}
-	else if (logLevel == "DEBUG_LVL")
-	{
-		_logLevel = DEBUG_LVL;
-		std::cout << "[bump] Setting BUMP_LOG_LEVEL to DEBUG" << std::endl;
-	}
-	else if (!logLevel.empty())
-	{
-		std::cout << "[bump] WARNING: Your BUMP_LOG_LEVEL environment variable: [" << logLevel
-			<< "] does not match any of the possible options: [ ALWAYS_LVL | ERROR_LVL | WARNING_LVL "
-			<< "| INFO_LVL | DEBUG_LVL ]" << std::endl;
-	}
-	else
+	// Attempt to set the log level based on the "BUMP_LOG_LEVEL" environment variable. It is copied
+	// once since setLogLevel() may change it, so EnvironmentSetting::reloadAll() does not affect it.
+	if (logLevelSetting().isSet())
 	{
-		// DO NOTHING
+		_logLevel = static_cast<LogLevel>(logLevelSetting().value());
+		std::cout << "[bump] Setting BUMP_LOG_LEVEL to " << logLevelSetting().toString() << std::endl;
 	}
 
 	// Attempt to set the log file based on the "BUMP_LOG_FILE" environment variable
@@ -11,7 +11,7 @@
 
 namespace bump {
 
-NotImplementedError::NotImplementedError(const String& description, const String& location) throw() :
+NotImplementedError::NotImplementedError(const String& description, const SourceLocation& location) throw() :
 	RuntimeError("bump::NotImplementedError", description, location)
 {
 	;
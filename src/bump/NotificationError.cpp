@@ -11,7 +11,7 @@
 
 namespace bump {
 
-NotificationError::NotificationError(const String& description, const String& location) throw() :
+NotificationError::NotificationError(const String& description, const SourceLocation& location) throw() :
 	RuntimeError("bump::NotificationError", description, location)
 {
 	;
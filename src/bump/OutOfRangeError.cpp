@@ -11,7 +11,7 @@
 
 namespace bump {
 
-OutOfRangeError::OutOfRangeError(const String& description, const String& location) throw() :
+OutOfRangeError::OutOfRangeError(const String& description, const SourceLocation& location) throw() :
 	RuntimeError("bump::OutOfRangeError", description, location)
 {
 	;
@@ -0,0 +1,471 @@
+//
+//	Profiler.cpp
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+// C++ headers
+#include <algorithm>
+#include <iomanip>
+#include <map>
+#include <sstream>
+
+// Boost headers
+#include <boost/atomic.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/tss.hpp>
+
+// Bump headers
+#include <bump/Log.h>
+#include <bump/Profiler.h>
+#include "ThreadLocal.h"
+
+namespace bump {
+
+//====================================================================================
+//                                        Node
+//====================================================================================
+
+struct Profiler::Node
+{
+	const char*							name;					/**< @internal The name of the scope. */
+	std::size_t							index;					/**< @internal The index of the node in its tree. */
+	Node*								parent;					/**< @internal The enclosing scope. */
+	Node*								firstChild;				/**< @internal The first nested scope. */
+	Node*								nextSibling;			/**< @internal The next scope with the same parent. */
+	boost::atomic<unsigned long long>	calls;					/**< @internal The number of times the scope was left. */
+	boost::atomic<unsigned long long>	inclusiveNanoseconds;	/**< @internal The time spent in the scope. */
+	boost::atomic<unsigned long long>	childNanoseconds;		/**< @internal The time spent in nested scopes. */
+};
+
+namespace {
+
+// Typedefs
+typedef unsigned long long uint64;
+
+// Each call tree allocates its nodes in blocks which never move, up to a fixed number of blocks
+const std::size_t BLOCK_SIZE = 1024;
+const std::size_t BLOCK_COUNT = 256;
+
+/** Adds to a counter that only the calling thread writes, avoiding a locked read-modify-write. */
+inline void add(boost::atomic<uint64>& counter, uint64 value)
+{
+	counter.store(counter.load(boost::memory_order_relaxed) + value, boost::memory_order_relaxed);
+}
+
+/** The call tree of a thread. Only the owning thread creates nodes and writes to them. */
+struct ThreadTree
+{
+	ThreadTree() :
+		count(0),
+		current(NULL),
+		isCleared(false)
+	{
+		std::fill(blocks, blocks + BLOCK_COUNT, (Profiler::Node*) NULL);
+		current = create("", NULL);
+	}
+
+	~ThreadTree()
+	{
+		for (std::size_t i = 0; i < BLOCK_COUNT; ++i)
+		{
+			delete [] blocks[i];
+		}
+	}
+
+	Profiler::Node* node(std::size_t index) const
+	{
+		return &blocks[index / BLOCK_SIZE][index % BLOCK_SIZE];
+	}
+
+	/** Creates a node and publishes it to readers, or returns NULL when the tree is full. */
+	Profiler::Node* create(const char* name, Profiler::Node* parent)
+	{
+		const std::size_t index = count.load(boost::memory_order_relaxed);
+		if (index == BLOCK_SIZE * BLOCK_COUNT)
+		{
+			return NULL;
+		}
+		else if (index % BLOCK_SIZE == 0)
+		{
+			blocks[index / BLOCK_SIZE] = new Profiler::Node[BLOCK_SIZE];
+		}
+
+		Profiler::Node* newNode = node(index);
+		newNode->name = name;
+		newNode->index = index;
+		newNode->parent = parent;
+		newNode->firstChild = NULL;
+		newNode->nextSibling = NULL;
+		newNode->calls.store(0, boost::memory_order_relaxed);
+		newNode->inclusiveNanoseconds.store(0, boost::memory_order_relaxed);
+		newNode->childNanoseconds.store(0, boost::memory_order_relaxed);
+
+		// Readers only look at the nodes below the count, so they see the node fully written
+		count.store(index + 1, boost::memory_order_release);
+
+		return newNode;
+	}
+
+	/** Zeroes the counters of every node, which only the owning thread may do. */
+	void clear()
+	{
+		const std::size_t nodeCount = count.load(boost::memory_order_relaxed);
+		for (std::size_t i = 0; i < nodeCount; ++i)
+		{
+			Profiler::Node& cleared = *node(i);
+			cleared.calls.store(0, boost::memory_order_relaxed);
+			cleared.inclusiveNanoseconds.store(0, boost::memory_order_relaxed);
+			cleared.childNanoseconds.store(0, boost::memory_order_relaxed);
+		}
+
+		isCleared.store(false, boost::memory_order_release);
+	}
+
+	Profiler::Node*				blocks[BLOCK_COUNT];	/**< The blocks of nodes, the first of which is the root. */
+	boost::atomic<std::size_t>	count;					/**< The number of nodes published to readers. */
+	Profiler::Node*				current;				/**< The innermost scope the thread is in. */
+	boost::atomic<bool>			isCleared;				/**< Whether reset() has cleared the tree since the owner last zeroed it. */
+};
+
+void retireTree(ThreadTree* tree);
+
+/**
+ * The call trees of every running thread that has entered a scope, along with the merged samples
+ * of the threads that have exited. The retired tree is only touched with the mutex held.
+ */
+struct Registry
+{
+	Registry() :
+		mutex(),
+		trees(),
+		retired(),
+		owners(retireTree)
+	{
+		;
+	}
+
+	boost::mutex							mutex;
+	std::vector<ThreadTree*>				trees;
+	ThreadTree								retired;
+	boost::thread_specific_ptr<ThreadTree>	owners;
+};
+
+/**
+ * Returns the registry, which is leaked on purpose. Threads such as the shared Executor's workers
+ * may still record or exit during static destruction, so neither the registry nor the live trees
+ * are ever destroyed at exit.
+ */
+Registry& registry()
+{
+	static Registry* registry = new Registry();
+	return *registry;
+}
+
+// The call tree of the calling thread
+BUMP_THREAD_LOCAL ThreadTree* tThreadTree = NULL;
+
+/** Adds the samples of a tree into the retired tree, matching scopes the way enter() does. */
+void mergeInto(ThreadTree& retired, const ThreadTree& tree)
+{
+	const std::size_t count = tree.count.load(boost::memory_order_acquire);
+	std::vector<Profiler::Node*> mergedNodes(count, (Profiler::Node*) NULL);
+	mergedNodes[0] = retired.node(0);
+	for (std::size_t i = 1; i < count; ++i)
+	{
+		// Scopes whose parent did not fit in the retired tree are dropped with it
+		const Profiler::Node& node = *tree.node(i);
+		Profiler::Node* parent = mergedNodes[node.parent->index];
+		if (parent == NULL)
+		{
+			continue;
+		}
+
+		Profiler::Node* merged = parent->firstChild;
+		while (merged != NULL && merged->name != node.name)
+		{
+			merged = merged->nextSibling;
+		}
+		if (merged == NULL)
+		{
+			merged = retired.create(node.name, parent);
+			if (merged == NULL)
+			{
+				continue;
+			}
+
+			merged->nextSibling = parent->firstChild;
+			parent->firstChild = merged;
+		}
+
+		add(merged->calls, node.calls.load(boost::memory_order_relaxed));
+		add(merged->inclusiveNanoseconds, node.inclusiveNanoseconds.load(boost::memory_order_relaxed));
+		add(merged->childNanoseconds, node.childNanoseconds.load(boost::memory_order_relaxed));
+		mergedNodes[i] = merged;
+	}
+}
+
+/** Folds the call tree of an exiting thread into the retired tree and frees it. */
+void retireTree(ThreadTree* tree)
+{
+	Registry& trees = registry();
+	boost::mutex::scoped_lock lock(trees.mutex);
+	trees.trees.erase(std::remove(trees.trees.begin(), trees.trees.end(), tree), trees.trees.end());
+	if (!tree->isCleared.load(boost::memory_order_acquire))
+	{
+		mergeInto(trees.retired, *tree);
+	}
+
+	delete tree;
+	tThreadTree = NULL;
+}
+
+/** The call trees of every thread merged by the names of their scopes. */
+struct MergedNode
+{
+	String						name;
+	uint64						calls;
+	uint64						inclusiveNanoseconds;
+	uint64						childNanoseconds;
+	std::vector<std::size_t>	children;
+};
+
+/** Orders merged nodes by decreasing inclusive time. */
+struct InclusiveGreater
+{
+	InclusiveGreater(const std::vector<MergedNode>& nodes) : nodes(nodes) {}
+
+	bool operator()(std::size_t lhs, std::size_t rhs) const
+	{
+		return nodes[lhs].inclusiveNanoseconds > nodes[rhs].inclusiveNanoseconds;
+	}
+
+	const std::vector<MergedNode>& nodes;
+};
+
+/** Appends a merged node and its children in depth-first order, skipping scopes that never finished. */
+void appendEntries(std::vector<MergedNode>& nodes, std::size_t index, unsigned int depth, std::vector<Profiler::Entry>& entries)
+{
+	MergedNode& node = nodes[index];
+	const std::size_t first = entries.size();
+
+	Profiler::Entry entry;
+	entry.name = node.name;
+	entry.depth = depth;
+	entry.calls = node.calls;
+	entry.inclusiveNanoseconds = node.inclusiveNanoseconds;
+	entry.exclusiveNanoseconds = node.inclusiveNanoseconds > node.childNanoseconds ? node.inclusiveNanoseconds - node.childNanoseconds : 0;
+	entries.push_back(entry);
+
+	std::sort(node.children.begin(), node.children.end(), InclusiveGreater(nodes));
+	for (std::size_t i = 0; i < node.children.size(); ++i)
+	{
+		appendEntries(nodes, node.children[i], depth + 1, entries);
+	}
+
+	// Keep scopes that are still open when they enclose finished ones
+	if (node.calls == 0 && entries.size() == first + 1)
+	{
+		entries.pop_back();
+	}
+}
+
+}	// End of anonymous namespace
+
+//====================================================================================
+//                                      Profiler
+//====================================================================================
+
+std::vector<Profiler::Entry> Profiler::entries()
+{
+	// The root of every tree merges into the first node
+	std::vector<MergedNode> mergedNodes(1);
+	mergedNodes[0].calls = 0;
+	mergedNodes[0].inclusiveNanoseconds = 0;
+	mergedNodes[0].childNanoseconds = 0;
+	std::map<std::pair<std::size_t, String>, std::size_t> lookup;
+
+	Registry& trees = registry();
+	boost::mutex::scoped_lock lock(trees.mutex);
+	for (std::size_t i = 0; i <= trees.trees.size(); ++i)
+	{
+		const ThreadTree& tree = i < trees.trees.size() ? *trees.trees[i] : trees.retired;
+		if (tree.isCleared.load(boost::memory_order_acquire))
+		{
+			continue;
+		}
+		const std::size_t count = tree.count.load(boost::memory_order_acquire);
+
+		// Parents are always created before their children, so they are merged first
+		std::vector<std::size_t> mergedIndices(count, 0);
+		for (std::size_t j = 1; j < count; ++j)
+		{
+			const Node& node = *tree.node(j);
+			const std::size_t mergedParent = mergedIndices[node.parent->index];
+			const std::pair<std::size_t, String> key(mergedParent, String(node.name));
+
+			std::map<std::pair<std::size_t, String>, std::size_t>::iterator iter = lookup.find(key);
+			if (iter == lookup.end())
+			{
+				MergedNode newNode;
+				newNode.name = key.second;
+				newNode.calls = 0;
+				newNode.inclusiveNanoseconds = 0;
+				newNode.childNanoseconds = 0;
+				mergedNodes.push_back(newNode);
+				mergedNodes[mergedParent].children.push_back(mergedNodes.size() - 1);
+				iter = lookup.insert(std::make_pair(key, mergedNodes.size() - 1)).first;
+			}
+
+			MergedNode& merged = mergedNodes[iter->second];
+			merged.calls += node.calls.load(boost::memory_order_relaxed);
+			merged.inclusiveNanoseconds += node.inclusiveNanoseconds.load(boost::memory_order_relaxed);
+			merged.childNanoseconds += node.childNanoseconds.load(boost::memory_order_relaxed);
+			mergedIndices[j] = iter->second;
+		}
+	}
+	lock.unlock();
+
+	std::vector<Entry> entries;
+	std::sort(mergedNodes[0].children.begin(), mergedNodes[0].children.end(), InclusiveGreater(mergedNodes));
+	for (std::size_t i = 0; i < mergedNodes[0].children.size(); ++i)
+	{
+		appendEntries(mergedNodes, mergedNodes[0].children[i], 0, entries);
+	}
+
+	return entries;
+}
+
+String Profiler::report()
+{
+	const std::vector<Entry> scopes = entries();
+	if (scopes.empty())
+	{
+		return String();
+	}
+
+	std::ostringstream stream;
+	stream << std::fixed << std::setprecision(3);
+	stream << std::setw(16) << "Inclusive (ms)" << std::setw(16) << "Exclusive (ms)" << std::setw(12) << "Calls" << "  Scope";
+	for (std::size_t i = 0; i < scopes.size(); ++i)
+	{
+		const Entry& scope = scopes[i];
+		stream << "\n";
+		stream << std::setw(16) << scope.inclusiveNanoseconds / 1.0e6;
+		stream << std::setw(16) << scope.exclusiveNanoseconds / 1.0e6;
+		stream << std::setw(12) << scope.calls;
+		stream << "  " << std::string(scope.depth * 2, ' ') << scope.name;
+	}
+
+	return stream.str();
+}
+
+void Profiler::log()
+{
+	const StringList lines = report().split("\n");
+	for (StringList::const_iterator iter = lines.begin(); iter != lines.end(); ++iter)
+	{
+		if (!iter->empty())
+		{
+			bumpINFO_P("Profiler: ", *iter);
+		}
+	}
+}
+
+void Profiler::reset()
+{
+	Registry& trees = registry();
+	boost::mutex::scoped_lock lock(trees.mutex);
+	for (std::size_t i = 0; i < trees.trees.size(); ++i)
+	{
+		trees.trees[i]->isCleared.store(true, boost::memory_order_release);
+	}
+
+	// The retired tree is only written with the mutex held, so it is zeroed right away
+	trees.retired.clear();
+}
+
+Profiler::Node* Profiler::enter(const char* name)
+{
+	ThreadTree* tree = tThreadTree;
+	if (tree == NULL)
+	{
+		tree = new ThreadTree();
+		tThreadTree = tree;
+
+		// The thread specific pointer retires the tree when the thread exits
+		Registry& trees = registry();
+		trees.owners.reset(tree);
+		boost::mutex::scoped_lock lock(trees.mutex);
+		trees.trees.push_back(tree);
+	}
+
+	// Finish a reset() here, on the only thread that writes the tree's counters
+	if (tree->isCleared.load(boost::memory_order_relaxed))
+	{
+		tree->clear();
+	}
+
+	// Scopes are usually entered from the same few places, so the list of children stays short
+	Node* parent = tree->current;
+	Node* node = parent->firstChild;
+	while (node != NULL && node->name != name)
+	{
+		node = node->nextSibling;
+	}
+
+	if (node == NULL)
+	{
+		node = tree->create(name, parent);
+		if (node == NULL)
+		{
+			return NULL;
+		}
+
+		node->nextSibling = parent->firstChild;
+		parent->firstChild = node;
+	}
+
+	tree->current = node;
+	return node;
+}
+
+void Profiler::leave(Node* node, unsigned long long nanoseconds)
+{
+	if (node == NULL)
+	{
+		return;
+	}
+
+	// Finish a reset() before adding, so the counters it cleared are never written back
+	ThreadTree* tree = tThreadTree;
+	if (tree->isCleared.load(boost::memory_order_relaxed))
+	{
+		tree->clear();
+	}
+
+	add(node->calls, 1);
+	add(node->inclusiveNanoseconds, nanoseconds);
+	add(node->parent->childNanoseconds, nanoseconds);
+	tree->current = node->parent;
+}
+
+//====================================================================================
+//                                    ProfileScope
+//====================================================================================
+
+ProfileScope::ProfileScope(const char* name) :
+	_node(Profiler::enter(name)),
+	_timer(Timer::TIME_STAMP_COUNTER)
+{
+	;
+}
+
+ProfileScope::~ProfileScope()
+{
+	Profiler::leave(_node, _timer.elapsedNanoseconds());
+}
+
+}	// End of bump namespace
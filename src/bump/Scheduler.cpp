@@ -0,0 +1,594 @@
+//
+//	Scheduler.cpp
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+// C++ headers
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <limits>
+
+// Boost headers
+#include <boost/bind.hpp>
+#include <boost/chrono.hpp>
+
+// Bump headers
+#include <bump/Exception.h>
+#include <bump/InvalidArgumentError.h>
+#include <bump/Log.h>
+#include <bump/NotificationCenter.h>
+#include <bump/Scheduler.h>
+#include <bump/Timeline.h>
+
+namespace bump {
+
+namespace {
+
+//====================================================================================
+//                                       Wheels
+//====================================================================================
+
+// The finest wheel has a slot per tick, and each coarser wheel has a slot per turn of the
+// wheel below it. Together they cover 2^32 ticks, which is about 50 days at 1 ms a tick.
+// Callbacks due further away wait in the last slot of the coarsest wheel.
+const boost::uint32_t FIRST_WHEEL_BITS = 8;
+const boost::uint32_t FIRST_WHEEL_SIZE = 1 << FIRST_WHEEL_BITS;
+const boost::uint32_t WHEEL_BITS = 6;
+const boost::uint32_t WHEEL_SIZE = 1 << WHEEL_BITS;
+const boost::uint32_t WHEEL_COUNT = 5;
+const boost::uint64_t MAX_DELTA = (boost::uint64_t(1) << (FIRST_WHEEL_BITS + (WHEEL_COUNT - 1) * WHEEL_BITS)) - 1;
+
+// The slot lists are numbered through the wheels, followed by the list of expired callbacks
+const boost::uint32_t EXPIRED_SLOT = FIRST_WHEEL_SIZE + (WHEEL_COUNT - 1) * WHEEL_SIZE;
+const boost::uint32_t SLOT_COUNT = EXPIRED_SLOT + 1;
+const boost::uint32_t NONE = 0xffffffff;
+
+/** Returns the wheel a slot belongs to. */
+boost::uint32_t wheelOfSlot(boost::uint32_t slot)
+{
+	return slot < FIRST_WHEEL_SIZE ? 0 : 1 + (slot - FIRST_WHEEL_SIZE) / WHEEL_SIZE;
+}
+
+/** Returns the number of ticks in each slot of a wheel. */
+boost::uint64_t ticksPerSlot(boost::uint32_t wheel)
+{
+	return wheel == 0 ? 1 : boost::uint64_t(1) << (FIRST_WHEEL_BITS + (wheel - 1) * WHEEL_BITS);
+}
+
+/** Returns the slot of a tick in one of the coarser wheels. */
+boost::uint32_t coarseSlot(boost::uint32_t wheel, boost::uint64_t tick)
+{
+	const boost::uint32_t shift = FIRST_WHEEL_BITS + (wheel - 1) * WHEEL_BITS;
+	return FIRST_WHEEL_SIZE + (wheel - 1) * WHEEL_SIZE + static_cast<boost::uint32_t>((tick >> shift) & (WHEEL_SIZE - 1));
+}
+
+//====================================================================================
+//                                       Tasks
+//====================================================================================
+
+/** Runs a callback, repeating until it is cancelled. */
+struct CallbackTask
+{
+	CallbackTask(const Scheduler::Callback& callback) : callback(callback) {}
+
+	bool operator()() const
+	{
+		callback();
+		return true;
+	}
+
+	Scheduler::Callback callback;
+};
+
+/** Posts a notification through the NotificationCenter. */
+bool postNotification(const String& notificationName)
+{
+	NotificationCenter::instance()->postNotification(notificationName);
+	return true;
+}
+
+/** Posts a notification with an object through the NotificationCenter. */
+bool postNotificationWithObject(const String& notificationName, const boost::any& object)
+{
+	NotificationCenter::instance()->postNotificationWithObject(notificationName, object);
+	return true;
+}
+
+/** Updates a timeline, repeating until it finishes or stops. */
+bool updateTimeline(Timeline* timeline)
+{
+	timeline->update();
+	const Timeline::State state = timeline->state();
+	return state == Timeline::RUNNING || state == Timeline::PAUSED;
+}
+
+}	// End of anonymous namespace
+
+//====================================================================================
+//                                     Scheduler
+//====================================================================================
+
+Scheduler::Scheduler(double resolution) :
+	_resolution(resolution),
+	_timer(),
+	_offset(0.0),
+	_nextTick(0),
+	_nodes(),
+	_freeNodes(),
+	_slots(SLOT_COUNT, NONE),
+	_size(0),
+	_polling(false),
+	_mutex(),
+	_condition(),
+	_thread(NULL),
+	_stopping(false)
+{
+	if (!(resolution > 0.0))
+	{
+		throw InvalidArgumentError("The scheduler resolution must be positive", BUMP_LOCATION);
+	}
+
+	for (unsigned int i = 0; i < WHEEL_COUNT; ++i)
+	{
+		_levelSizes[i] = 0;
+	}
+}
+
+Scheduler::~Scheduler()
+{
+	stop();
+}
+
+Scheduler::Id Scheduler::schedule(double delay, const Callback& callback)
+{
+	return scheduleTask(delay, 0.0, CallbackTask(callback));
+}
+
+Scheduler::Id Scheduler::schedulePeriodic(double interval, const Callback& callback)
+{
+	// A zero period means run once, so round tiny intervals up to one tick
+	return scheduleTask(interval, std::max(interval, _resolution), CallbackTask(callback));
+}
+
+Scheduler::Id Scheduler::scheduleNotification(double delay, const String& notificationName)
+{
+	return scheduleTask(delay, 0.0, boost::bind(postNotification, notificationName));
+}
+
+Scheduler::Id Scheduler::scheduleNotificationWithObject(double delay, const String& notificationName, const boost::any& object)
+{
+	return scheduleTask(delay, 0.0, boost::bind(postNotificationWithObject, notificationName, object));
+}
+
+Scheduler::Id Scheduler::scheduleTimeline(Timeline& timeline, double interval)
+{
+	return scheduleTask(interval, std::max(interval, _resolution), boost::bind(updateTimeline, &timeline));
+}
+
+bool Scheduler::cancel(Id id)
+{
+	boost::recursive_mutex::scoped_lock lock(_mutex);
+
+	const boost::uint32_t index = static_cast<boost::uint32_t>(id);
+	const boost::uint32_t generation = static_cast<boost::uint32_t>(id >> 32);
+	if (index >= _nodes.size() || _nodes[index].generation != generation || !_nodes[index].scheduled)
+	{
+		return false;
+	}
+
+	Node& node = _nodes[index];
+	node.scheduled = false;
+	--_size;
+
+	// A callback cancelling itself is released once it returns
+	if (node.slot != NONE)
+	{
+		unlink(index);
+		release(index);
+	}
+
+	return true;
+}
+
+std::size_t Scheduler::size() const
+{
+	boost::recursive_mutex::scoped_lock lock(_mutex);
+	return _size;
+}
+
+double Scheduler::time() const
+{
+	boost::recursive_mutex::scoped_lock lock(_mutex);
+	return _timer.secondsElapsed() + _offset;
+}
+
+unsigned int Scheduler::poll()
+{
+	boost::recursive_mutex::scoped_lock lock(_mutex);
+	return runUntil(currentTick());
+}
+
+unsigned int Scheduler::advance(double elapsed)
+{
+	boost::recursive_mutex::scoped_lock lock(_mutex);
+	if (elapsed > 0.0)
+	{
+		_offset += elapsed;
+	}
+
+	return runUntil(currentTick());
+}
+
+void Scheduler::start()
+{
+	boost::recursive_mutex::scoped_lock lock(_mutex);
+	if (_thread == NULL)
+	{
+		_stopping = false;
+		_thread = new boost::thread(boost::bind(&Scheduler::run, this));
+	}
+}
+
+void Scheduler::stop()
+{
+	{
+		boost::recursive_mutex::scoped_lock lock(_mutex);
+		if (_thread == NULL)
+		{
+			return;
+		}
+
+		_stopping = true;
+		_condition.notify_all();
+	}
+
+	// The thread needs the lock to finish, so join without holding it
+	_thread->join();
+
+	boost::recursive_mutex::scoped_lock lock(_mutex);
+	delete _thread;
+	_thread = NULL;
+}
+
+bool Scheduler::isRunning() const
+{
+	boost::recursive_mutex::scoped_lock lock(_mutex);
+	return _thread != NULL;
+}
+
+Scheduler::Id Scheduler::scheduleTask(double delay, double period, const Task& task)
+{
+	boost::recursive_mutex::scoped_lock lock(_mutex);
+
+	boost::uint32_t index;
+	if (_freeNodes.empty())
+	{
+		index = static_cast<boost::uint32_t>(_nodes.size());
+		_nodes.push_back(Node());
+		_nodes.back().generation = 1;
+	}
+	else
+	{
+		index = _freeNodes.back();
+		_freeNodes.pop_back();
+	}
+
+	// Callbacks can't be due before the next tick that runs
+	const boost::uint64_t delayTicks = delay > 0.0 ? static_cast<boost::uint64_t>(std::ceil(delay / _resolution)) : 0;
+	const boost::uint64_t expiry = currentTick() + delayTicks;
+
+	Node& node = _nodes[index];
+	node.task = task;
+	node.expiry = expiry > _nextTick ? expiry : _nextTick;
+	node.period = period > 0.0 ? std::max<boost::uint64_t>(static_cast<boost::uint64_t>(std::ceil(period / _resolution)), 1) : 0;
+	node.scheduled = true;
+	++_size;
+	insert(index);
+
+	// Wake the thread in case the new callback is due before it planned to wake up
+	if (_thread != NULL)
+	{
+		_condition.notify_all();
+	}
+
+	return (boost::uint64_t(node.generation) << 32) | index;
+}
+
+boost::uint64_t Scheduler::currentTick() const
+{
+	return static_cast<boost::uint64_t>((_timer.secondsElapsed() + _offset) / _resolution);
+}
+
+unsigned int Scheduler::runUntil(boost::uint64_t tick)
+{
+	// Callbacks polling the scheduler would run each other out of order
+	if (_polling)
+	{
+		return 0;
+	}
+
+	_polling = true;
+	unsigned int ran = 0;
+	while (_nextTick <= tick)
+	{
+		const boost::uint64_t current = _nextTick;
+		const boost::uint32_t firstSlot = static_cast<boost::uint32_t>(current & (FIRST_WHEEL_SIZE - 1));
+		if (_size == 0)
+		{
+			// Nothing is waiting in any of the wheels
+			_nextTick = tick + 1;
+			break;
+		}
+
+		// Skip straight to the next cascade of the finest wheel holding any callbacks
+		const boost::uint64_t skip = ticksPerSlot(finestWheel()) - 1;
+		if ((current & skip) != 0)
+		{
+			const boost::uint64_t nextCascade = (current | skip) + 1;
+			_nextTick = nextCascade < tick + 1 ? nextCascade : tick + 1;
+			continue;
+		}
+
+		if (firstSlot == 0)
+		{
+			// Each wheel cascades its next slot when the wheel below it wraps around
+			for (boost::uint32_t wheel = 1; wheel < WHEEL_COUNT; ++wheel)
+			{
+				const boost::uint32_t slot = coarseSlot(wheel, current);
+				cascade(slot);
+				if (slot != FIRST_WHEEL_SIZE + (wheel - 1) * WHEEL_SIZE)
+				{
+					break;
+				}
+			}
+		}
+
+		// Move the slot into the expired list, reversing it so callbacks run in the order they
+		// were scheduled. Callbacks scheduled while running can then land in the same slot.
+		while (_slots[firstSlot] != NONE)
+		{
+			const boost::uint32_t index = _slots[firstSlot];
+			unlink(index);
+			link(index, EXPIRED_SLOT);
+		}
+		_nextTick = current + 1;
+
+		while (_slots[EXPIRED_SLOT] != NONE)
+		{
+			const boost::uint32_t index = _slots[EXPIRED_SLOT];
+			unlink(index);
+
+			Node& node = _nodes[index];
+			if (node.period == 0)
+			{
+				node.scheduled = false;
+				--_size;
+			}
+
+			bool again = false;
+			try
+			{
+				again = node.task();
+			}
+			catch (...)
+			{
+				if (node.scheduled)
+				{
+					node.scheduled = false;
+					--_size;
+				}
+				release(index);
+				_polling = false;
+				throw;
+			}
+			++ran;
+
+			if (node.scheduled && again)
+			{
+				// Skip any runs that polling fell behind on
+				node.expiry += node.period;
+				if (node.expiry <= tick)
+				{
+					node.expiry += ((tick - node.expiry) / node.period + 1) * node.period;
+				}
+				insert(index);
+				continue;
+			}
+			else if (node.scheduled)
+			{
+				node.scheduled = false;
+				--_size;
+			}
+
+			release(index);
+		}
+	}
+
+	_polling = false;
+	return ran;
+}
+
+boost::uint64_t Scheduler::nextPollTick() const
+{
+	if (_size == 0)
+	{
+		return std::numeric_limits<boost::uint64_t>::max();
+	}
+
+	// Nothing can happen before the next cascade of the finest wheel holding any callbacks
+	const boost::uint64_t skip = ticksPerSlot(finestWheel()) - 1;
+	if (skip != 0)
+	{
+		return (_nextTick & skip) == 0 ? _nextTick : (_nextTick | skip) + 1;
+	}
+
+	// The finest wheel only holds callbacks due in its next turn, and the coarser wheels have
+	// to be cascaded when it wraps around
+	const bool coarseScheduled = _size != _levelSizes[0];
+	for (boost::uint64_t tick = _nextTick; tick < _nextTick + FIRST_WHEEL_SIZE; ++tick)
+	{
+		const boost::uint32_t slot = static_cast<boost::uint32_t>(tick & (FIRST_WHEEL_SIZE - 1));
+		if (_slots[slot] != NONE || (slot == 0 && coarseScheduled))
+		{
+			return tick;
+		}
+	}
+
+	return _nextTick + FIRST_WHEEL_SIZE;
+}
+
+boost::uint32_t Scheduler::finestWheel() const
+{
+	boost::uint32_t wheel = 0;
+	while (wheel < WHEEL_COUNT - 1 && _levelSizes[wheel] == 0)
+	{
+		++wheel;
+	}
+
+	return wheel;
+}
+
+void Scheduler::insert(boost::uint32_t index)
+{
+	Node& node = _nodes[index];
+	boost::uint64_t expiry = node.expiry > _nextTick ? node.expiry : _nextTick;
+	const boost::uint64_t delta = expiry - _nextTick;
+
+	if (delta < FIRST_WHEEL_SIZE)
+	{
+		link(index, static_cast<boost::uint32_t>(expiry & (FIRST_WHEEL_SIZE - 1)));
+		return;
+	}
+
+	// Find the finest wheel that reaches the expiry
+	boost::uint32_t wheel = 1;
+	while (wheel < WHEEL_COUNT - 1 && (delta >> (FIRST_WHEEL_BITS + wheel * WHEEL_BITS)) != 0)
+	{
+		++wheel;
+	}
+
+	// Callbacks beyond the coarsest wheel wait in its furthest slot and are cascaded again
+	if (delta > MAX_DELTA)
+	{
+		expiry = _nextTick + MAX_DELTA;
+	}
+
+	link(index, coarseSlot(wheel, expiry));
+}
+
+void Scheduler::link(boost::uint32_t index, boost::uint32_t slot)
+{
+	Node& node = _nodes[index];
+	node.slot = slot;
+	node.previous = NONE;
+	node.next = _slots[slot];
+	if (node.next != NONE)
+	{
+		_nodes[node.next].previous = index;
+	}
+	_slots[slot] = index;
+
+	if (slot != EXPIRED_SLOT)
+	{
+		++_levelSizes[wheelOfSlot(slot)];
+	}
+}
+
+void Scheduler::unlink(boost::uint32_t index)
+{
+	Node& node = _nodes[index];
+	if (node.previous != NONE)
+	{
+		_nodes[node.previous].next = node.next;
+	}
+	else
+	{
+		_slots[node.slot] = node.next;
+	}
+
+	if (node.next != NONE)
+	{
+		_nodes[node.next].previous = node.previous;
+	}
+
+	if (node.slot != EXPIRED_SLOT)
+	{
+		--_levelSizes[wheelOfSlot(node.slot)];
+	}
+
+	node.slot = NONE;
+}
+
+void Scheduler::cascade(boost::uint32_t slot)
+{
+	while (_slots[slot] != NONE)
+	{
+		const boost::uint32_t index = _slots[slot];
+		unlink(index);
+		insert(index);
+	}
+}
+
+void Scheduler::release(boost::uint32_t index)
+{
+	Node& node = _nodes[index];
+	node.task = Task();
+
+	// Invalidate the ids of the node, skipping 0 so no id is ever 0
+	if (++node.generation == 0)
+	{
+		node.generation = 1;
+	}
+
+	_freeNodes.push_back(index);
+}
+
+void Scheduler::run()
+{
+	boost::unique_lock<boost::recursive_mutex> lock(_mutex);
+	while (!_stopping)
+	{
+		try
+		{
+			runUntil(currentTick());
+		}
+		catch (const Exception& e)
+		{
+			bumpERROR_P("Scheduler: ", "A callback threw: " + e.description());
+		}
+		catch (const std::exception& e)
+		{
+			bumpERROR_P("Scheduler: ", "A callback threw: " + String(e.what()));
+		}
+		catch (...)
+		{
+			bumpERROR_P("Scheduler: ", "A callback threw an unknown exception");
+		}
+
+		if (_stopping)
+		{
+			break;
+		}
+
+		// Sleep until the next callback is due or something new is scheduled
+		const boost::uint64_t tick = nextPollTick();
+		if (tick == std::numeric_limits<boost::uint64_t>::max())
+		{
+			_condition.wait(lock);
+		}
+		else
+		{
+			const double seconds = tick * _resolution - _offset - _timer.secondsElapsed();
+			if (seconds > 0.0)
+			{
+				_condition.wait_for(lock, boost::chrono::nanoseconds(static_cast<boost::int64_t>(seconds * 1.0e9) + 1));
+			}
+		}
+	}
+}
+
+}	// End of bump namespace
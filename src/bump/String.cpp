@@ -7,8 +7,14 @@
 //
 
 // C++ headers
+#include <cctype>
+#include <cerrno>
+#include <clocale>
+#include <cstdio>
+#include <cstdlib>
 #include <iomanip>
 #include <limits>
+#include <locale>
 #include <sstream>
 
 // Boost headers
@@ -20,14 +26,302 @@
 #include <boost/regex.hpp>
 
 // Bump headers
+#include <bump/Arena.h>
+#include <bump/FastHash.h>
 #include <bump/InvalidArgumentError.h>
 #include <bump/OutOfRangeError.h>
 #include <bump/String.h>
 #include <bump/StringSearchError.h>
+#include <bump/StringTable.h>
 #include <bump/TypeCastError.h>
+#include <bump/Uuid.h>
 
 namespace bump {
 
+namespace {
+
+/**
+ * Reads the decimal digits of the string from the given position into the magnitude, which the
+ * conversions parse by hand so they never depend on the global C locale. Returns false if there
+ * are no digits, or anything follows them. The magnitude stops growing once it passes the limit.
+ */
+bool parseDigits(const String& string, std::size_t position, unsigned long long limit, unsigned long long& magnitude, bool& isOverflow)
+{
+	magnitude = 0;
+	isOverflow = false;
+	if (position >= string.size())
+	{
+		return false;
+	}
+
+	for (; position < string.size(); ++position)
+	{
+		const unsigned int digit = static_cast<unsigned int>(string[position] - '0');
+		if (digit > 9)
+		{
+			return false;
+		}
+
+		if (!isOverflow && magnitude > (limit - digit) / 10)
+		{
+			isOverflow = true;
+		}
+		magnitude = isOverflow ? magnitude : magnitude * 10 + digit;
+	}
+
+	return true;
+}
+
+/**
+ * Returns whether the whole string is a plain decimal number: an optional sign, digits with an
+ * optional decimal point, and an optional exponent. Unlike strtod, this rejects whitespace and
+ * hexadecimal numbers, as lexical_cast always did.
+ */
+bool isDecimalNumber(const String& string)
+{
+	std::size_t position = 0;
+	if (position < string.size() && (string[position] == '+' || string[position] == '-'))
+	{
+		++position;
+	}
+
+	std::size_t digits = 0;
+	for (; position < string.size() && std::isdigit(static_cast<unsigned char>(string[position])); ++position, ++digits);
+	if (position < string.size() && string[position] == '.')
+	{
+		for (++position; position < string.size() && std::isdigit(static_cast<unsigned char>(string[position])); ++position, ++digits);
+	}
+	if (digits == 0)
+	{
+		return false;
+	}
+
+	if (position < string.size() && (string[position] == 'e' || string[position] == 'E'))
+	{
+		++position;
+		if (position < string.size() && (string[position] == '+' || string[position] == '-'))
+		{
+			++position;
+		}
+
+		const std::size_t exponentStart = position;
+		for (; position < string.size() && std::isdigit(static_cast<unsigned char>(string[position])); ++position);
+		if (position == exponentStart)
+		{
+			return false;
+		}
+	}
+
+	return position == string.size();
+}
+
+/**
+ * Parses the infinity and nan forms lexical_cast has always accepted: an optional sign followed
+ * by inf, infinity, nan or nan(chars), ignoring case. Returns false for anything else.
+ */
+bool parseInfinityOrNan(const String& string, double& value)
+{
+	const bool isNegative = !string.empty() && string[0] == '-';
+	const std::size_t start = (!string.empty() && (string[0] == '-' || string[0] == '+')) ? 1 : 0;
+	const boost::string_ref text = boost::string_ref(string).substr(start);
+	if (boost::algorithm::iequals(text, "inf") || boost::algorithm::iequals(text, "infinity"))
+	{
+		value = isNegative ? -std::numeric_limits<double>::infinity() : std::numeric_limits<double>::infinity();
+		return true;
+	}
+
+	const bool isNan = boost::algorithm::iequals(text, "nan") || (text.size() >= 5 &&
+		boost::algorithm::iequals(text.substr(0, 4), "nan(") && text[text.size() - 1] == ')');
+	if (isNan)
+	{
+		value = isNegative ? -std::numeric_limits<double>::quiet_NaN() : std::numeric_limits<double>::quiet_NaN();
+		return true;
+	}
+
+	return false;
+}
+
+/**
+ * Converts a plain decimal number to a double the same way in every locale. strtod is only used
+ * while the global C locale writes decimal points as '.', which is nearly always, and a classic
+ * locale stream converts it otherwise, such as under de_DE where strtod would stop at the '.'.
+ */
+double toDecimal(const String& string, bool& isOutOfRange)
+{
+	if (std::localeconv()->decimal_point[0] == '.' && std::localeconv()->decimal_point[1] == '\0')
+	{
+		errno = 0;
+		const double value = std::strtod(string.c_str(), NULL);
+		isOutOfRange = errno == ERANGE && (value == std::numeric_limits<double>::infinity() || value == -std::numeric_limits<double>::infinity());
+		return value;
+	}
+
+	std::istringstream stream(string);
+	stream.imbue(std::locale::classic());
+	double value = 0.0;
+	stream >> value;
+	isOutOfRange = stream.fail();
+	return isOutOfRange ? 0.0 : value;
+}
+
+/**
+ * Appends a number the way a stream writes it at the given precision, in every locale. sprintf
+ * is only used while the global C locale writes decimal points as '.', and a classic locale
+ * stream writes it otherwise, such as under de_DE where sprintf would write "1,5".
+ */
+void appendDecimal(std::string& string, double value, int precision)
+{
+	if (std::localeconv()->decimal_point[0] == '.' && std::localeconv()->decimal_point[1] == '\0')
+	{
+		char number[32];
+		std::sprintf(number, "%.*g", precision, value);
+		string.append(number);
+		return;
+	}
+
+	std::ostringstream stream;
+	stream.imbue(std::locale::classic());
+	stream << std::setprecision(precision) << value;
+	string.append(stream.str());
+}
+
+/** Converts the whole string to a signed integer type without throwing. */
+template <typename T>
+Expected<T> parseSigned(const String& string, const char* description)
+{
+	const bool isNegative = !string.empty() && string[0] == '-';
+	const std::size_t start = (!string.empty() && (string[0] == '-' || string[0] == '+')) ? 1 : 0;
+
+	// The magnitude of the minimum is one more than the maximum
+	const unsigned long long limit = static_cast<unsigned long long>(std::numeric_limits<T>::max()) + (isNegative ? 1 : 0);
+	unsigned long long magnitude = 0;
+	bool isOverflow = false;
+	if (!parseDigits(string, start, limit, magnitude, isOverflow))
+	{
+		return Result(Result::TYPE_CAST_ERROR, description, boost::system::errc::invalid_argument);
+	}
+	if (isOverflow)
+	{
+		return Result(Result::TYPE_CAST_ERROR, description, boost::system::errc::result_out_of_range);
+	}
+
+	// Negate in the unsigned type, which cannot overflow for the minimum
+	return isNegative ? static_cast<T>(0ULL - magnitude) : static_cast<T>(magnitude);
+}
+
+/** Converts the whole string to an unsigned integer type without throwing, rejecting negative numbers. */
+template <typename T>
+Expected<T> parseUnsigned(const String& string, const char* description)
+{
+	const std::size_t start = (!string.empty() && string[0] == '+') ? 1 : 0;
+	unsigned long long magnitude = 0;
+	bool isOverflow = false;
+	if (!parseDigits(string, start, std::numeric_limits<T>::max(), magnitude, isOverflow))
+	{
+		return Result(Result::TYPE_CAST_ERROR, description, boost::system::errc::invalid_argument);
+	}
+	if (isOverflow)
+	{
+		return Result(Result::TYPE_CAST_ERROR, description, boost::system::errc::result_out_of_range);
+	}
+
+	return static_cast<T>(magnitude);
+}
+
+/** Converts the whole string to a floating point type without throwing. */
+template <typename T>
+Expected<T> parseFloating(const String& string, const char* description)
+{
+	double nonFinite = 0.0;
+	if (parseInfinityOrNan(string, nonFinite))
+	{
+		return static_cast<T>(nonFinite);
+	}
+	if (!isDecimalNumber(string))
+	{
+		return Result(Result::TYPE_CAST_ERROR, description, boost::system::errc::invalid_argument);
+	}
+
+	bool isOutOfRange = false;
+	const double value = toDecimal(string, isOutOfRange);
+	if (isOutOfRange || value > std::numeric_limits<T>::max() || value < -std::numeric_limits<T>::max())
+	{
+		return Result(Result::TYPE_CAST_ERROR, description, boost::system::errc::result_out_of_range);
+	}
+
+	return static_cast<T>(value);
+}
+
+/** Returns the converted value, or throws the TypeCastError the conversion failed with. */
+template <typename T>
+T valueOrThrow(const Expected<T>& value, const SourceLocation& location)
+{
+	if (!value.hasValue())
+	{
+		throw TypeCastError(value.result().description(), location);
+	}
+
+	return value.value();
+}
+
+/** Appends the decimal digits of the value to the string. */
+void appendDigits(std::string& string, unsigned long long value, bool isNegative)
+{
+	// Write the digits backwards from the end of a buffer large enough for any 64 bit value
+	char digits[24];
+	char* begin = digits + sizeof(digits);
+	do
+	{
+		*--begin = static_cast<char>('0' + value % 10);
+		value /= 10;
+	} while (value != 0);
+
+	if (isNegative)
+	{
+		*--begin = '-';
+	}
+
+	string.append(begin, digits + sizeof(digits));
+}
+
+/** Appends a piece of a split string to an arena list. */
+void appendPiece(ArenaStringList& pieces, const char* data, std::size_t size)
+{
+	pieces.emplace_back(data, size);
+}
+
+/** Appends a piece of a split string to a table. */
+void appendPiece(StringTable& pieces, const char* data, std::size_t size)
+{
+	pieces.append(boost::string_ref(data, size));
+}
+
+/** Splits on any of the separator characters, treating a run of them as one separator like String::split(). */
+template <class List>
+void splitInto(const std::string& string, const std::string& separator, List& pieces)
+{
+	std::size_t begin = 0;
+	while (true)
+	{
+		const std::size_t end = string.find_first_of(separator, begin);
+		if (end == std::string::npos)
+		{
+			appendPiece(pieces, string.data() + begin, string.size() - begin);
+			break;
+		}
+		appendPiece(pieces, string.data() + begin, end - begin);
+
+		begin = string.find_first_not_of(separator, end);
+		if (begin == std::string::npos)
+		{
+			appendPiece(pieces, string.data(), 0);
+			break;
+		}
+	}
+}
+
+}	// End of anonymous namespace
+
 String::String() : std::string()
 {
 	;
@@ -178,78 +472,109 @@ String& String::append(const char* appendString)
 	return *this;
 }
 
-String String::arg(const String& argument) const
+void String::FormatArgument::appendTo(std::string& string) const
 {
-	// Find all the markers (i.e. %1 - %99)
-	boost::regex expression("%[1-9][0-9]?");
-	std::vector<std::string> markers;
-	boost::algorithm::find_all_regex(markers, *this, expression);
-
-	// Throw an arg error if we didn't find any markers
-	if (markers.empty())
+	switch (_type)
 	{
-		throw StringSearchError("Could not find any markers (i.e. %1 - %99", BUMP_LOCATION);
+		case BOOL_TYPE:
+			string.append(_value.integer != 0 ? "true" : "false");
+			break;
+		case SIGNED_TYPE:
+		{
+			// Negate as unsigned so the lowest value does not overflow
+			const bool isNegative = _value.integer < 0;
+			const unsigned long long magnitude = static_cast<unsigned long long>(_value.integer);
+			appendDigits(string, isNegative ? 0ULL - magnitude : magnitude, isNegative);
+			break;
+		}
+		case UNSIGNED_TYPE:
+			appendDigits(string, _value.unsignedInteger, false);
+			break;
+		case FLOAT_TYPE:
+		case DOUBLE_TYPE:
+		{
+			// The precision of the String constructors, always written with a '.' decimal point
+			const int precision = _type == FLOAT_TYPE ? std::numeric_limits<float>::digits10 + 1 : std::numeric_limits<double>::digits10 + 1;
+			appendDecimal(string, _value.floating, precision);
+			break;
+		}
+		case TEXT_TYPE:
+			string.append(_value.text.data, _value.text.size);
+			break;
+		case UUID_TYPE:
+		{
+			const std::size_t size = string.size();
+			string.resize(size + 36);
+			_value.uuid->toChars(&string[size]);
+			break;
+		}
 	}
+}
 
-	// Now we need to find the lowest marker so we can replace it. We also need to store each
-	// marker's position in a multimap to be able to replace only the exact portion of the
-	// string. For example, we need to ensure we don't replace %1 and %10 at the same time.
-	// To make sure we only replace the %1 and not the %10 on this call, we use the multimap.
-	std::multimap<int, int> marker_position_map;
-	unsigned int current_index = 0;
-	unsigned int lowest_marker_value = 100;
-	String lowest_marker;
-	for (unsigned int i = 0; i < markers.size(); ++i)
+String String::formatArguments(boost::string_ref format, const FormatArgument* arguments, std::size_t argumentCount)
+{
+	// Build through the std::string, since String::append() hides its overloads that take a length
+	String formatted;
+	std::string& output = formatted;
+	output.reserve(format.size() + argumentCount * 8);
+
+	// Copy the text between the markers, replacing each marker (i.e. %1 - %99) with its argument
+	std::vector<bool> isUsed(argumentCount, false);
+	std::size_t textBegin = 0;
+	std::size_t i = 0;
+	while (i + 1 < format.size())
 	{
-		// First find the marker index position in this string
-		String marker = markers.at(i);
-		int marker_position_index = indexOf(marker, current_index);
+		if (format[i] != '%' || format[i + 1] < '1' || format[i + 1] > '9')
+		{
+			++i;
+			continue;
+		}
 
-		// Convert the marker to a value
-		unsigned int marker_value = marker.remove("%").toUInt();
-		marker = markers.at(i);
+		std::size_t marker = format[i + 1] - '0';
+		std::size_t markerLength = 2;
+		if (i + 2 < format.size() && format[i + 2] >= '0' && format[i + 2] <= '9')
+		{
+			marker = marker * 10 + (format[i + 2] - '0');
+			markerLength = 3;
+		}
 
-		// See if the match is the lowest
-		if (marker_value < lowest_marker_value)
+		if (marker > argumentCount)
 		{
-			lowest_marker_value = marker_value;
-			lowest_marker = marker;
+			String msg = String("The format has no argument for marker %1 of %2 arguments").arg(marker).arg(argumentCount);
+			throw StringSearchError(msg, BUMP_LOCATION);
 		}
 
-		// Store the match value and position in the map
-		marker_position_map.insert(std::pair<int, int>(marker_value, marker_position_index));
+		output.append(format.data() + textBegin, i - textBegin);
+		arguments[marker - 1].appendTo(output);
+		isUsed[marker - 1] = true;
 
-		// Update the current index for the next iteration
-		current_index = marker_position_index + markers.at(i).length();
+		i += markerLength;
+		textBegin = i;
 	}
+	output.append(format.data() + textBegin, format.size() - textBegin);
 
-	// Create a copy of this string for replacement
-	String replaced = *this;
-
-	// Iterate through the marker position map and replace all the lowest markers. We need to also
-	// keep track of the difference in length between our match text and the replacement argument
-	// text as "skipped_space". Our replacement positions need to then be adjusted by the skipped
-	// space each time to map properly.
-	int skipped_space = 0;
-	std::multimap<int, int>::iterator iter = marker_position_map.find(lowest_marker_value);
-	for (iter = marker_position_map.find(lowest_marker_value); iter != marker_position_map.end(); ++iter)
+	// Every argument has to be used, the same as every arg() call has to find a marker
+	for (std::size_t j = 0; j < argumentCount; ++j)
 	{
-		// Stop once we're finished with the lowest markers
-		if (iter->first != lowest_marker_value)
+		if (!isUsed[j])
 		{
-			break;
+			String msg = String("The format has no marker for argument %1").arg(j + 1);
+			throw StringSearchError(msg, BUMP_LOCATION);
 		}
+	}
 
-		// Actually replace the marker with the argument using skipped_space to make sure we're
-		// in the right spot regardless of how many iterations we've gone through.
-		int start_position = iter->second;
-		replaced.replace(start_position + skipped_space, lowest_marker.length(), argument);
+	return formatted;
+}
 
-		// Update the skipped space
-		skipped_space += argument.length() - lowest_marker.length();
+String String::arg(const String& argument) const
+{
+	const Expected<String> replaced = tryArg(argument);
+	if (!replaced.hasValue())
+	{
+		throw StringSearchError(replaced.result().description(), BUMP_LOCATION);
 	}
 
-	return replaced;
+	return replaced.value();
 }
 
 String String::arg(const String& a1, const String& a2) const
@@ -902,6 +1227,22 @@ StringList String::split(const String& separator) const
 	return converted_strings;
 }
 
+ArenaStringList String::split(const String& separator, MemoryResource* resource) const
+{
+	ArenaStringList split_strings(resource);
+	splitInto(*this, separator, split_strings);
+
+	return split_strings;
+}
+
+StringTable String::splitTable(const String& separator) const
+{
+	StringTable split_strings;
+	splitInto(*this, separator, split_strings);
+
+	return split_strings;
+}
+
 bool String::startsWith(const String& startString, CaseSensitivity caseSensitivity) const
 {
 	if (caseSensitivity == NotCaseSensitive)
@@ -935,77 +1276,32 @@ String String::title() const
 
 bool String::toBool() const
 {
-	// Make a copy and cast make it lowercase
-	String this_copy = *this;
-	this_copy.toLowerCase();
-
-	// Make sure we have a valid bool or throw an exception
-	if (this_copy != "true" && this_copy != "false")
-	{
-		throw TypeCastError("Cannot convert string to bool", BUMP_LOCATION);
-	}
-
-	return this_copy == "true" ? true : false;
+	return valueOrThrow(tryToBool(), BUMP_LOCATION);
 }
 
 double String::toDouble() const
 {
-	try
-	{
-		return boost::lexical_cast<double>((*this).data());
-	}
-	catch (boost::bad_lexical_cast)
-	{
-		throw TypeCastError("Cannot convert string to double", BUMP_LOCATION);
-	}
+	return valueOrThrow(tryToDouble(), BUMP_LOCATION);
 }
 
 float String::toFloat() const
 {
-	try
-	{
-		return boost::lexical_cast<float>((*this).data());
-	}
-	catch (boost::bad_lexical_cast)
-	{
-		throw TypeCastError("Cannot convert string to float", BUMP_LOCATION);
-	}
+	return valueOrThrow(tryToFloat(), BUMP_LOCATION);
 }
 
 int String::toInt() const
 {
-	try
-	{
-		return boost::lexical_cast<int>((*this).data());
-	}
-	catch (boost::bad_lexical_cast)
-	{
-		throw TypeCastError("Cannot convert string to int", BUMP_LOCATION);
-	}
+	return valueOrThrow(tryToInt(), BUMP_LOCATION);
 }
 
 long String::toLong() const
 {
-	try
-	{
-		return boost::lexical_cast<long>((*this).data());
-	}
-	catch (boost::bad_lexical_cast)
-	{
-		throw TypeCastError("Cannot convert string to long", BUMP_LOCATION);
-	}
+	return valueOrThrow(tryToLong(), BUMP_LOCATION);
 }
 
 long long String::toLongLong() const
 {
-	try
-	{
-		return boost::lexical_cast<long long>((*this).data());
-	}
-	catch (boost::bad_lexical_cast)
-	{
-		throw TypeCastError("Cannot convert string to long long", BUMP_LOCATION);
-	}
+	return valueOrThrow(tryToLongLong(), BUMP_LOCATION);
 }
 
 String& String::toLowerCase()
@@ -1016,14 +1312,7 @@ String& String::toLowerCase()
 
 short String::toShort() const
 {
-	try
-	{
-		return boost::lexical_cast<short>((*this).data());
-	}
-	catch (boost::bad_lexical_cast)
-	{
-		throw TypeCastError("Cannot convert string to short", BUMP_LOCATION);
-	}
+	return valueOrThrow(tryToShort(), BUMP_LOCATION);
 }
 
 std::string String::toStdString() const
@@ -1033,38 +1322,17 @@ std::string String::toStdString() const
 
 unsigned int String::toUInt() const
 {
-	try
-	{
-		return boost::lexical_cast<unsigned int>((*this).data());
-	}
-	catch (boost::bad_lexical_cast)
-	{
-		throw TypeCastError("Cannot convert string to unsigned int", BUMP_LOCATION);
-	}
+	return valueOrThrow(tryToUInt(), BUMP_LOCATION);
 }
 
 unsigned long String::toULong() const
 {
-	try
-	{
-		return boost::lexical_cast<unsigned long>((*this).data());
-	}
-	catch (boost::bad_lexical_cast)
-	{
-		throw TypeCastError("Cannot convert string to unsigned long", BUMP_LOCATION);
-	}
+	return valueOrThrow(tryToULong(), BUMP_LOCATION);
 }
 
 unsigned long long String::toULongLong() const
 {
-	try
-	{
-		return boost::lexical_cast<unsigned long long>((*this).data());
-	}
-	catch (boost::bad_lexical_cast)
-	{
-		throw TypeCastError("Cannot convert string to unsigned long long", BUMP_LOCATION);
-	}
+	return valueOrThrow(tryToULongLong(), BUMP_LOCATION);
 }
 
 String& String::toUpperCase()
@@ -1075,19 +1343,150 @@ String& String::toUpperCase()
 
 unsigned short String::toUShort() const
 {
-	try
+	return valueOrThrow(tryToUShort(), BUMP_LOCATION);
+}
+
+String String::trimmed() const
+{
+	return boost::algorithm::trim_copy_if(static_cast<std::string>(*this), boost::algorithm::is_any_of(" \t\n\v\f\r"));
+}
+
+Expected<String> String::tryArg(const String& argument) const
+{
+	// Find all the markers (i.e. %1 - %99)
+	boost::regex expression("%[1-9][0-9]?");
+	std::vector<std::string> markers;
+	boost::algorithm::find_all_regex(markers, *this, expression);
+
+	// Fail with an arg error if we didn't find any markers
+	if (markers.empty())
+	{
+		return Result(Result::STRING_SEARCH_ERROR, "Could not find any markers (i.e. %1 - %99", boost::system::errc::invalid_argument);
+	}
+
+	// Now we need to find the lowest marker so we can replace it. We also need to store each
+	// marker's position in a multimap to be able to replace only the exact portion of the
+	// string. For example, we need to ensure we don't replace %1 and %10 at the same time.
+	// To make sure we only replace the %1 and not the %10 on this call, we use the multimap.
+	std::multimap<int, int> marker_position_map;
+	unsigned int current_index = 0;
+	unsigned int lowest_marker_value = 100;
+	String lowest_marker;
+	for (unsigned int i = 0; i < markers.size(); ++i)
 	{
-		return boost::lexical_cast<unsigned short>((*this).data());
+		// First find the marker index position in this string
+		String marker = markers.at(i);
+		int marker_position_index = indexOf(marker, current_index);
+
+		// Convert the marker to a value
+		unsigned int marker_value = marker.remove("%").toUInt();
+		marker = markers.at(i);
+
+		// See if the match is the lowest
+		if (marker_value < lowest_marker_value)
+		{
+			lowest_marker_value = marker_value;
+			lowest_marker = marker;
+		}
+
+		// Store the match value and position in the map
+		marker_position_map.insert(std::pair<int, int>(marker_value, marker_position_index));
+
+		// Update the current index for the next iteration
+		current_index = marker_position_index + markers.at(i).length();
 	}
-	catch (boost::bad_lexical_cast)
+
+	// Create a copy of this string for replacement
+	String replaced = *this;
+
+	// Iterate through the marker position map and replace all the lowest markers. We need to also
+	// keep track of the difference in length between our match text and the replacement argument
+	// text as "skipped_space". Our replacement positions need to then be adjusted by the skipped
+	// space each time to map properly.
+	int skipped_space = 0;
+	std::multimap<int, int>::iterator iter = marker_position_map.find(lowest_marker_value);
+	for (iter = marker_position_map.find(lowest_marker_value); iter != marker_position_map.end(); ++iter)
 	{
-		throw TypeCastError("Cannot convert string to unsigned short", BUMP_LOCATION);
+		// Stop once we're finished with the lowest markers
+		if (iter->first != lowest_marker_value)
+		{
+			break;
+		}
+
+		// Actually replace the marker with the argument using skipped_space to make sure we're
+		// in the right spot regardless of how many iterations we've gone through.
+		int start_position = iter->second;
+		replaced.replace(start_position + skipped_space, lowest_marker.length(), argument);
+
+		// Update the skipped space
+		skipped_space += argument.length() - lowest_marker.length();
 	}
+
+	return replaced;
 }
 
-String String::trimmed() const
+Expected<bool> String::tryToBool() const
 {
-	return boost::algorithm::trim_copy_if(static_cast<std::string>(*this), boost::algorithm::is_any_of(" \t\n\v\f\r"));
+	if (boost::algorithm::iequals(*this, "true"))
+	{
+		return true;
+	}
+	else if (boost::algorithm::iequals(*this, "false"))
+	{
+		return false;
+	}
+
+	return Result(Result::TYPE_CAST_ERROR, "Cannot convert string to bool", boost::system::errc::invalid_argument);
+}
+
+Expected<double> String::tryToDouble() const
+{
+	return parseFloating<double>(*this, "Cannot convert string to double");
+}
+
+Expected<float> String::tryToFloat() const
+{
+	return parseFloating<float>(*this, "Cannot convert string to float");
+}
+
+Expected<int> String::tryToInt() const
+{
+	return parseSigned<int>(*this, "Cannot convert string to int");
+}
+
+Expected<long> String::tryToLong() const
+{
+	return parseSigned<long>(*this, "Cannot convert string to long");
+}
+
+Expected<long long> String::tryToLongLong() const
+{
+	return parseSigned<long long>(*this, "Cannot convert string to long long");
+}
+
+Expected<short> String::tryToShort() const
+{
+	return parseSigned<short>(*this, "Cannot convert string to short");
+}
+
+Expected<unsigned int> String::tryToUInt() const
+{
+	return parseUnsigned<unsigned int>(*this, "Cannot convert string to unsigned int");
+}
+
+Expected<unsigned long> String::tryToULong() const
+{
+	return parseUnsigned<unsigned long>(*this, "Cannot convert string to unsigned long");
+}
+
+Expected<unsigned long long> String::tryToULongLong() const
+{
+	return parseUnsigned<unsigned long long>(*this, "Cannot convert string to unsigned long long");
+}
+
+Expected<unsigned short> String::tryToUShort() const
+{
+	return parseUnsigned<unsigned short>(*this, "Cannot convert string to unsigned short");
 }
 
 String& String::operator << (const String& appendString)
@@ -1181,3 +1580,10 @@ String& String::operator << (bool appendBool)
 }
 
 }	// End of bump namespace
+
+#ifndef BOOST_NO_CXX11_HDR_FUNCTIONAL
+std::size_t std::hash<bump::String>::operator()(const bump::String& string) const
+{
+	return static_cast<std::size_t>(bump::FastHash::hash64(string));
+}
+#endif
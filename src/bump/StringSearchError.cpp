@@ -11,7 +11,7 @@
 
 namespace bump {
 
-StringSearchError::StringSearchError(const String& description, const String& location) throw() :
+StringSearchError::StringSearchError(const String& description, const SourceLocation& location) throw() :
 	RuntimeError("bump::~StringSearchError", description, location)
 {
 	;
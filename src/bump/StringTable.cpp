@@ -0,0 +1,187 @@
+//
+//	StringTable.cpp
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+// C++ headers
+#include <algorithm>
+#include <cstring>
+
+// Bump headers
+#include <bump/OutOfRangeError.h>
+#include <bump/StringTable.h>
+
+namespace bump {
+
+namespace {
+
+/** Orders the indices of a table by the strings they refer to. */
+struct IndexLess
+{
+	explicit IndexLess(const StringTable& table) : table(table) {}
+
+	bool operator()(std::size_t lhs, std::size_t rhs) const
+	{
+		return table[lhs] < table[rhs];
+	}
+
+	const StringTable& table;
+};
+
+}	// End of anonymous namespace
+
+const std::size_t StringTable::npos;
+
+StringTable::StringTable() :
+	_characters(),
+	_offsets(1, 0)
+{
+	;
+}
+
+StringTable::StringTable(const StringList& strings) :
+	_characters(),
+	_offsets(1, 0)
+{
+	std::size_t characterCount = 0;
+	for (unsigned int i = 0; i < strings.size(); ++i)
+	{
+		characterCount += strings[i].size();
+	}
+
+	reserve(strings.size(), characterCount);
+	for (unsigned int i = 0; i < strings.size(); ++i)
+	{
+		append(strings[i]);
+	}
+}
+
+void StringTable::reserve(std::size_t stringCount, std::size_t characterCount)
+{
+	_offsets.reserve(stringCount + 1);
+	_characters.reserve(characterCount);
+}
+
+void StringTable::append(boost::string_ref string)
+{
+	_characters.insert(_characters.end(), string.begin(), string.end());
+	_offsets.push_back(_characters.size());
+}
+
+void StringTable::clear()
+{
+	_characters.clear();
+	_offsets.resize(1);
+}
+
+boost::string_ref StringTable::at(std::size_t index) const
+{
+	if (index >= size())
+	{
+		String msg = String("The index %1 is out of range of the %2 strings in the table").arg(index).arg(size());
+		throw OutOfRangeError(msg, BUMP_LOCATION);
+	}
+
+	return (*this)[index];
+}
+
+String StringTable::string(std::size_t index) const
+{
+	const boost::string_ref view = at(index);
+	return String(std::string(view.data(), view.size()));
+}
+
+void StringTable::sort()
+{
+	// Sort the indices rather than the strings, then copy the strings out in their new order
+	std::vector<std::size_t> order(size());
+	for (std::size_t i = 0; i < order.size(); ++i)
+	{
+		order[i] = i;
+	}
+	std::sort(order.begin(), order.end(), IndexLess(*this));
+
+	StringTable sorted;
+	sorted.reserve(size(), characterCount());
+	for (std::size_t i = 0; i < order.size(); ++i)
+	{
+		sorted.append((*this)[order[i]]);
+	}
+
+	_characters.swap(sorted._characters);
+	_offsets.swap(sorted._offsets);
+}
+
+void StringTable::dedupe()
+{
+	// Slide each string that is kept down over the removed ones, which never overlaps what is still to be read
+	std::size_t kept = 0;
+	for (std::size_t i = 0; i < size(); ++i)
+	{
+		const std::size_t begin = _offsets[i];
+		const std::size_t length = _offsets[i + 1] - begin;
+		if (kept > 0 && (*this)[i] == (*this)[kept - 1])
+		{
+			continue;
+		}
+
+		const std::size_t destination = _offsets[kept];
+		if (destination != begin)
+		{
+			std::memmove(&_characters[destination], &_characters[begin], length);
+		}
+		_offsets[kept + 1] = destination + length;
+		++kept;
+	}
+
+	_offsets.resize(kept + 1);
+	_characters.resize(_offsets[kept]);
+}
+
+std::size_t StringTable::binarySearch(boost::string_ref string) const
+{
+	std::size_t low = 0;
+	std::size_t high = size();
+	while (low < high)
+	{
+		const std::size_t middle = low + (high - low) / 2;
+		if ((*this)[middle] < string)
+		{
+			low = middle + 1;
+		}
+		else
+		{
+			high = middle;
+		}
+	}
+
+	return (low < size() && (*this)[low] == string) ? low : npos;
+}
+
+StringList StringTable::toStringList() const
+{
+	StringList strings;
+	strings.reserve(size());
+	for (std::size_t i = 0; i < size(); ++i)
+	{
+		const boost::string_ref view = (*this)[i];
+		strings.push_back(String(std::string(view.data(), view.size())));
+	}
+
+	return strings;
+}
+
+bool StringTable::operator==(const StringTable& table) const
+{
+	return _offsets == table._offsets && _characters == table._characters;
+}
+
+bool StringTable::operator!=(const StringTable& table) const
+{
+	return !(*this == table);
+}
+
+}	// End of bump namespace
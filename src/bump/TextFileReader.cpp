@@ -7,8 +7,10 @@
 //
 
 // Bump Headers
+#include <bump/Arena.h>
 #include <bump/FileSystem.h>
 #include <bump/Log.h>
+#include <bump/StringTable.h>
 #include <bump/TextFileReader.h>
 
 // C++ Headers
@@ -18,17 +20,30 @@ namespace bump {
 
 namespace TextFileReader {
 
-StringList readFileLines(String fileName, int beginningLine, int numLines)
+void appendLine(StringList& fileContents, const std::string& line)
 {
-	// Create StringList to store info
-	StringList file_contents;
+	fileContents.push_back(line);
+}
+
+void appendLine(ArenaStringList& fileContents, const std::string& line)
+{
+	fileContents.emplace_back(line.data(), line.size());
+}
 
+void appendLine(StringTable& fileContents, const std::string& line)
+{
+	fileContents.append(line);
+}
+
+template <class List>
+void readFileLines(String fileName, int beginningLine, int numLines, List& file_contents)
+{
 	// Check to see if the file is valid before opening
 	bool is_valid = FileSystem::isFile(fileName);
 	if (!is_valid)
 	{
 		bumpERROR_P("FileSystem: ", "File to open is not a valid file");
-		return file_contents;
+		return;
 	}
 	bumpINFO_P("FileReader: Reading File ", fileName);
 
@@ -38,7 +53,7 @@ StringList readFileLines(String fileName, int beginningLine, int numLines)
 	if (!input_file.is_open())
 	{
 		bumpERROR_P("FileReader: Error opening ", fileName);
-		return file_contents;
+		return;
 	}
 
 	std::string line;
@@ -49,7 +64,7 @@ StringList readFileLines(String fileName, int beginningLine, int numLines)
 		if (input_file.eof())
 		{
 			bumpERROR_P("FileReader: ", "The line requested is larger than the number of lines in the file");
-			return file_contents;
+			return;
 		}
 	}
 
@@ -58,7 +73,7 @@ StringList readFileLines(String fileName, int beginningLine, int numLines)
 		while (!input_file.eof())
 		{
 			std::getline(input_file, line);
-			file_contents.push_back(line);
+			appendLine(file_contents, line);
 		}
 	}
 	else
@@ -69,14 +84,22 @@ StringList readFileLines(String fileName, int beginningLine, int numLines)
 			if (input_file.eof())
 			{
 				bumpINFO_P("FileReader: ", "More lines were requested than were in the file");
-				return file_contents;
+				return;
 			}
 			std::getline(input_file, line);
-			file_contents.push_back(line);
+			appendLine(file_contents, line);
 		}
 	}
 
 	input_file.close();
+}
+
+StringList readFileLines(String fileName, int beginningLine, int numLines)
+{
+	// Create StringList to store info
+	StringList file_contents;
+	readFileLines(fileName, beginningLine, numLines, file_contents);
+
 	return file_contents;
 }
 
@@ -85,6 +108,22 @@ StringList fileContents(const String& fileName)
 	return readFileLines(fileName, 0, -1); // -1 for the whole file
 }
 
+ArenaStringList fileContents(const String& fileName, MemoryResource* resource)
+{
+	ArenaStringList file_contents(resource);
+	readFileLines(fileName, 0, -1, file_contents); // -1 for the whole file
+
+	return file_contents;
+}
+
+StringTable fileContentsTable(const String& fileName)
+{
+	StringTable file_contents;
+	readFileLines(fileName, 0, -1, file_contents); // -1 for the whole file
+
+	return file_contents;
+}
+
 StringList fileContents(const String& fileName, int beginningLine, int numLines)
 {
 	if (beginningLine < 1)
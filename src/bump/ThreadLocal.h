@@ -0,0 +1,28 @@
+//
+//	ThreadLocal.h
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+#ifndef BUMP_THREAD_LOCAL_H
+#define BUMP_THREAD_LOCAL_H
+
+/**
+ * @internal
+ * Compiler thread local storage for the library's hot paths. Unlike boost::thread_specific_ptr,
+ * reading a variable costs about as much as reading a global. The initial exec model skips the
+ * __tls_get_addr call, so only use it for a few bytes per source file, which fit in the static TLS
+ * space glibc reserves for libraries loaded with dlopen. Variables must be plain data, since they
+ * are never constructed or destroyed.
+ *
+ * This header is private to the library and is not installed.
+ */
+#if defined(_MSC_VER)
+	#define BUMP_THREAD_LOCAL __declspec(thread)
+#else
+	#define BUMP_THREAD_LOCAL __thread __attribute__((tls_model("initial-exec")))
+#endif
+
+#endif	// End of BUMP_THREAD_LOCAL_H
@@ -8,6 +8,7 @@
 
 // Bump headers
 #include <bump/Timeline.h>
+#include <bump/TimelineCurve.h>
 
 namespace bump {
 
@@ -15,6 +16,7 @@ Timeline::Timeline() :
 	_state(NOT_RUNNING),
 	_direction(FORWARDS),
 	_curveShape(LINEAR_CURVE),
+	_curve(),
 	_duration(10.0),
 	_halfDuration(0.0),
 	_runTime(0.0),
@@ -23,7 +25,10 @@ Timeline::Timeline() :
 	_stepIncrement(0.0),
 	_startOutput(0.0),
 	_endOutput(100.0),
-	_timer()
+	_timer(),
+	_clockTime(0.0),
+	_hasClockTime(false),
+	_finishedCallback()
 {
 	;
 }
@@ -32,6 +37,7 @@ Timeline::Timeline(double duration, const Direction& direction, const CurveShape
 	_state(NOT_RUNNING),
 	_direction(direction),
 	_curveShape(curveShape),
+	_curve(),
 	_duration(duration),
 	_halfDuration(0.0),
 	_runTime(0.0),
@@ -40,7 +46,10 @@ Timeline::Timeline(double duration, const Direction& direction, const CurveShape
 	_stepIncrement(0.0),
 	_startOutput(0.0),
 	_endOutput(100.0),
-	_timer()
+	_timer(),
+	_clockTime(0.0),
+	_hasClockTime(false),
+	_finishedCallback()
 {
 	;
 }
@@ -57,6 +66,8 @@ void Timeline::start()
 		// Start the timer and set State to RUNNING
 		_timer.start();
 		_state = RUNNING;
+		_runTime = 0.0;
+		_hasClockTime = false;
 
 		// Calculate the interpolation coefficients
 		calculateAcceleration();
@@ -91,42 +102,60 @@ void Timeline::pause()
 {
 	_state = PAUSED;
 	_timer.pause();
+	_hasClockTime = false;
 }
 
 void Timeline::unpause()
 {
+	// The first update afterwards sets the reference time, so the paused interval is skipped
 	_state = RUNNING;
 	_timer.unpause();
+	_hasClockTime = false;
 }
 
 void Timeline::update()
 {
 	// Check to make sure we are in a state to be running
-	if (_state == PAUSED)
+	if (_state != RUNNING)
 	{
-		std::cout << "Timeline update() is returning because it is PAUSED." << std::endl;
 		return;
 	}
-	else if (_state == FINISHED)
-	{
-		std::cout << "Timeline update() is returning because it is FINISHED.\n" << std::endl;
-		return;
-	}
-	else if (_state == NOT_RUNNING)
+
+	// Set the runTime
+	_runTime = _timer.secondsElapsed();
+
+	// Generate the new step value
+	step();
+}
+
+void Timeline::update(double now)
+{
+	// The first update only sets the reference time, and the clock never runs backwards
+	const double elapsed = _hasClockTime && now > _clockTime ? now - _clockTime : 0.0;
+	_clockTime = now;
+	_hasClockTime = true;
+
+	advance(elapsed);
+}
+
+void Timeline::advance(double elapsed)
+{
+	// Check to make sure we are in a state to be running
+	if (_state != RUNNING)
 	{
-		std::cout << "Timeline update() is returning because it is NOT_RUNNING.\n" << std::endl;
 		return;
 	}
 
 	// Set the runTime
-	_runTime = _timer.secondsElapsed();
-
-	// Determine if we have reached the goal value or not
-	if (_runTime >= _duration)
-		_state = FINISHED;
+	_runTime += elapsed;
 
 	// Generate the new step value
-	generateStep();
+	step();
+}
+
+void Timeline::setFinishedCallback(const FinishedCallback& callback)
+{
+	_finishedCallback = callback;
 }
 
 void Timeline::setOutputRange(double startOutput, double endOutput)
@@ -155,6 +184,17 @@ Timeline::CurveShape Timeline::curveShape()
 	return _curveShape;
 }
 
+void Timeline::setCurve(const boost::shared_ptr<const TimelineCurve>& curve)
+{
+	_curve = curve;
+	_curveShape = CUSTOM_CURVE;
+}
+
+boost::shared_ptr<const TimelineCurve> Timeline::curve()
+{
+	return _curve;
+}
+
 void Timeline::setDuration(double duration)
 {
 	_duration = duration;
@@ -192,6 +232,24 @@ void Timeline::calculateAcceleration()
 	}
 }
 
+void Timeline::step()
+{
+	// Determine if we have reached the goal value or not
+	if (_runTime >= _duration)
+	{
+		_state = FINISHED;
+	}
+
+	// Generate the new step value
+	generateStep();
+
+	// Notify the owner last since the callback may restart the timeline
+	if (_state == FINISHED && _finishedCallback)
+	{
+		_finishedCallback(*this);
+	}
+}
+
 void Timeline::generateStep()
 {
 	// Return the EXACT value if this is the last iteration
@@ -280,6 +338,22 @@ void Timeline::generateStep()
 			}
 		}
 	}
+	else if (_curveShape == CUSTOM_CURVE && _curve) // CUSTOM_CURVE
+	{
+		const double covered = (_endOutput - _startOutput) * _curve->evaluate(_runTime / _duration);
+		if (_direction == FORWARDS)
+		{
+			newStepValue = _startOutput + covered;
+			_stepIncrement = newStepValue - _stepValue;
+			_stepValue = newStepValue;
+		}
+		else
+		{
+			newStepValue = _endOutput - covered;
+			_stepIncrement = newStepValue - _stepValue;
+			_stepValue = newStepValue;
+		}
+	}
 	else // LINEAR_CURVE
 	{
 		if (_direction == FORWARDS)
@@ -0,0 +1,291 @@
+//
+//	TimelineCurve.cpp
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+// C++ headers
+#include <algorithm>
+#include <cmath>
+
+// Bump headers
+#include <bump/InvalidArgumentError.h>
+#include <bump/TimelineCurve.h>
+
+namespace bump {
+
+namespace {
+
+/** Orders points by their progress. */
+bool progressLess(double progress, const PiecewiseLinearCurve::Point& point)
+{
+	return progress < point.first;
+}
+
+}	// End of anonymous namespace
+
+//====================================================================================
+//                                   TimelineCurve
+//====================================================================================
+
+TimelineCurve::~TimelineCurve()
+{
+	;
+}
+
+//====================================================================================
+//                                  CubicBezierCurve
+//====================================================================================
+
+CubicBezierCurve::CubicBezierCurve(double x1, double y1, double x2, double y2)
+{
+	// The progress has to keep increasing for the curve to be a function of it
+	if (x1 < 0.0 || x1 > 1.0 || x2 < 0.0 || x2 > 1.0)
+	{
+		throw InvalidArgumentError("The control point progress must be between 0 and 1", BUMP_LOCATION);
+	}
+
+	// Expand the Bézier polynomial with the end points fixed at (0, 0) and (1, 1)
+	_cx = 3.0 * x1;
+	_bx = 3.0 * (x2 - x1) - _cx;
+	_ax = 1.0 - _cx - _bx;
+	_cy = 3.0 * y1;
+	_by = 3.0 * (y2 - y1) - _cy;
+	_ay = 1.0 - _cy - _by;
+}
+
+CubicBezierCurve::~CubicBezierCurve()
+{
+	;
+}
+
+double CubicBezierCurve::evaluate(double progress) const
+{
+	const double t = solveParameter(progress);
+	return ((_ay * t + _by) * t + _cy) * t;
+}
+
+double CubicBezierCurve::solveParameter(double progress) const
+{
+	if (progress <= 0.0)
+	{
+		return 0.0;
+	}
+	else if (progress >= 1.0)
+	{
+		return 1.0;
+	}
+
+	// Newton's method converges in a few iterations unless the slope is close to flat
+	const double epsilon = 1e-9;
+	double t = progress;
+	for (unsigned int i = 0; i < 8; ++i)
+	{
+		const double error = ((_ax * t + _bx) * t + _cx) * t - progress;
+		if (std::fabs(error) < epsilon)
+		{
+			return t;
+		}
+
+		const double slope = (3.0 * _ax * t + 2.0 * _bx) * t + _cx;
+		if (std::fabs(slope) < 1e-6)
+		{
+			break;
+		}
+
+		t -= error / slope;
+	}
+
+	// Fall back to bisection, which always converges since x increases with t
+	double lower = 0.0;
+	double upper = 1.0;
+	t = progress;
+	for (unsigned int i = 0; i < 64; ++i)
+	{
+		const double x = ((_ax * t + _bx) * t + _cx) * t;
+		if (std::fabs(x - progress) < epsilon)
+		{
+			break;
+		}
+
+		if (x < progress)
+		{
+			lower = t;
+		}
+		else
+		{
+			upper = t;
+		}
+
+		t = (lower + upper) / 2.0;
+	}
+
+	return t;
+}
+
+//====================================================================================
+//                                    SpringCurve
+//====================================================================================
+
+SpringCurve::SpringCurve(double dampingRatio, double frequency) :
+	_dampingRatio(dampingRatio),
+	_frequency(frequency)
+{
+	if (dampingRatio < 0.0)
+	{
+		throw InvalidArgumentError("The spring damping ratio cannot be negative", BUMP_LOCATION);
+	}
+	else if (frequency <= 0.0)
+	{
+		throw InvalidArgumentError("The spring frequency must be positive", BUMP_LOCATION);
+	}
+}
+
+SpringCurve::~SpringCurve()
+{
+	;
+}
+
+double SpringCurve::evaluate(double progress) const
+{
+	const double t = std::min(std::max(progress, 0.0), 1.0);
+	const double zeta = _dampingRatio;
+	const double omega = _frequency;
+
+	if (zeta < 1.0) // Underdamped
+	{
+		const double dampedFrequency = omega * std::sqrt(1.0 - zeta * zeta);
+		const double envelope = std::exp(-zeta * omega * t);
+		return 1.0 - envelope * (std::cos(dampedFrequency * t) + (zeta * omega / dampedFrequency) * std::sin(dampedFrequency * t));
+	}
+	else if (zeta == 1.0) // Critically damped
+	{
+		return 1.0 - std::exp(-omega * t) * (1.0 + omega * t);
+	}
+	else // Overdamped
+	{
+		const double root = std::sqrt(zeta * zeta - 1.0);
+		const double slow = -omega * (zeta - root);
+		const double fast = -omega * (zeta + root);
+		return 1.0 - (fast * std::exp(slow * t) - slow * std::exp(fast * t)) / (fast - slow);
+	}
+}
+
+//====================================================================================
+//                                     StepCurve
+//====================================================================================
+
+StepCurve::StepCurve(unsigned int steps) :
+	_steps(steps)
+{
+	if (steps == 0)
+	{
+		throw InvalidArgumentError("A step curve needs at least one step", BUMP_LOCATION);
+	}
+}
+
+StepCurve::~StepCurve()
+{
+	;
+}
+
+double StepCurve::evaluate(double progress) const
+{
+	const double clamped = std::min(std::max(progress, 0.0), 1.0);
+	return std::floor(clamped * _steps) / _steps;
+}
+
+//====================================================================================
+//                                PiecewiseLinearCurve
+//====================================================================================
+
+PiecewiseLinearCurve::PiecewiseLinearCurve(const std::vector<Point>& points) :
+	_points(points)
+{
+	if (points.empty())
+	{
+		throw InvalidArgumentError("A piecewise linear curve needs at least one point", BUMP_LOCATION);
+	}
+
+	for (std::size_t i = 1; i < points.size(); ++i)
+	{
+		if (points[i].first < points[i - 1].first)
+		{
+			throw InvalidArgumentError("The piecewise linear curve points must be sorted by progress", BUMP_LOCATION);
+		}
+	}
+}
+
+PiecewiseLinearCurve::~PiecewiseLinearCurve()
+{
+	;
+}
+
+double PiecewiseLinearCurve::evaluate(double progress) const
+{
+	// Find the first point past the progress, which keeps vertical segments from dividing by zero
+	std::vector<Point>::const_iterator next = std::upper_bound(_points.begin(), _points.end(), progress, progressLess);
+	if (next == _points.begin())
+	{
+		return _points.front().second;
+	}
+	else if (next == _points.end())
+	{
+		return _points.back().second;
+	}
+
+	const Point& previous = *(next - 1);
+	const double fraction = (progress - previous.first) / (next->first - previous.first);
+	return previous.second + (next->second - previous.second) * fraction;
+}
+
+//====================================================================================
+//                                  LookupTableCurve
+//====================================================================================
+
+LookupTableCurve::LookupTableCurve(const TimelineCurve& curve, unsigned int samples) :
+	_scale(samples - 1.0),
+	_values()
+{
+	if (samples < 2)
+	{
+		throw InvalidArgumentError("A lookup table curve needs at least 2 samples", BUMP_LOCATION);
+	}
+
+	_values.reserve(samples + 1);
+	for (unsigned int i = 0; i < samples; ++i)
+	{
+		_values.push_back(curve.evaluate(i / _scale));
+	}
+
+	// Repeat the last sample so a progress of 1 can interpolate without a branch
+	_values.push_back(_values.back());
+}
+
+LookupTableCurve::~LookupTableCurve()
+{
+	;
+}
+
+double LookupTableCurve::evaluate(double progress) const
+{
+	// Map NaN to 0 along with negative progress, since std::max would pass it through to the cast
+	if (!(progress > 0.0))
+	{
+		progress = 0.0;
+	}
+
+	const double position = std::min(progress, 1.0) * _scale;
+	const std::size_t index = static_cast<std::size_t>(position);
+	const double fraction = position - index;
+	return _values[index] + (_values[index + 1] - _values[index]) * fraction;
+}
+
+unsigned int LookupTableCurve::samples() const
+{
+	return static_cast<unsigned int>(_values.size() - 1);
+}
+
+}	// End of bump namespace
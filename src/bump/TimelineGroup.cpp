@@ -0,0 +1,531 @@
+//
+//	TimelineGroup.cpp
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+// C++ headers
+#include <limits>
+
+// Bump headers
+#include <bump/OutOfRangeError.h>
+#include <bump/TimelineGroup.h>
+
+// Evaluate two timelines per instruction with SSE2 when the target guarantees it
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define BUMP_TIMELINE_GROUP_SSE2
+	#include <emmintrin.h>
+#endif
+
+namespace bump {
+
+namespace {
+
+//====================================================================================
+//                                       Curves
+//====================================================================================
+
+// Each curve maps the progress of a timeline (0 to 1) to the fraction of its output range
+// covered. These are the Timeline curves with the duration and output range factored out.
+
+struct LinearCurve
+{
+	static double evaluate(double u)
+	{
+		return u;
+	}
+
+#ifdef BUMP_TIMELINE_GROUP_SSE2
+	static __m128d evaluate(__m128d u)
+	{
+		return u;
+	}
+#endif
+};
+
+struct EaseInCurve
+{
+	static double evaluate(double u)
+	{
+		return u * u;
+	}
+
+#ifdef BUMP_TIMELINE_GROUP_SSE2
+	static __m128d evaluate(__m128d u)
+	{
+		return _mm_mul_pd(u, u);
+	}
+#endif
+};
+
+struct EaseOutCurve
+{
+	static double evaluate(double u)
+	{
+		const double remaining = 1.0 - u;
+		return 1.0 - remaining * remaining;
+	}
+
+#ifdef BUMP_TIMELINE_GROUP_SSE2
+	static __m128d evaluate(__m128d u)
+	{
+		const __m128d one = _mm_set1_pd(1.0);
+		const __m128d remaining = _mm_sub_pd(one, u);
+		return _mm_sub_pd(one, _mm_mul_pd(remaining, remaining));
+	}
+#endif
+};
+
+struct EaseInAndOutCurve
+{
+	static double evaluate(double u)
+	{
+		const double remaining = 1.0 - u;
+		return u < 0.5 ? 2.0 * u * u : 1.0 - 2.0 * remaining * remaining;
+	}
+
+#ifdef BUMP_TIMELINE_GROUP_SSE2
+	static __m128d evaluate(__m128d u)
+	{
+		// Evaluate both halves and select with a mask rather than branching
+		const __m128d one = _mm_set1_pd(1.0);
+		const __m128d two = _mm_set1_pd(2.0);
+		const __m128d remaining = _mm_sub_pd(one, u);
+		const __m128d easeIn = _mm_mul_pd(two, _mm_mul_pd(u, u));
+		const __m128d easeOut = _mm_sub_pd(one, _mm_mul_pd(two, _mm_mul_pd(remaining, remaining)));
+		const __m128d firstHalf = _mm_cmplt_pd(u, _mm_set1_pd(0.5));
+		return _mm_or_pd(_mm_and_pd(firstHalf, easeIn), _mm_andnot_pd(firstHalf, easeOut));
+	}
+#endif
+};
+
+/**
+ * Evaluates every timeline of a curve pool at the given time, storing the new step values and
+ * increments and appending the indices of the timelines that reached the end.
+ */
+template <class Curve>
+void evaluateCurves(std::size_t count, double time, const double* startTimes, const double* inverseDurations,
+					const double* bases, const double* scales, double* values, double* increments,
+					std::vector<std::size_t>& finishedIndices)
+{
+	std::size_t i = 0;
+
+#ifdef BUMP_TIMELINE_GROUP_SSE2
+	const __m128d now = _mm_set1_pd(time);
+	const __m128d zero = _mm_setzero_pd();
+	const __m128d one = _mm_set1_pd(1.0);
+	for (; i + 2 <= count; i += 2)
+	{
+		__m128d progress = _mm_mul_pd(_mm_sub_pd(now, _mm_loadu_pd(startTimes + i)), _mm_loadu_pd(inverseDurations + i));
+		progress = _mm_min_pd(_mm_max_pd(progress, zero), one);
+
+		const __m128d value = _mm_add_pd(_mm_loadu_pd(bases + i), _mm_mul_pd(_mm_loadu_pd(scales + i), Curve::evaluate(progress)));
+		_mm_storeu_pd(increments + i, _mm_sub_pd(value, _mm_loadu_pd(values + i)));
+		_mm_storeu_pd(values + i, value);
+
+		const int finished = _mm_movemask_pd(_mm_cmpge_pd(progress, one));
+		if (finished != 0)
+		{
+			if (finished & 1)
+			{
+				finishedIndices.push_back(i);
+			}
+			if (finished & 2)
+			{
+				finishedIndices.push_back(i + 1);
+			}
+		}
+	}
+#endif
+
+	for (; i < count; ++i)
+	{
+		double progress = (time - startTimes[i]) * inverseDurations[i];
+		progress = progress > 0.0 ? (progress < 1.0 ? progress : 1.0) : 0.0;
+
+		const double value = bases[i] + scales[i] * Curve::evaluate(progress);
+		increments[i] = value - values[i];
+		values[i] = value;
+
+		if (progress >= 1.0)
+		{
+			finishedIndices.push_back(i);
+		}
+	}
+}
+
+/**
+ * Evaluates every timeline of the custom curve pool the same way as evaluateCurves(), calling
+ * the curve of each timeline.
+ */
+void evaluateCustomCurves(std::size_t count, double time, const double* startTimes, const double* inverseDurations,
+						  const TimelineCurve* const* curves, const double* bases, const double* scales, double* values,
+						  double* increments, std::vector<std::size_t>& finishedIndices)
+{
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		double progress = (time - startTimes[i]) * inverseDurations[i];
+		progress = progress > 0.0 ? (progress < 1.0 ? progress : 1.0) : 0.0;
+
+		const double value = bases[i] + scales[i] * curves[i]->evaluate(progress);
+		increments[i] = value - values[i];
+		values[i] = value;
+
+		if (progress >= 1.0)
+		{
+			finishedIndices.push_back(i);
+		}
+	}
+}
+
+}	// End of anonymous namespace
+
+//====================================================================================
+//                                   TimelineGroup
+//====================================================================================
+
+TimelineGroup::TimelineGroup() :
+	_timer(),
+	_time(0.0)
+{
+	;
+}
+
+TimelineGroup::~TimelineGroup()
+{
+	;
+}
+
+TimelineGroup::Id TimelineGroup::add(double duration, const Timeline::Direction& direction, const Timeline::CurveShape& curveShape)
+{
+	Record newRecord;
+	newRecord.inUse = true;
+	newRecord.state = Timeline::NOT_RUNNING;
+	newRecord.direction = direction;
+	newRecord.curveShape = curveShape == Timeline::CUSTOM_CURVE ? Timeline::LINEAR_CURVE : curveShape;
+	newRecord.duration = duration;
+	newRecord.startOutput = 0.0;
+	newRecord.endOutput = 100.0;
+	newRecord.runTime = 0.0;
+	newRecord.stepValue = 0.0;
+	newRecord.stepIncrement = 0.0;
+	newRecord.poolIndex = 0;
+
+	return insert(newRecord);
+}
+
+TimelineGroup::Id TimelineGroup::add(double duration, const Timeline::Direction& direction, const boost::shared_ptr<const TimelineCurve>& curve)
+{
+	Id id = add(duration, direction, Timeline::LINEAR_CURVE);
+	if (curve)
+	{
+		_records[id].curveShape = Timeline::CUSTOM_CURVE;
+		_records[id].curve = curve;
+	}
+
+	return id;
+}
+
+TimelineGroup::Id TimelineGroup::insert(const Record& newRecord)
+{
+	if (_freeIds.empty())
+	{
+		_records.push_back(newRecord);
+		return _records.size() - 1;
+	}
+
+	const Id id = _freeIds.back();
+	_freeIds.pop_back();
+	_records[id] = newRecord;
+	return id;
+}
+
+void TimelineGroup::remove(Id id)
+{
+	Record& timeline = record(id);
+	if (timeline.state == Timeline::RUNNING)
+	{
+		deactivate(id);
+	}
+
+	timeline.inUse = false;
+	timeline.curve.reset();
+	_freeIds.push_back(id);
+}
+
+void TimelineGroup::clear()
+{
+	_records.clear();
+	_freeIds.clear();
+	for (unsigned int i = 0; i <= Timeline::CUSTOM_CURVE; ++i)
+	{
+		_pools[i] = CurvePool();
+	}
+	_finished.clear();
+}
+
+std::size_t TimelineGroup::size() const
+{
+	return _records.size() - _freeIds.size();
+}
+
+std::size_t TimelineGroup::runningCount() const
+{
+	std::size_t count = 0;
+	for (unsigned int i = 0; i <= Timeline::CUSTOM_CURVE; ++i)
+	{
+		count += _pools[i].ids.size();
+	}
+
+	return count;
+}
+
+void TimelineGroup::setOutputRange(Id id, double startOutput, double endOutput)
+{
+	Record& timeline = record(id);
+	timeline.startOutput = startOutput;
+	timeline.endOutput = endOutput;
+}
+
+void TimelineGroup::start(Id id)
+{
+	Record& timeline = record(id);
+	if (timeline.state == Timeline::NOT_RUNNING || timeline.state == Timeline::FINISHED)
+	{
+		// Reset the step value and step increment like Timeline::start()
+		timeline.state = Timeline::RUNNING;
+		activate(id, _time, 0.0, 0.0);
+	}
+	else if (timeline.state == Timeline::PAUSED)
+	{
+		unpause(id);
+	}
+	else // timeline.state == Timeline::RUNNING
+	{
+		// Simply ignore if we're already running
+	}
+}
+
+void TimelineGroup::restart(Id id)
+{
+	stop(id);
+	start(id);
+}
+
+void TimelineGroup::stop(Id id)
+{
+	Record& timeline = record(id);
+	if (timeline.state == Timeline::RUNNING)
+	{
+		deactivate(id);
+	}
+
+	timeline.state = Timeline::NOT_RUNNING;
+}
+
+void TimelineGroup::pause(Id id)
+{
+	Record& timeline = record(id);
+	if (timeline.state == Timeline::RUNNING)
+	{
+		timeline.runTime = _time - _pools[timeline.curveShape].startTimes[timeline.poolIndex];
+		deactivate(id);
+		timeline.state = Timeline::PAUSED;
+	}
+}
+
+void TimelineGroup::unpause(Id id)
+{
+	Record& timeline = record(id);
+	if (timeline.state == Timeline::PAUSED)
+	{
+		timeline.state = Timeline::RUNNING;
+		activate(id, _time - timeline.runTime, timeline.stepValue, timeline.stepIncrement);
+	}
+}
+
+void TimelineGroup::update()
+{
+	update(_timer.secondsElapsed());
+}
+
+void TimelineGroup::update(double time)
+{
+	if (time > _time)
+	{
+		_time = time;
+	}
+
+	_finished.clear();
+	for (unsigned int shape = 0; shape <= Timeline::CUSTOM_CURVE; ++shape)
+	{
+		CurvePool& pool = _pools[shape];
+		const std::size_t count = pool.ids.size();
+		if (count == 0)
+		{
+			continue;
+		}
+
+		_finishedIndices.clear();
+		const double* startTimes = &pool.startTimes[0];
+		const double* inverseDurations = &pool.inverseDurations[0];
+		const double* bases = &pool.bases[0];
+		const double* scales = &pool.scales[0];
+		double* values = &pool.values[0];
+		double* increments = &pool.increments[0];
+
+		if (shape == Timeline::EASE_IN_CURVE)
+		{
+			evaluateCurves<EaseInCurve>(count, _time, startTimes, inverseDurations, bases, scales, values, increments, _finishedIndices);
+		}
+		else if (shape == Timeline::EASE_OUT_CURVE)
+		{
+			evaluateCurves<EaseOutCurve>(count, _time, startTimes, inverseDurations, bases, scales, values, increments, _finishedIndices);
+		}
+		else if (shape == Timeline::EASE_IN_AND_OUT_CURVE)
+		{
+			evaluateCurves<EaseInAndOutCurve>(count, _time, startTimes, inverseDurations, bases, scales, values, increments, _finishedIndices);
+		}
+		else if (shape == Timeline::CUSTOM_CURVE)
+		{
+			evaluateCustomCurves(count, _time, startTimes, inverseDurations, &pool.curves[0], bases, scales, values, increments, _finishedIndices);
+		}
+		else // LINEAR_CURVE
+		{
+			evaluateCurves<LinearCurve>(count, _time, startTimes, inverseDurations, bases, scales, values, increments, _finishedIndices);
+		}
+
+		// Retire the finished timelines from the back so the remaining indices stay valid
+		for (std::size_t i = _finishedIndices.size(); i > 0; --i)
+		{
+			const Id id = pool.ids[_finishedIndices[i - 1]];
+			Record& timeline = _records[id];
+			deactivate(id);
+			timeline.state = Timeline::FINISHED;
+
+			// Return the EXACT end value like Timeline does
+			const double endValue = timeline.direction == Timeline::FORWARDS ? timeline.endOutput : timeline.startOutput;
+			timeline.stepIncrement += endValue - timeline.stepValue;
+			timeline.stepValue = endValue;
+
+			_finished.push_back(id);
+		}
+	}
+}
+
+double TimelineGroup::time() const
+{
+	return _time;
+}
+
+const std::vector<TimelineGroup::Id>& TimelineGroup::finished() const
+{
+	return _finished;
+}
+
+Timeline::State TimelineGroup::state(Id id) const
+{
+	return record(id).state;
+}
+
+double TimelineGroup::stepValue(Id id) const
+{
+	const Record& timeline = record(id);
+	if (timeline.state == Timeline::RUNNING)
+	{
+		return _pools[timeline.curveShape].values[timeline.poolIndex];
+	}
+
+	return timeline.stepValue;
+}
+
+double TimelineGroup::stepIncrement(Id id) const
+{
+	const Record& timeline = record(id);
+	if (timeline.state == Timeline::RUNNING)
+	{
+		return _pools[timeline.curveShape].increments[timeline.poolIndex];
+	}
+
+	return timeline.stepIncrement;
+}
+
+const TimelineGroup::Record& TimelineGroup::record(Id id) const
+{
+	if (id >= _records.size() || !_records[id].inUse)
+	{
+		throw OutOfRangeError("Timeline id " + String(id) + " is not in the group", BUMP_LOCATION);
+	}
+
+	return _records[id];
+}
+
+TimelineGroup::Record& TimelineGroup::record(Id id)
+{
+	if (id >= _records.size() || !_records[id].inUse)
+	{
+		throw OutOfRangeError("Timeline id " + String(id) + " is not in the group", BUMP_LOCATION);
+	}
+
+	return _records[id];
+}
+
+void TimelineGroup::activate(Id id, double startTime, double stepValue, double stepIncrement)
+{
+	Record& timeline = _records[id];
+	CurvePool& pool = _pools[timeline.curveShape];
+
+	// Backwards timelines run down from the end output
+	const double range = timeline.endOutput - timeline.startOutput;
+	const bool forwards = timeline.direction == Timeline::FORWARDS;
+
+	// A zero duration finishes on the first update after it starts
+	const double inverseDuration = timeline.duration > 0.0 ? 1.0 / timeline.duration : std::numeric_limits<double>::max();
+
+	timeline.poolIndex = pool.ids.size();
+	pool.ids.push_back(id);
+	pool.startTimes.push_back(startTime);
+	pool.curves.push_back(timeline.curve.get());
+	pool.inverseDurations.push_back(inverseDuration);
+	pool.bases.push_back(forwards ? timeline.startOutput : timeline.endOutput);
+	pool.scales.push_back(forwards ? range : -range);
+	pool.values.push_back(stepValue);
+	pool.increments.push_back(stepIncrement);
+}
+
+void TimelineGroup::deactivate(Id id)
+{
+	Record& timeline = _records[id];
+	CurvePool& pool = _pools[timeline.curveShape];
+	const std::size_t index = timeline.poolIndex;
+	timeline.stepValue = pool.values[index];
+	timeline.stepIncrement = pool.increments[index];
+
+	// Move the last timeline of the pool into the hole
+	const std::size_t last = pool.ids.size() - 1;
+	if (index != last)
+	{
+		pool.ids[index] = pool.ids[last];
+		pool.startTimes[index] = pool.startTimes[last];
+		pool.curves[index] = pool.curves[last];
+		pool.inverseDurations[index] = pool.inverseDurations[last];
+		pool.bases[index] = pool.bases[last];
+		pool.scales[index] = pool.scales[last];
+		pool.values[index] = pool.values[last];
+		pool.increments[index] = pool.increments[last];
+		_records[pool.ids[index]].poolIndex = index;
+	}
+
+	pool.ids.pop_back();
+	pool.startTimes.pop_back();
+	pool.curves.pop_back();
+	pool.inverseDurations.pop_back();
+	pool.bases.pop_back();
+	pool.scales.pop_back();
+	pool.values.pop_back();
+	pool.increments.pop_back();
+}
+
+}	// End of bump namespace
@@ -7,21 +7,108 @@
 //
 
 // Boost headers
+#include <boost/chrono.hpp>
 #include <boost/thread/mutex.hpp>
+#include <boost/thread/once.hpp>
 
 // Bump headers
-#include <bump/String.h>
 #include <bump/Timer.h>
 
+// The time stamp counter is only read on x86 processors
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+	#define BUMP_TIMER_TSC
+	#if defined(_MSC_VER)
+		#include <intrin.h>
+	#else
+		#include <cpuid.h>
+		#include <x86intrin.h>
+	#endif
+#endif
+
 namespace bump {
 
 // Global singleton mutex
 static boost::mutex gTimerSingletonMutex;
 
-Timer::Timer() :
-	_timer()
+// The calibrated length of a time stamp counter tick in nanoseconds, or 0 if there is no invariant counter
+static double gNanosecondsPerTimeStampCounterTick = 0.0;
+static boost::once_flag gTimeStampCounterCalibrated = BOOST_ONCE_INIT;
+
+namespace {
+
+/** Reads the time stamp counter. */
+inline unsigned long long readTimeStampCounter()
 {
-	;
+#ifdef BUMP_TIMER_TSC
+	return __rdtsc();
+#else
+	return 0;
+#endif
+}
+
+/** Determines whether the counter runs at a constant rate regardless of power states. */
+bool hasInvariantTimeStampCounter()
+{
+#if defined(BUMP_TIMER_TSC) && defined(_MSC_VER)
+	int registers[4];
+	__cpuid(registers, 0x80000000);
+	if ((unsigned int) registers[0] < 0x80000007)
+	{
+		return false;
+	}
+	__cpuid(registers, 0x80000007);
+	return (registers[3] & (1 << 8)) != 0;
+#elif defined(BUMP_TIMER_TSC)
+	unsigned int eax, ebx, ecx, edx;
+	if (__get_cpuid_max(0x80000000, NULL) < 0x80000007 || !__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx))
+	{
+		return false;
+	}
+	return (edx & (1 << 8)) != 0;
+#else
+	return false;
+#endif
+}
+
+/** Measures the counter frequency against the steady clock over about 10 milliseconds. */
+void calibrateTimeStampCounter()
+{
+	if (!hasInvariantTimeStampCounter())
+	{
+		return;
+	}
+
+	const unsigned long long startNanoseconds = Timer::steadyNanoseconds();
+	const unsigned long long startTicks = readTimeStampCounter();
+	unsigned long long nanoseconds = startNanoseconds;
+	while (nanoseconds - startNanoseconds < 10000000)
+	{
+		nanoseconds = Timer::steadyNanoseconds();
+	}
+	const unsigned long long ticks = readTimeStampCounter();
+
+	if (ticks > startTicks)
+	{
+		gNanosecondsPerTimeStampCounterTick = double(nanoseconds - startNanoseconds) / double(ticks - startTicks);
+	}
+}
+
+}	// End of anonymous namespace
+
+Timer::Timer(const Clock& clock) :
+	_clock(STEADY_CLOCK),
+	_nanosecondsPerTick(1.0),
+	_startTicks(0),
+	_pausedTicks(0),
+	_paused(false)
+{
+	if (clock == TIME_STAMP_COUNTER && isTimeStampCounterAvailable())
+	{
+		_clock = TIME_STAMP_COUNTER;
+		_nanosecondsPerTick = gNanosecondsPerTimeStampCounterTick;
+	}
+
+	start();
 }
 
 Timer::~Timer()
@@ -36,48 +123,92 @@ Timer* Timer::instance()
 	return &timer;
 }
 
+bool Timer::isTimeStampCounterAvailable()
+{
+	boost::call_once(gTimeStampCounterCalibrated, calibrateTimeStampCounter);
+	return gNanosecondsPerTimeStampCounterTick > 0.0;
+}
+
+unsigned long long Timer::steadyNanoseconds()
+{
+	return boost::chrono::duration_cast<boost::chrono::nanoseconds>(
+		boost::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+Timer::Clock Timer::clock() const
+{
+	return _clock;
+}
+
 void Timer::start()
 {
-	_timer.start();
+	_pausedTicks = 0;
+	_paused = false;
+	_startTicks = ticks();
 }
 
 void Timer::pause()
 {
-	_timer.stop();
+	if (!_paused)
+	{
+		_pausedTicks += ticks() - _startTicks;
+		_paused = true;
+	}
 }
 
 void Timer::unpause()
 {
-	_timer.resume();
+	if (_paused)
+	{
+		_paused = false;
+		_startTicks = ticks();
+	}
 }
 
 void Timer::restart()
 {
-	_timer.start();
+	start();
+}
+
+unsigned long long Timer::elapsedNanoseconds() const
+{
+	const unsigned long long elapsedTicks = _paused ? _pausedTicks : _pausedTicks + (ticks() - _startTicks);
+	return ticksToNanoseconds(elapsedTicks);
 }
 
 double Timer::secondsElapsed() const
 {
-	String elapsed_time = boost::timer::format(_timer.elapsed(), boost::timer::default_places, "%w");
-	return elapsed_time.toDouble();
+	return elapsedNanoseconds() * 1e-9;
 }
 
 double Timer::millisecondsElapsed() const
 {
-	String elapsed_time = boost::timer::format(_timer.elapsed(), boost::timer::default_places, "%w");
-	return elapsed_time.toDouble() * 1e3;
+	return elapsedNanoseconds() * 1e-6;
 }
 
 double Timer::microsecondsElapsed() const
 {
-	String elapsed_time = boost::timer::format(_timer.elapsed(), boost::timer::default_places, "%w");
-	return elapsed_time.toDouble() * 1e6;
+	return elapsedNanoseconds() * 1e-3;
 }
 
 double Timer::nanosecondsElapsed() const
 {
-	String elapsed_time = boost::timer::format(_timer.elapsed(), boost::timer::default_places, "%w");
-	return elapsed_time.toDouble() * 1e9;
+	return (double) elapsedNanoseconds();
+}
+
+unsigned long long Timer::ticks() const
+{
+	return _clock == TIME_STAMP_COUNTER ? readTimeStampCounter() : steadyNanoseconds();
+}
+
+unsigned long long Timer::ticksToNanoseconds(unsigned long long ticks) const
+{
+	if (_clock == STEADY_CLOCK)
+	{
+		return ticks;
+	}
+
+	return (unsigned long long) (ticks * _nanosecondsPerTick);
 }
 
 }	// End of bump namespace
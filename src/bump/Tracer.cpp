@@ -0,0 +1,462 @@
+//
+//	Tracer.cpp
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+// C++ headers
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+// Boost headers
+#include <boost/atomic.hpp>
+#include <boost/thread/mutex.hpp>
+
+// Bump headers
+#include <bump/Environment.h>
+#include <bump/EnvironmentSetting.h>
+#include <bump/Timer.h>
+#include <bump/Tracer.h>
+#include "ThreadLocal.h"
+
+namespace bump {
+
+namespace {
+
+// Each thread buffers up to this many events between flushes
+const std::size_t BUFFER_CAPACITY = 65536;
+
+/** A recorded event. The strings point at literals so recording never copies or allocates. */
+struct Event
+{
+	unsigned long long	nanoseconds;
+	const char*			category;
+	const char*			name;
+	const char*			argumentName;
+	double				argumentValue;
+	char				phase;
+};
+
+/**
+ * The events of a thread, in a ring buffer with a single writer and a single reader. The thread
+ * only writes events into the slots flush() has drained, and publishes them by advancing the
+ * written count, and flush() hands the slots back by advancing the flushed count.
+ */
+struct ThreadBuffer
+{
+	ThreadBuffer(unsigned int id) :
+		id(id),
+		name(),
+		events(new Event[BUFFER_CAPACITY]),
+		written(0),
+		flushed(0)
+	{
+		;
+	}
+
+	~ThreadBuffer()
+	{
+		delete [] events;
+	}
+
+	unsigned int				id;			/**< The thread id shown in the trace. */
+	String						name;		/**< The thread name, guarded by the registry mutex. */
+	Event*						events;		/**< The ring of events. */
+	boost::atomic<std::size_t>	written;	/**< The number of events the thread has published. */
+	boost::atomic<std::size_t>	flushed;	/**< The number of events flush() has drained. */
+};
+
+/** The tracing settings and the buffers of every thread that has recorded an event. */
+struct Registry
+{
+	Registry() :
+		mutex(),
+		buffers(),
+		clock(Timer::TIME_STAMP_COUNTER),
+		enabled(false),
+		sampleInterval(1),
+		droppedEvents(0),
+		traceFile(),
+		isFileStarted(false)
+	{
+		// Attempt to enable tracing based on the "BUMP_TRACE_FILE" environment variable
+		traceFile = bump::Environment::environmentVariable(BUMP_TRACE_FILE);
+		if (!traceFile.empty())
+		{
+			enabled.store(true, boost::memory_order_relaxed);
+			std::cout << "[bump] Setting BUMP_TRACE_FILE to " << traceFile << std::endl;
+		}
+
+		// Attempt to set the sample interval based on the "BUMP_TRACE_SAMPLE_INTERVAL" environment variable.
+		// It is copied once since setSampleInterval() may change it, so EnvironmentSetting::reloadAll() does not affect it.
+		static const IntSetting intervalSetting(BUMP_TRACE_SAMPLE_INTERVAL, 1, "Traces one of every so many scopes on each thread", 1, 4294967295LL);
+		if (intervalSetting.isSet())
+		{
+			sampleInterval.store(static_cast<unsigned int>(intervalSetting.value()), boost::memory_order_relaxed);
+			std::cout << "[bump] Setting BUMP_TRACE_SAMPLE_INTERVAL to " << intervalSetting.value() << std::endl;
+		}
+	}
+
+	~Registry()
+	{
+		// Write out whatever the threads recorded since the last flush, through this registry
+		// since registry() must not be called while it is being destroyed
+		if (!traceFile.empty())
+		{
+			flush();
+		}
+
+		for (std::size_t i = 0; i < buffers.size(); ++i)
+		{
+			delete buffers[i];
+		}
+	}
+
+	/** Drains every thread's buffer into the trace file. */
+	bool flush();
+
+	/** Returns the calling thread's buffer, creating it on the thread's first event. */
+	ThreadBuffer* threadBuffer();
+
+	boost::mutex						mutex;
+	std::vector<ThreadBuffer*>			buffers;
+	Timer								clock;
+	boost::atomic<bool>					enabled;
+	boost::atomic<unsigned int>			sampleInterval;
+	boost::atomic<unsigned long long>	droppedEvents;
+	String								traceFile;
+	bool								isFileStarted;
+};
+
+Registry& registry()
+{
+	static Registry registry;
+	return registry;
+}
+
+// The event buffer of the calling thread, and the number of scopes it has sampled from
+BUMP_THREAD_LOCAL ThreadBuffer* tThreadBuffer = NULL;
+BUMP_THREAD_LOCAL unsigned int tSampleCount = 0;
+
+ThreadBuffer* Registry::threadBuffer()
+{
+	ThreadBuffer* buffer = tThreadBuffer;
+	if (buffer == NULL)
+	{
+		boost::mutex::scoped_lock lock(mutex);
+		buffer = new ThreadBuffer(static_cast<unsigned int>(buffers.size() + 1));
+		buffers.push_back(buffer);
+		tThreadBuffer = buffer;
+	}
+
+	return buffer;
+}
+
+/** Appends an event to the calling thread's buffer, dropping it if the buffer is full. */
+void record(char phase, const char* category, const char* name, const char* argumentName, double argumentValue)
+{
+	Registry& tracer = registry();
+	ThreadBuffer* buffer = tracer.threadBuffer();
+	const std::size_t written = buffer->written.load(boost::memory_order_relaxed);
+	if (written - buffer->flushed.load(boost::memory_order_acquire) == BUFFER_CAPACITY)
+	{
+		tracer.droppedEvents.fetch_add(1, boost::memory_order_relaxed);
+		return;
+	}
+
+	Event& event = buffer->events[written % BUFFER_CAPACITY];
+	event.nanoseconds = tracer.clock.elapsedNanoseconds();
+	event.category = category;
+	event.name = name;
+	event.argumentName = argumentName;
+	event.argumentValue = argumentValue;
+	event.phase = phase;
+
+	// flush() only reads the events below the written count, so it sees the event fully written
+	buffer->written.store(written + 1, boost::memory_order_release);
+}
+
+/** Appends a JSON string, escaping the characters JSON does not allow unescaped. */
+void appendString(std::string& json, const char* text)
+{
+	json += '"';
+	for (const char* character = text; *character != '\0'; ++character)
+	{
+		const unsigned char value = static_cast<unsigned char>(*character);
+		if (value == '"' || value == '\\')
+		{
+			json += '\\';
+			json += *character;
+		}
+		else if (value < 0x20)
+		{
+			char escaped[8];
+			std::sprintf(escaped, "\\u%04x", value);
+			json += escaped;
+		}
+		else
+		{
+			json += *character;
+		}
+	}
+	json += '"';
+}
+
+/** Appends an integer without the locale handling of the printf family, which dominates flushing. */
+void appendInteger(std::string& json, unsigned long long value)
+{
+	char digits[24];
+	char* end = digits + sizeof(digits);
+	char* begin = end;
+	do
+	{
+		*--begin = static_cast<char>('0' + value % 10);
+		value /= 10;
+	}
+	while (value != 0);
+	json.append(begin, end);
+}
+
+/**
+ * Appends an event as a line of the trace's JSON array. Formatting into a string rather than the
+ * file stream keeps flush() fast enough to keep up with busy threads.
+ */
+void appendEvent(std::string& json, const Event& event, unsigned int threadId)
+{
+	json += "{\"name\":";
+	appendString(json, event.name);
+	json += ",\"cat\":";
+	appendString(json, event.category);
+	json += ",\"ph\":\"";
+	json += event.phase;
+	json += "\",\"ts\":";
+	appendInteger(json, event.nanoseconds / 1000);
+	json += '.';
+	json += static_cast<char>('0' + event.nanoseconds / 100 % 10);
+	json += static_cast<char>('0' + event.nanoseconds / 10 % 10);
+	json += static_cast<char>('0' + event.nanoseconds % 10);
+	json += ",\"pid\":1,\"tid\":";
+	appendInteger(json, threadId);
+	if (event.phase == 'i')
+	{
+		json += ",\"s\":\"t\"";
+	}
+	if (event.argumentName != NULL)
+	{
+		json += ",\"args\":{";
+		appendString(json, event.argumentName);
+
+		// JSON has no nan or infinity, so those are written as null
+		const double maximum = std::numeric_limits<double>::max();
+		if (event.argumentValue >= -maximum && event.argumentValue <= maximum)
+		{
+			char value[32];
+			std::sprintf(value, ":%.15g}", event.argumentValue);
+			json += value;
+		}
+		else
+		{
+			json += ":null}";
+		}
+	}
+	json += "},\n";
+}
+
+bool Registry::flush()
+{
+	boost::mutex::scoped_lock lock(mutex);
+	if (traceFile.empty())
+	{
+		return false;
+	}
+
+	// The first flush to a file replaces it and opens the JSON array
+	std::ofstream stream;
+	if (isFileStarted)
+	{
+		stream.open(traceFile.c_str(), std::ios::out | std::ios::app);
+	}
+	else
+	{
+		stream.open(traceFile.c_str(), std::ios::out | std::ios::trunc);
+		stream << "[\n";
+	}
+
+	if (!stream.is_open())
+	{
+		return false;
+	}
+	isFileStarted = true;
+
+	std::string json;
+	for (std::size_t i = 0; i < buffers.size(); ++i)
+	{
+		ThreadBuffer& buffer = *buffers[i];
+		const std::size_t flushed = buffer.flushed.load(boost::memory_order_relaxed);
+		const std::size_t written = buffer.written.load(boost::memory_order_acquire);
+		json.reserve((written - flushed) * 128);
+		for (std::size_t j = flushed; j < written; ++j)
+		{
+			const Event& event = buffer.events[j % BUFFER_CAPACITY];
+			if (event.phase == 'M')
+			{
+				json += "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":";
+				appendInteger(json, buffer.id);
+				json += ",\"args\":{\"name\":";
+				appendString(json, buffer.name.c_str());
+				json += "}},\n";
+			}
+			else
+			{
+				appendEvent(json, event, buffer.id);
+			}
+		}
+
+		// Hand the drained slots back to the thread
+		buffer.flushed.store(written, boost::memory_order_release);
+
+		stream.write(json.data(), json.size());
+		json.clear();
+	}
+
+	stream.flush();
+	return stream.good();
+}
+
+}	// End of anonymous namespace
+
+//====================================================================================
+//                                       Tracer
+//====================================================================================
+
+bool Tracer::isEnabled()
+{
+	return registry().enabled.load(boost::memory_order_relaxed);
+}
+
+void Tracer::setEnabled(bool enabled)
+{
+	registry().enabled.store(enabled, boost::memory_order_relaxed);
+}
+
+void Tracer::setSampleInterval(unsigned int interval)
+{
+	registry().sampleInterval.store(interval == 0 ? 1 : interval, boost::memory_order_relaxed);
+}
+
+unsigned int Tracer::sampleInterval()
+{
+	return registry().sampleInterval.load(boost::memory_order_relaxed);
+}
+
+void Tracer::setTraceFile(const String& path)
+{
+	Registry& tracer = registry();
+	boost::mutex::scoped_lock lock(tracer.mutex);
+	tracer.traceFile = path;
+	tracer.isFileStarted = false;
+}
+
+String Tracer::traceFile()
+{
+	Registry& tracer = registry();
+	boost::mutex::scoped_lock lock(tracer.mutex);
+	return tracer.traceFile;
+}
+
+void Tracer::setThreadName(const String& name)
+{
+	// Name the buffer before publishing the metadata event, so flush() never writes it unnamed
+	Registry& tracer = registry();
+	ThreadBuffer* buffer = tracer.threadBuffer();
+	{
+		boost::mutex::scoped_lock lock(tracer.mutex);
+		buffer->name = name;
+	}
+
+	record('M', "", "thread_name", NULL, 0.0);
+}
+
+bool Tracer::flush()
+{
+	return registry().flush();
+}
+
+unsigned long long Tracer::droppedEvents()
+{
+	return registry().droppedEvents.load(boost::memory_order_relaxed);
+}
+
+void Tracer::beginEvent(const char* category, const char* name, const char* argumentName, double argumentValue)
+{
+	if (isEnabled())
+	{
+		record('B', category, name, argumentName, argumentValue);
+	}
+}
+
+void Tracer::endEvent(const char* category, const char* name)
+{
+	// Durations are ended even if tracing was disabled since they began so they stay balanced
+	record('E', category, name, NULL, 0.0);
+}
+
+void Tracer::instantEvent(const char* category, const char* name, const char* argumentName, double argumentValue)
+{
+	if (isEnabled())
+	{
+		record('i', category, name, argumentName, argumentValue);
+	}
+}
+
+bool Tracer::sampleScope()
+{
+	Registry& tracer = registry();
+	if (!tracer.enabled.load(boost::memory_order_relaxed))
+	{
+		return false;
+	}
+
+	const unsigned int interval = tracer.sampleInterval.load(boost::memory_order_relaxed);
+	return interval == 1 || tSampleCount++ % interval == 0;
+}
+
+//====================================================================================
+//                                     TraceScope
+//====================================================================================
+
+TraceScope::TraceScope(const char* category, const char* name) :
+	_category(category),
+	_name(Tracer::sampleScope() ? name : NULL)
+{
+	if (_name != NULL)
+	{
+		Tracer::beginEvent(_category, _name);
+	}
+}
+
+TraceScope::TraceScope(const char* category, const char* name, const char* argumentName, double argumentValue) :
+	_category(category),
+	_name(Tracer::sampleScope() ? name : NULL)
+{
+	if (_name != NULL)
+	{
+		Tracer::beginEvent(_category, _name, argumentName, argumentValue);
+	}
+}
+
+TraceScope::~TraceScope()
+{
+	if (_name != NULL)
+	{
+		Tracer::endEvent(_category, _name);
+	}
+}
+
+}	// End of bump namespace
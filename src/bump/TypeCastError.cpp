@@ -11,7 +11,7 @@
 
 namespace bump {
 
-TypeCastError::TypeCastError(const String& description, const String& location) throw() :
+TypeCastError::TypeCastError(const String& description, const SourceLocation& location) throw() :
 	RuntimeError("bump::TypeCastError", description, location)
 {
 	;
@@ -6,19 +6,235 @@
 //	Copyright (c) 2012 Christian Noon. All rights reserved.
 //
 
+// C++ headers
+#include <cstddef>
+#include <cstring>
+
 // Boost headers
+#include <boost/atomic.hpp>
+#include <boost/chrono.hpp>
 #include <boost/uuid/nil_generator.hpp>
-#include <boost/uuid/random_generator.hpp>
-#include <boost/uuid/string_generator.hpp>
-#include <boost/uuid/uuid_io.hpp>
+#include <boost/thread/tss.hpp>
 
 // Bump headers
+#include <bump/Hex.h>
+#include <bump/NotImplementedError.h>
 #include <bump/String.h>
 #include <bump/TypeCastError.h>
 #include <bump/Uuid.h>
 
 namespace bump {
 
+// Implemented in Uuid_unix.cpp and Uuid_win.cpp
+bool readSystemEntropy(unsigned char* bytes, std::size_t size);
+
+namespace {
+
+// Typedefs
+typedef unsigned int uint32;
+typedef unsigned long long uint64;
+
+inline uint32 rotl32(uint32 value, int steps)
+{
+	return (value << steps) | (value >> (32 - steps));
+}
+
+inline uint64 rotl64(uint64 value, int steps)
+{
+	return (value << steps) | (value >> (64 - steps));
+}
+
+/** Sets the version 4 (random) and RFC 4122 variant bits of a uuid. */
+inline void setRandomVersion(Uuid& uuid)
+{
+	uuid.data[6] = (uuid.data[6] & 0x0f) | 0x40;
+	uuid.data[8] = (uuid.data[8] & 0x3f) | 0x80;
+}
+
+/**
+ * @internal
+ * A cryptographically secure generator built on the ChaCha20 block function. Output is produced
+ * a buffer at a time, and the first 32 bytes of every buffer replace the key before the rest is
+ * handed out (fast key erasure), so earlier output cannot be recovered from the generator state.
+ */
+class SecureGenerator
+{
+public:
+
+	SecureGenerator() :
+		_counter(0),
+		_position(sizeof(_buffer))
+	{
+		// Seed the whole key straight from the operating system entropy source
+		if (!readSystemEntropy(reinterpret_cast<unsigned char*>(_key), sizeof(_key)))
+		{
+			throw NotImplementedError("Failed to read the operating system entropy source", BUMP_LOCATION);
+		}
+	}
+
+	~SecureGenerator()
+	{
+		std::memset(_key, 0, sizeof(_key));
+		std::memset(_buffer, 0, sizeof(_buffer));
+	}
+
+	/** Writes 16 random bytes. */
+	void generate(unsigned char* bytes)
+	{
+		if (_position == sizeof(_buffer))
+		{
+			refill();
+		}
+
+		std::memcpy(bytes, _buffer + _position, 16);
+		std::memset(_buffer + _position, 0, 16);
+		_position += 16;
+	}
+
+protected:
+
+	/** Runs the ChaCha20 block function for the given block counter. */
+	void block(uint64 counter, uint32* output) const
+	{
+		uint32 state[16] =
+		{
+			0x61707865, 0x3320646e, 0x79622d32, 0x6b206574,
+			_key[0], _key[1], _key[2], _key[3], _key[4], _key[5], _key[6], _key[7],
+			(uint32) counter, (uint32) (counter >> 32), 0, 0
+		};
+
+		uint32 working[16];
+		std::memcpy(working, state, sizeof(working));
+
+		#define bumpChachaQuarterRound(a, b, c, d) \
+			working[a] += working[b]; working[d] = rotl32(working[d] ^ working[a], 16); \
+			working[c] += working[d]; working[b] = rotl32(working[b] ^ working[c], 12); \
+			working[a] += working[b]; working[d] = rotl32(working[d] ^ working[a], 8); \
+			working[c] += working[d]; working[b] = rotl32(working[b] ^ working[c], 7);
+
+		for (unsigned int round = 0; round < 10; ++round)
+		{
+			bumpChachaQuarterRound(0, 4, 8, 12)
+			bumpChachaQuarterRound(1, 5, 9, 13)
+			bumpChachaQuarterRound(2, 6, 10, 14)
+			bumpChachaQuarterRound(3, 7, 11, 15)
+			bumpChachaQuarterRound(0, 5, 10, 15)
+			bumpChachaQuarterRound(1, 6, 11, 12)
+			bumpChachaQuarterRound(2, 7, 8, 13)
+			bumpChachaQuarterRound(3, 4, 9, 14)
+		}
+
+		#undef bumpChachaQuarterRound
+
+		for (unsigned int i = 0; i < 16; ++i)
+		{
+			output[i] = working[i] + state[i];
+		}
+	}
+
+	/** Generates the next buffer of output and rekeys from its first 32 bytes. */
+	void refill()
+	{
+		uint32 words[16];
+		for (unsigned int i = 0; i < sizeof(_buffer) / 64; ++i)
+		{
+			block(_counter++, words);
+			std::memcpy(_buffer + 64 * i, words, 64);
+		}
+
+		std::memcpy(_key, _buffer, sizeof(_key));
+		std::memset(_buffer, 0, sizeof(_key));
+		_position = sizeof(_key);
+	}
+
+	// Instance member variables
+	uint32			_key[8];			/**< @internal The current ChaCha20 key. */
+	uint64			_counter;			/**< @internal The next block counter. */
+	unsigned char	_buffer[512];		/**< @internal The generated output not yet handed out. */
+	unsigned int	_position;			/**< @internal The offset of the next unused output byte. */
+};
+
+/**
+ * @internal
+ * A xoshiro256** generator seeded from the secure generator. Much faster than the secure
+ * generator, but its future output can be predicted from past output.
+ */
+class FastGenerator
+{
+public:
+
+	FastGenerator(SecureGenerator& seeder)
+	{
+		// An all zero state would only ever produce zeros
+		do
+		{
+			seeder.generate(reinterpret_cast<unsigned char*>(_state));
+			seeder.generate(reinterpret_cast<unsigned char*>(_state + 2));
+		}
+		while ((_state[0] | _state[1] | _state[2] | _state[3]) == 0);
+	}
+
+	/** Writes 16 random bytes. */
+	void generate(unsigned char* bytes)
+	{
+		const uint64 first = next();
+		const uint64 second = next();
+		std::memcpy(bytes, &first, 8);
+		std::memcpy(bytes + 8, &second, 8);
+	}
+
+protected:
+
+	uint64 next()
+	{
+		const uint64 result = rotl64(_state[1] * 5, 7) * 9;
+		const uint64 shifted = _state[1] << 17;
+		_state[2] ^= _state[0];
+		_state[3] ^= _state[1];
+		_state[1] ^= _state[2];
+		_state[0] ^= _state[3];
+		_state[2] ^= shifted;
+		_state[3] = rotl64(_state[3], 45);
+		return result;
+	}
+
+	// Instance member variables
+	uint64 _state[4];		/**< @internal The xoshiro256** state. */
+};
+
+// The last time ordered uuid timestamp (high 48 bits) and counter (low 16 bits) handed out
+boost::atomic<uint64> gTimeOrderedState(0);
+
+// Each thread lazily creates its own generators
+boost::thread_specific_ptr<SecureGenerator> gSecureGenerators;
+boost::thread_specific_ptr<FastGenerator> gFastGenerators;
+
+SecureGenerator& secureGenerator()
+{
+	SecureGenerator* generator = gSecureGenerators.get();
+	if (generator == NULL)
+	{
+		generator = new SecureGenerator();
+		gSecureGenerators.reset(generator);
+	}
+
+	return *generator;
+}
+
+FastGenerator& fastGenerator()
+{
+	FastGenerator* generator = gFastGenerators.get();
+	if (generator == NULL)
+	{
+		generator = new FastGenerator(secureGenerator());
+		gFastGenerators.reset(generator);
+	}
+
+	return *generator;
+}
+
+}	// End of anonymous namespace
+
 Uuid::Uuid() : boost::uuids::uuid(boost::uuids::nil_uuid())
 {
 	;
@@ -39,24 +255,124 @@ Uuid::~Uuid()
 	;
 }
 
-Uuid Uuid::genarateRandom()
+Uuid Uuid::generateRandom(const Generator& generator)
 {
-	boost::uuids::random_generator generator;
-	boost::uuids::uuid uuid = generator();
+	Uuid uuid;
+	generateRandomBatch(1, &uuid, generator);
 	return uuid;
 }
 
+void Uuid::generateRandomBatch(unsigned int count, Uuid* uuids, const Generator& generator)
+{
+	if (generator == FAST)
+	{
+		FastGenerator& fast = fastGenerator();
+		for (unsigned int i = 0; i < count; ++i)
+		{
+			fast.generate(uuids[i].data);
+			setRandomVersion(uuids[i]);
+		}
+	}
+	else
+	{
+		SecureGenerator& secure = secureGenerator();
+		for (unsigned int i = 0; i < count; ++i)
+		{
+			secure.generate(uuids[i].data);
+			setRandomVersion(uuids[i]);
+		}
+	}
+}
+
+Uuid Uuid::generateTimeOrdered()
+{
+	const uint64 milliseconds = boost::chrono::duration_cast<boost::chrono::milliseconds>(
+		boost::chrono::system_clock::now().time_since_epoch()).count();
+
+	// Take the current millisecond with a zero counter, or the next counter if that has been taken.
+	// A counter overflow carries into the timestamp bits, keeping the state strictly increasing.
+	const uint64 earliest = milliseconds << 16;
+	uint64 previous = gTimeOrderedState.load(boost::memory_order_relaxed);
+	uint64 state;
+	do
+	{
+		state = previous >= earliest ? previous + 1 : earliest;
+	}
+	while (!gTimeOrderedState.compare_exchange_weak(previous, state, boost::memory_order_relaxed));
+
+	// Fill the uuid with random bits, then lay out the timestamp and counter in big endian order
+	Uuid uuid;
+	secureGenerator().generate(uuid.data);
+	const uint64 timestamp = state >> 16;
+	const unsigned int counter = (unsigned int) (state & 0xffff);
+	for (unsigned int i = 0; i < 6; ++i)
+	{
+		uuid.data[i] = (unsigned char) (timestamp >> (40 - 8 * i));
+	}
+	uuid.data[6] = (unsigned char) (0x70 | (counter >> 12));
+	uuid.data[7] = (unsigned char) (counter >> 4);
+	uuid.data[8] = (unsigned char) (0x80 | ((counter & 0x0f) << 2) | (uuid.data[8] & 0x03));
+
+	return uuid;
+}
+
+Uuid Uuid::genarateRandom()
+{
+	return generateRandom(SECURE);
+}
+
 Uuid Uuid::fromString(const String& uuidString)
 {
-	try
+	Uuid uuid;
+	if (!tryFromString(uuidString.c_str(), uuidString.size(), uuid))
 	{
-		boost::uuids::string_generator generator;
-		return generator(uuidString);
+		throw TypeCastError("Could not convert " + uuidString + " to uuid", BUMP_LOCATION);
 	}
-	catch (const std::exception& /*e*/)
+
+	return uuid;
+}
+
+bool Uuid::tryFromString(const String& uuidString, Uuid& uuid)
+{
+	return tryFromString(uuidString.c_str(), uuidString.size(), uuid);
+}
+
+Expected<Uuid> Uuid::tryFromString(const String& uuidString)
+{
+	Uuid uuid;
+	if (!tryFromString(uuidString.c_str(), uuidString.size(), uuid))
+	{
+		return Result(Result::TYPE_CAST_ERROR, "Could not convert the string to uuid", boost::system::errc::invalid_argument);
+	}
+
+	return uuid;
+}
+
+bool Uuid::tryFromString(const char* chars, std::size_t length, Uuid& uuid)
+{
+	// Strip the braces
+	if (length == 38 && chars[0] == '{' && chars[37] == '}')
+	{
+		++chars;
+		length = 36;
+	}
+
+	// Decode the canonical form or the digits without dashes
+	unsigned char bytes[16];
+	if (length == 36)
 	{
-		throw TypeCastError(String("Could not convert %1 to uuid").arg(uuidString), BUMP_LOCATION);
+		if (!Hex::decodeUuid(chars, bytes))
+		{
+			return false;
+		}
 	}
+	else if (length != 32 || !Hex::decode(chars, 32, bytes))
+	{
+		return false;
+	}
+
+	std::memcpy(uuid.data, bytes, 16);
+	return true;
 }
 
 bool Uuid::isNull() const
@@ -64,37 +380,61 @@ bool Uuid::isNull() const
 	return boost::uuids::uuid::is_nil();
 }
 
+unsigned long long Uuid::timestamp() const
+{
+	if ((data[6] >> 4) != 7)
+	{
+		return 0;
+	}
+
+	uint64 milliseconds = 0;
+	for (unsigned int i = 0; i < 6; ++i)
+	{
+		milliseconds = (milliseconds << 8) | data[i];
+	}
+
+	return milliseconds;
+}
+
 String Uuid::toString() const
 {
-	return boost::uuids::to_string(*this);
+	String uuidString;
+	uuidString.resize(36);
+	toChars(&uuidString[0]);
+	return uuidString;
+}
+
+void Uuid::toChars(char* chars) const
+{
+	Hex::encodeUuid(data, chars);
 }
 
-bool Uuid::operator==(const Uuid& rhs)
+bool Uuid::operator==(const Uuid& rhs) const
 {
 	return boost::uuids::operator==(*this, rhs);
 }
 
-bool Uuid::operator!=(const Uuid& rhs)
+bool Uuid::operator!=(const Uuid& rhs) const
 {
 	return boost::uuids::operator!=(*this, rhs);
 }
 
-bool Uuid::operator<(const Uuid& rhs)
+bool Uuid::operator<(const Uuid& rhs) const
 {
 	return boost::uuids::operator<(*this, rhs);
 }
 
-bool Uuid::operator>(const Uuid& rhs)
+bool Uuid::operator>(const Uuid& rhs) const
 {
 	return boost::uuids::operator>(*this, rhs);
 }
 
-bool Uuid::operator<=(const Uuid& rhs)
+bool Uuid::operator<=(const Uuid& rhs) const
 {
 	return boost::uuids::operator<=(*this, rhs);
 }
 
-bool Uuid::operator>=(const Uuid& rhs)
+bool Uuid::operator>=(const Uuid& rhs) const
 {
 	return boost::uuids::operator>=(*this, rhs);
 }
@@ -0,0 +1,76 @@
+//
+//	Uuid_unix.cpp
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+// C++ headers
+#include <cerrno>
+#include <cstddef>
+
+// Unix headers
+#include <fcntl.h>
+#include <unistd.h>
+#if defined(__linux__) && defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 25))
+	#define BUMP_HAS_GETRANDOM
+	#include <sys/random.h>
+#endif
+
+namespace bump {
+
+bool readSystemEntropy(unsigned char* bytes, std::size_t size)
+{
+#if defined(BUMP_HAS_GETRANDOM)
+	// getrandom blocks only until the kernel pool is first initialized, and never fails once it is
+	std::size_t filled = 0;
+	while (filled < size)
+	{
+		const ssize_t count = getrandom(bytes + filled, size - filled, 0);
+		if (count > 0)
+		{
+			filled += static_cast<std::size_t>(count);
+		}
+		else if (count < 0 && errno == ENOSYS)
+		{
+			// Kernels older than 3.17 only have the device
+			break;
+		}
+		else if (count < 0 && errno != EINTR)
+		{
+			return false;
+		}
+	}
+
+	if (filled == size)
+	{
+		return true;
+	}
+#endif
+
+	int device = open("/dev/urandom", O_RDONLY | O_CLOEXEC);
+	if (device < 0)
+	{
+		return false;
+	}
+
+	std::size_t filledFromDevice = 0;
+	while (filledFromDevice < size)
+	{
+		const ssize_t count = read(device, bytes + filledFromDevice, size - filledFromDevice);
+		if (count > 0)
+		{
+			filledFromDevice += static_cast<std::size_t>(count);
+		}
+		else if (count == 0 || errno != EINTR)
+		{
+			break;
+		}
+	}
+
+	close(device);
+	return filledFromDevice == size;
+}
+
+}	// End of bump namespace
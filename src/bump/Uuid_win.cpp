@@ -0,0 +1,24 @@
+//
+//	Uuid_win.cpp
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+// C++ headers
+#include <cstddef>
+
+// Windows headers
+#include <windows.h>
+#include <bcrypt.h>
+
+namespace bump {
+
+bool readSystemEntropy(unsigned char* bytes, std::size_t size)
+{
+	NTSTATUS status = BCryptGenRandom(NULL, bytes, static_cast<ULONG>(size), BCRYPT_USE_SYSTEM_PREFERRED_RNG);
+	return BCRYPT_SUCCESS(status);
+}
+
+}	// End of bump namespace
@@ -30,11 +30,22 @@
  Gustav
  Several members in the gamedev.se forum.
  Gregory Petrosyan
+ Bump (incremental init/update/finalize, multi-buffer calcMultiple)
  */
 
 // Smallsha1 headers
 #include <smallsha1/sha1.h>
 
+// Multi-buffer hashing uses SSE2 when the target guarantees it, and AVX2 when the CPU supports it at runtime
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define SHA1_MULTI_BUFFER_SSE2
+    #include <emmintrin.h>
+    #if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+        #define SHA1_MULTI_BUFFER_AVX2
+        #include <immintrin.h>
+    #endif
+#endif
+
 namespace sha1
 {
     namespace // local
@@ -114,6 +125,319 @@ namespace sha1
             result[3] += d;
             result[4] += e;
         }
+
+        // Loads a full 64 byte block into the round buffer and hashes it.
+        inline void hashBlock(unsigned int* result, const unsigned char* sarray, unsigned int* w)
+        {
+            for (int roundPos = 0, currentBlock = 0; roundPos < 16; ++roundPos, currentBlock += 4)
+            {
+                // This line will swap endian on big endian and keep endian on little endian.
+                w[roundPos] = (unsigned int) sarray[currentBlock + 3]
+                        | (((unsigned int) sarray[currentBlock + 2]) << 8)
+                        | (((unsigned int) sarray[currentBlock + 1]) << 16)
+                        | (((unsigned int) sarray[currentBlock]) << 24);
+            }
+            innerHash(result, w);
+        }
+
+#ifdef SHA1_MULTI_BUFFER_SSE2
+
+        // The widest vector path supported, eight lanes of 32 bits with AVX2.
+        const int maxLaneCount = 8;
+
+        // One message being fed through a vector lane, one 64 byte block at a time.
+        struct Lane
+        {
+            const unsigned char* data;
+            int message;
+            int fullBlocks;
+            int totalBlocks;
+            int nextBlock;
+            unsigned char tail[128];
+        };
+
+        // Points the lane at a message and builds its padded tail blocks up front.
+        void loadLane(Lane& lane, const unsigned char* data, const int bytelength, const int message)
+        {
+            lane.data = data;
+            lane.message = message;
+            lane.fullBlocks = bytelength >> 6;
+            lane.nextBlock = 0;
+
+            const int lastBlockBytes = bytelength & 63;
+            const int tailBlocks = lastBlockBytes >= 56 ? 2 : 1;
+            lane.totalBlocks = lane.fullBlocks + tailBlocks;
+
+            const unsigned char* tailData = data + (lane.fullBlocks << 6);
+            int pos = 0;
+            for (; pos < lastBlockBytes; ++pos)
+            {
+                lane.tail[pos] = tailData[pos];
+            }
+            lane.tail[pos++] = 0x80;
+            for (; pos < (tailBlocks << 6) - 8; ++pos)
+            {
+                lane.tail[pos] = 0;
+            }
+
+            // Store the message length in bits as a big endian 64 bit value.
+            const unsigned long long bitlength = (unsigned long long) bytelength << 3;
+            for (int shift = 56; shift >= 0; shift -= 8)
+            {
+                lane.tail[pos++] = (unsigned char) (bitlength >> shift);
+            }
+        }
+
+        inline const unsigned char* laneBlock(const Lane& lane)
+        {
+            if (lane.nextBlock < lane.fullBlocks)
+            {
+                return lane.data + (lane.nextBlock << 6);
+            }
+
+            return lane.tail + ((lane.nextBlock - lane.fullBlocks) << 6);
+        }
+
+        // The 80 rounds are identical for every vector width, only the primitive operations differ.
+        #define sha1VectorRounds(vector, add, set1, bitAnd, bitAndNot, bitOr, bitXor, rol) \
+        { \
+            vector a = result[0]; \
+            vector b = result[1]; \
+            vector c = result[2]; \
+            vector d = result[3]; \
+            vector e = result[4]; \
+            int round = 0; \
+            for (; round < 80; ++round) \
+            { \
+                if (round >= 16) \
+                { \
+                    w[round & 15] = rol(bitXor(bitXor(w[(round - 3) & 15], w[(round - 8) & 15]), \
+                            bitXor(w[(round - 14) & 15], w[round & 15])), 1); \
+                } \
+                vector func; \
+                int val; \
+                if (round < 20) \
+                { \
+                    func = bitOr(bitAnd(b, c), bitAndNot(b, d)); \
+                    val = 0x5a827999; \
+                } \
+                else if (round < 40 || round >= 60) \
+                { \
+                    func = bitXor(bitXor(b, c), d); \
+                    val = round < 40 ? 0x6ed9eba1 : (int) 0xca62c1d6; \
+                } \
+                else \
+                { \
+                    func = bitOr(bitAnd(b, bitOr(c, d)), bitAnd(c, d)); \
+                    val = (int) 0x8f1bbcdc; \
+                } \
+                const vector t = add(add(rol(a, 5), func), add(add(e, set1(val)), w[round & 15])); \
+                e = d; \
+                d = c; \
+                c = rol(b, 30); \
+                b = a; \
+                a = t; \
+            } \
+            result[0] = add(result[0], a); \
+            result[1] = add(result[1], b); \
+            result[2] = add(result[2], c); \
+            result[3] = add(result[3], d); \
+            result[4] = add(result[4], e); \
+        }
+
+        inline __m128i rolVector(const __m128i value, const int steps)
+        {
+            return _mm_or_si128(_mm_slli_epi32(value, steps), _mm_srli_epi32(value, 32 - steps));
+        }
+
+        // Swaps the byte order of each 32 bit word.
+        inline __m128i byteSwapVector(__m128i value)
+        {
+            value = _mm_shufflehi_epi16(_mm_shufflelo_epi16(value, 0xb1), 0xb1);
+            return _mm_or_si128(_mm_slli_epi16(value, 8), _mm_srli_epi16(value, 8));
+        }
+
+        // Runs one block from each of four lanes through the compression function.
+        void innerHashMultiple4(unsigned int (*words)[maxLaneCount], const unsigned char* const* blocks)
+        {
+            __m128i w[16];
+            __m128i result[5];
+            for (int word = 0; word < 5; ++word)
+            {
+                result[word] = _mm_loadu_si128((const __m128i*) words[word]);
+            }
+
+            // Transpose the blocks so each vector holds the same word from every lane.
+            for (int group = 0; group < 4; ++group)
+            {
+                const __m128i row0 = _mm_loadu_si128((const __m128i*) (blocks[0] + (group << 4)));
+                const __m128i row1 = _mm_loadu_si128((const __m128i*) (blocks[1] + (group << 4)));
+                const __m128i row2 = _mm_loadu_si128((const __m128i*) (blocks[2] + (group << 4)));
+                const __m128i row3 = _mm_loadu_si128((const __m128i*) (blocks[3] + (group << 4)));
+                const __m128i low01 = _mm_unpacklo_epi32(row0, row1);
+                const __m128i high01 = _mm_unpackhi_epi32(row0, row1);
+                const __m128i low23 = _mm_unpacklo_epi32(row2, row3);
+                const __m128i high23 = _mm_unpackhi_epi32(row2, row3);
+                w[(group << 2) + 0] = byteSwapVector(_mm_unpacklo_epi64(low01, low23));
+                w[(group << 2) + 1] = byteSwapVector(_mm_unpackhi_epi64(low01, low23));
+                w[(group << 2) + 2] = byteSwapVector(_mm_unpacklo_epi64(high01, high23));
+                w[(group << 2) + 3] = byteSwapVector(_mm_unpackhi_epi64(high01, high23));
+            }
+
+            sha1VectorRounds(__m128i, _mm_add_epi32, _mm_set1_epi32, _mm_and_si128, _mm_andnot_si128,
+                    _mm_or_si128, _mm_xor_si128, rolVector)
+
+            for (int word = 0; word < 5; ++word)
+            {
+                _mm_storeu_si128((__m128i*) words[word], result[word]);
+            }
+        }
+
+#ifdef SHA1_MULTI_BUFFER_AVX2
+
+        __attribute__((target("avx2"))) inline __m256i rolVector8(const __m256i value, const int steps)
+        {
+            return _mm256_or_si256(_mm256_slli_epi32(value, steps), _mm256_srli_epi32(value, 32 - steps));
+        }
+
+        // Runs one block from each of eight lanes through the compression function.
+        __attribute__((target("avx2"))) void innerHashMultiple8(unsigned int (*words)[maxLaneCount],
+                const unsigned char* const* blocks)
+        {
+            __m256i w[16];
+            __m256i result[5];
+            for (int word = 0; word < 5; ++word)
+            {
+                result[word] = _mm256_loadu_si256((const __m256i*) words[word]);
+            }
+
+            // Transpose the blocks so each vector holds the same word from every lane.
+            const __m256i byteSwap = _mm256_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3,
+                    12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+            for (int group = 0; group < 2; ++group)
+            {
+                __m256i rows[8];
+                for (int lane = 0; lane < 8; ++lane)
+                {
+                    rows[lane] = _mm256_loadu_si256((const __m256i*) (blocks[lane] + (group << 5)));
+                }
+
+                __m256i pairs[8];
+                for (int lane = 0; lane < 8; lane += 2)
+                {
+                    pairs[lane] = _mm256_unpacklo_epi32(rows[lane], rows[lane + 1]);
+                    pairs[lane + 1] = _mm256_unpackhi_epi32(rows[lane], rows[lane + 1]);
+                }
+
+                __m256i quads[8];
+                for (int half = 0; half < 8; half += 4)
+                {
+                    quads[half + 0] = _mm256_unpacklo_epi64(pairs[half + 0], pairs[half + 2]);
+                    quads[half + 1] = _mm256_unpackhi_epi64(pairs[half + 0], pairs[half + 2]);
+                    quads[half + 2] = _mm256_unpacklo_epi64(pairs[half + 1], pairs[half + 3]);
+                    quads[half + 3] = _mm256_unpackhi_epi64(pairs[half + 1], pairs[half + 3]);
+                }
+
+                for (int word = 0; word < 4; ++word)
+                {
+                    w[(group << 3) + word] = _mm256_shuffle_epi8(
+                            _mm256_permute2x128_si256(quads[word], quads[word + 4], 0x20), byteSwap);
+                    w[(group << 3) + word + 4] = _mm256_shuffle_epi8(
+                            _mm256_permute2x128_si256(quads[word], quads[word + 4], 0x31), byteSwap);
+                }
+            }
+
+            sha1VectorRounds(__m256i, _mm256_add_epi32, _mm256_set1_epi32, _mm256_and_si256, _mm256_andnot_si256,
+                    _mm256_or_si256, _mm256_xor_si256, rolVector8)
+
+            for (int word = 0; word < 5; ++word)
+            {
+                _mm256_storeu_si256((__m256i*) words[word], result[word]);
+            }
+        }
+
+#endif // SHA1_MULTI_BUFFER_AVX2
+
+        #undef sha1VectorRounds
+
+        // Feeds the messages through laneCount lanes, refilling each lane as soon as its message finishes.
+        void calcMultipleLanes(const void* const* srcs, const int* bytelengths, const int count, unsigned char* hashes,
+                const int laneCount, void (*compress)(unsigned int (*)[maxLaneCount], const unsigned char* const*))
+        {
+            const unsigned int initialResult[5] = { 0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476, 0xc3d2e1f0 };
+
+            // Each lane's share of the vector state, kept in memory so single lanes can be reset.
+            unsigned int words[5][maxLaneCount];
+            Lane lanes[maxLaneCount];
+            bool isActive[maxLaneCount];
+            int nextMessage = 0;
+
+            // Idle lanes hash a zero block whose results are never read.
+            unsigned char idleBlock[64];
+            for (int pos = 0; pos < 64; ++pos)
+            {
+                idleBlock[pos] = 0;
+            }
+
+            // Fill the lanes with the first messages.
+            for (int lane = 0; lane < maxLaneCount; ++lane)
+            {
+                isActive[lane] = lane < laneCount && nextMessage < count;
+                if (isActive[lane])
+                {
+                    loadLane(lanes[lane], (const unsigned char*) srcs[nextMessage], bytelengths[nextMessage], nextMessage);
+                    ++nextMessage;
+                }
+                for (int word = 0; word < 5; ++word)
+                {
+                    words[word][lane] = initialResult[word];
+                }
+            }
+
+            int activeLanes = count < laneCount ? count : laneCount;
+            while (activeLanes > 0)
+            {
+                const unsigned char* blocks[maxLaneCount];
+                for (int lane = 0; lane < laneCount; ++lane)
+                {
+                    blocks[lane] = isActive[lane] ? laneBlock(lanes[lane]) : idleBlock;
+                }
+
+                compress(words, blocks);
+
+                // Retire finished messages and refill their lanes.
+                for (int lane = 0; lane < laneCount; ++lane)
+                {
+                    if (!isActive[lane] || ++lanes[lane].nextBlock < lanes[lane].totalBlocks)
+                    {
+                        continue;
+                    }
+
+                    unsigned char* hash = hashes + 20 * lanes[lane].message;
+                    for (int hashByte = 20; --hashByte >= 0;)
+                    {
+                        hash[hashByte] = (words[hashByte >> 2][lane] >> (((3 - hashByte) & 0x3) << 3)) & 0xff;
+                    }
+                    for (int word = 0; word < 5; ++word)
+                    {
+                        words[word][lane] = initialResult[word];
+                    }
+
+                    if (nextMessage < count)
+                    {
+                        loadLane(lanes[lane], (const unsigned char*) srcs[nextMessage], bytelengths[nextMessage], nextMessage);
+                        ++nextMessage;
+                    }
+                    else
+                    {
+                        isActive[lane] = false;
+                        --activeLanes;
+                    }
+                }
+            }
+        }
+
+#endif // SHA1_MULTI_BUFFER_SSE2
     } // namespace
 
     void calc(const void* src, const int bytelength, unsigned char* hash)
@@ -183,4 +507,106 @@ namespace sha1
         }
         hexstring[40] = 0;
     }
+
+    void calcMultiple(const void* const* srcs, const int* bytelengths, const int count, unsigned char* hashes)
+    {
+#if defined(SHA1_MULTI_BUFFER_AVX2)
+        if (__builtin_cpu_supports("avx2"))
+        {
+            calcMultipleLanes(srcs, bytelengths, count, hashes, 8, innerHashMultiple8);
+            return;
+        }
+#endif
+#if defined(SHA1_MULTI_BUFFER_SSE2)
+        calcMultipleLanes(srcs, bytelengths, count, hashes, 4, innerHashMultiple4);
+#else
+        for (int message = 0; message < count; ++message)
+        {
+            calc(srcs[message], bytelengths[message], hashes + 20 * message);
+        }
+#endif
+    }
+
+    void init(Context& context)
+    {
+        context.result[0] = 0x67452301;
+        context.result[1] = 0xefcdab89;
+        context.result[2] = 0x98badcfe;
+        context.result[3] = 0x10325476;
+        context.result[4] = 0xc3d2e1f0;
+        context.bytelength = 0;
+    }
+
+    void update(Context& context, const void* src, const unsigned long long bytelength)
+    {
+        const unsigned char* sarray = (const unsigned char*) src;
+        unsigned long long remaining = bytelength;
+        unsigned int w[80];
+
+        // Top up a partially filled block first.
+        unsigned int used = (unsigned int) (context.bytelength & 63);
+        context.bytelength += bytelength;
+        if (used != 0)
+        {
+            unsigned int fill = 64 - used;
+            if (remaining < fill)
+            {
+                for (unsigned int pos = 0; pos < remaining; ++pos)
+                {
+                    context.block[used + pos] = sarray[pos];
+                }
+                return;
+            }
+
+            for (unsigned int pos = 0; pos < fill; ++pos)
+            {
+                context.block[used + pos] = sarray[pos];
+            }
+            hashBlock(context.result, context.block, w);
+            sarray += fill;
+            remaining -= fill;
+        }
+
+        // Hash all the complete blocks straight out of the source.
+        while (remaining >= 64)
+        {
+            hashBlock(context.result, sarray, w);
+            sarray += 64;
+            remaining -= 64;
+        }
+
+        // Keep the tail around for the next update or finalize.
+        for (unsigned int pos = 0; pos < remaining; ++pos)
+        {
+            context.block[pos] = sarray[pos];
+        }
+    }
+
+    void finalize(Context& context, unsigned char* hash)
+    {
+        unsigned int w[80];
+        const int lastBlockBytes = (int) (context.bytelength & 63);
+
+        // Pad the tail the same way calc does, but with a full 64 bit message length.
+        clearWBuffert(w);
+        for (int pos = 0; pos < lastBlockBytes; ++pos)
+        {
+            w[pos >> 2] |= (unsigned int) context.block[pos] << ((3 - (pos & 3)) << 3);
+        }
+        w[lastBlockBytes >> 2] |= 0x80 << ((3 - (lastBlockBytes & 3)) << 3);
+        if (lastBlockBytes >= 56)
+        {
+            innerHash(context.result, w);
+            clearWBuffert(w);
+        }
+        const unsigned long long bitlength = context.bytelength << 3;
+        w[14] = (unsigned int) (bitlength >> 32);
+        w[15] = (unsigned int) (bitlength & 0xffffffff);
+        innerHash(context.result, w);
+
+        for (int hashByte = 20; --hashByte >= 0;)
+        {
+            hash[hashByte] = (context.result[hashByte >> 2] >> (((3 - hashByte) & 0x3) << 3)) & 0xff;
+        }
+    }
 } // namespace sha1
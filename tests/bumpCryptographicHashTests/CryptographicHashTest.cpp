@@ -6,9 +6,21 @@
 //	Copyright (c) 2013 Christian Noon. All rights reserved.
 //
 
+// C++ headers
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <set>
+
+// Boost headers
+#include <boost/unordered_set.hpp>
+
 // Bump headers
 #include <bump/Environment.h>
 #include <bump/CryptographicHash.h>
+#include <bump/FileSystem.h>
+#include <bump/FileSystemError.h>
+#include <bump/Hex.h>
 
 // bumpTest headers
 #include "../bumpTest/BaseTest.h"
@@ -32,6 +44,9 @@ protected:
 		BaseTest::SetUp();
 
 		// Custom set up logic
+		_tempDirectory = bump::FileSystem::join(bump::FileSystem::temporaryPath(), "bump_hash_unittest");
+		bump::FileSystem::removeDirectoryAndContents(_tempDirectory);
+		bump::FileSystem::createFullDirectoryPath(_tempDirectory);
 	}
 
 	/** Invoked immediately after a test finishes. Stops the timer. */
@@ -41,7 +56,25 @@ protected:
 		BaseTest::TearDown();
 
 		// Custom tear down logic
+		bump::FileSystem::removeDirectoryAndContents(_tempDirectory);
+	}
+
+	/** Writes a file filled with a repeating byte pattern and returns its path. */
+	bump::String writePatternFile(const bump::String& filename, unsigned int size)
+	{
+		bump::String path = bump::FileSystem::join(_tempDirectory, filename);
+		std::ofstream stream(path.c_str(), std::ios::out | std::ios::binary);
+		for (unsigned int i = 0; i < size; ++i)
+		{
+			stream.put(char(i % 251));
+		}
+		stream.close();
+
+		return path;
 	}
+
+	// Instance member variables
+	bump::String _tempDirectory;
 };
 
 TEST_F(CryptographicHashTest, testSetDataString)
@@ -184,4 +217,179 @@ TEST_F(CryptographicHashTest, testResult)
 	EXPECT_STREQ("bc1ed3c73cb98a7c3742a0f41e6e703f4472f679", result.c_str());
 }
 
+TEST_F(CryptographicHashTest, testResultBytes)
+{
+	// Normal case matches the hex result
+	bump::CryptographicHash hash;
+	bump::String data = "This is a simple string that I'm going to hash";
+	hash.setData(data);
+	bump::Sha1Digest digest = hash.resultBytes();
+	EXPECT_STREQ(hash.result().c_str(), bump::Hex::encode(digest.data(), 20).c_str());
+
+	// Empty case
+	hash.reset();
+	bump::Sha1Digest empty = hash.resultBytes();
+	for (unsigned int i = 0; i < 20; ++i)
+	{
+		EXPECT_EQ(0, empty[i]);
+	}
+
+	// Digests work as keys in ordered and unordered containers
+	hash.setData(bump::String("a different string"));
+	bump::Sha1Digest other = hash.resultBytes();
+	EXPECT_TRUE(digest == digest);
+	EXPECT_TRUE(digest != other);
+	std::set<bump::Sha1Digest> ordered;
+	boost::unordered_set<bump::Sha1Digest, bump::Sha1DigestHash> unordered;
+	ordered.insert(digest);
+	ordered.insert(other);
+	ordered.insert(digest);
+	unordered.insert(digest);
+	unordered.insert(other);
+	unordered.insert(digest);
+	EXPECT_EQ(2, ordered.size());
+	EXPECT_EQ(2, unordered.size());
+	EXPECT_EQ(1, unordered.count(other));
+}
+
+TEST_F(CryptographicHashTest, testHex)
+{
+	// Round trip every length through the vectorized and scalar paths
+	unsigned char bytes[100];
+	unsigned char decoded[100];
+	for (unsigned int i = 0; i < 100; ++i)
+	{
+		bytes[i] = static_cast<unsigned char>(i * 37 + 11);
+	}
+	for (unsigned int length = 0; length <= 100; ++length)
+	{
+		bump::String hex = bump::Hex::encode(bytes, length);
+		EXPECT_EQ(2 * length, hex.size());
+		EXPECT_TRUE(bump::Hex::decode(hex.c_str(), hex.size(), decoded));
+		EXPECT_EQ(0, std::memcmp(bytes, decoded, length));
+	}
+
+	// Known values and uppercase digits
+	const unsigned char known[] = { 0x00, 0x09, 0x0a, 0x7f, 0x80, 0xff };
+	EXPECT_STREQ("00090a7f80ff", bump::Hex::encode(known, 6).c_str());
+	EXPECT_TRUE(bump::Hex::decode("00090A7F80FF", 12, decoded));
+	EXPECT_EQ(0, std::memcmp(known, decoded, 6));
+
+	// Invalid characters in both the vectorized and scalar paths, and odd lengths
+	bump::String invalid(std::string(64, 'a'));
+	invalid[5] = 'g';
+	EXPECT_FALSE(bump::Hex::decode(invalid.c_str(), 64, decoded));
+	invalid[5] = static_cast<char>(0xe0);
+	EXPECT_FALSE(bump::Hex::decode(invalid.c_str(), 64, decoded));
+	EXPECT_FALSE(bump::Hex::decode("0z", 2, decoded));
+	EXPECT_FALSE(bump::Hex::decode("abc", 3, decoded));
+}
+
+TEST_F(CryptographicHashTest, testHashFile)
+{
+	// Small file matches hashing the same data in memory
+	bump::String path = bump::FileSystem::join(_tempDirectory, "small.txt");
+	std::ofstream stream(path.c_str(), std::ios::out | std::ios::binary);
+	stream << "This is a simple string that I'm going to hash";
+	stream.close();
+	EXPECT_STREQ("364fd3e0c0c454cb0c0fb393ede75f7f66b28eb6", bump::CryptographicHash::hashFile(path).c_str());
+
+	// Empty file still has a hash
+	path = writePatternFile("empty.bin", 0);
+	EXPECT_STREQ("da39a3ee5e6b4b0d3255bfef95601890afd80709", bump::CryptographicHash::hashFile(path).c_str());
+
+	// Multi-chunk file read with double buffering
+	path = writePatternFile("streamed.bin", 3 * 1024 * 1024 + 17);
+	EXPECT_STREQ("da6de52b0377c05cb5717f7517861dc0eb7ba169", bump::CryptographicHash::hashFile(path).c_str());
+
+	// File above the memory map threshold
+	path = writePatternFile("mapped.bin", 5 * 1024 * 1024 + 3);
+	EXPECT_STREQ("caa47f790c77e7135bbd905c605138d54717dcaf", bump::CryptographicHash::hashFile(path).c_str());
+
+	// Invalid paths
+	EXPECT_THROW(bump::CryptographicHash::hashFile(bump::FileSystem::join(_tempDirectory, "missing.bin")),
+				 bump::FileSystemError);
+	EXPECT_THROW(bump::CryptographicHash::hashFile(_tempDirectory), bump::FileSystemError);
+}
+
+TEST_F(CryptographicHashTest, testHashFiles)
+{
+	// Build a list mixing valid and invalid paths
+	bump::StringList paths;
+	paths.push_back(writePatternFile("empty.bin", 0));
+	paths.push_back(bump::FileSystem::join(_tempDirectory, "missing.bin"));
+	paths.push_back(writePatternFile("streamed.bin", 3 * 1024 * 1024 + 17));
+
+	// Hashes come back in the same order with failures left empty
+	bump::StringList hashes = bump::CryptographicHash::hashFiles(paths);
+	ASSERT_EQ(3, (int)hashes.size());
+	EXPECT_STREQ("da39a3ee5e6b4b0d3255bfef95601890afd80709", hashes.at(0).c_str());
+	EXPECT_STREQ("", hashes.at(1).c_str());
+	EXPECT_STREQ("da6de52b0377c05cb5717f7517861dc0eb7ba169", hashes.at(2).c_str());
+
+	// Empty list
+	EXPECT_TRUE(bump::CryptographicHash::hashFiles(bump::StringList()).empty());
+}
+
+TEST_F(CryptographicHashTest, testHashMessages)
+{
+	// Build messages of every length around the one and two block padding boundaries
+	std::vector<std::string> messages;
+	for (unsigned int length = 0; length < 140; ++length)
+	{
+		std::string message;
+		for (unsigned int i = 0; i < length; ++i)
+		{
+			message.push_back(char((i * 7 + length) % 256));
+		}
+		messages.push_back(message);
+	}
+
+	std::vector<const char*> pointers;
+	std::vector<int> lengths;
+	for (unsigned int i = 0; i < messages.size(); ++i)
+	{
+		pointers.push_back(messages.at(i).data());
+		lengths.push_back(messages.at(i).length());
+	}
+
+	// Hash them all at once
+	std::vector<unsigned char> digests(20 * messages.size());
+	bump::CryptographicHash::hashMessages(&pointers[0], &lengths[0], messages.size(), &digests[0]);
+
+	// The empty message gets the real hash of zero bytes
+	bump::String empty_hex;
+	for (unsigned int i = 0; i < 20; ++i)
+	{
+		char hex[3];
+		sprintf(hex, "%02x", digests[i]);
+		empty_hex << hex;
+	}
+	EXPECT_STREQ("da39a3ee5e6b4b0d3255bfef95601890afd80709", empty_hex.c_str());
+
+	// Every other message matches hashing it on its own
+	for (unsigned int message = 1; message < messages.size(); ++message)
+	{
+		bump::CryptographicHash hash;
+		hash.setData(pointers.at(message), lengths.at(message));
+
+		bump::String batch_hex;
+		for (unsigned int i = 0; i < 20; ++i)
+		{
+			char hex[3];
+			sprintf(hex, "%02x", digests[20 * message + i]);
+			batch_hex << hex;
+		}
+		EXPECT_STREQ(hash.result().c_str(), batch_hex.c_str());
+	}
+
+	// Fewer messages than lanes
+	bump::CryptographicHash::hashMessages(&pointers[5], &lengths[5], 1, &digests[0]);
+	bump::CryptographicHash single;
+	single.setData(pointers.at(5), lengths.at(5));
+	char hex[3];
+	sprintf(hex, "%02x", digests[0]);
+	EXPECT_EQ(single.result().left(2), bump::String(hex));
+}
+
 }	// End of bumpTest namespace
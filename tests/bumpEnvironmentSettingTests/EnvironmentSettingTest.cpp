@@ -0,0 +1,175 @@
+//
+//	EnvironmentSettingTest.cpp
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+// Bump headers
+#include <bump/Environment.h>
+#include <bump/EnvironmentSetting.h>
+
+// bumpTest headers
+#include "../bumpTest/BaseTest.h"
+
+namespace bumpTest {
+
+/**
+ * This is our main environment setting testing class. The SetUp and TearDown methods are
+ * executed before the test runs and after it completes. This is where we can
+ * add any custom set up for each test without having to add this to "every"
+ * test individually.
+ */
+class EnvironmentSettingTest : public BaseTest
+{
+protected:
+
+	/** Run immediately before a test starts. Starts the timer. */
+	void SetUp()
+	{
+		// Call the parent setup method
+		BaseTest::SetUp();
+	}
+
+	/** Invoked immediately after a test finishes. Stops the timer. */
+	void TearDown()
+	{
+		// Call the parent tear down method
+		BaseTest::TearDown();
+
+		// Unset the environment variables the tests use
+		bump::Environment::unsetEnvironmentVariable("BUMP_TEST_SETTING");
+	}
+};
+
+TEST_F(EnvironmentSettingTest, testBoolSetting)
+{
+	// Unset variables use the default
+	bump::BoolSetting setting("BUMP_TEST_SETTING", true, "A test setting");
+	EXPECT_TRUE(setting.value());
+	EXPECT_FALSE(setting.isSet());
+	EXPECT_EQ(bump::EnvironmentSetting::BOOL_SETTING, setting.type());
+
+	// Values are matched ignoring case
+	bump::Environment::setEnvironmentVariable("BUMP_TEST_SETTING", "Off");
+	EXPECT_TRUE(setting.reload());
+	EXPECT_FALSE(setting.value());
+	EXPECT_TRUE(setting.isSet());
+	EXPECT_STREQ("false", setting.toString().c_str());
+	EXPECT_STREQ("true", setting.defaultString().c_str());
+
+	// Invalid values fall back to the default
+	bump::Environment::setEnvironmentVariable("BUMP_TEST_SETTING", "maybe");
+	EXPECT_FALSE(setting.reload());
+	EXPECT_TRUE(setting.value());
+	EXPECT_FALSE(setting.isSet());
+}
+
+TEST_F(EnvironmentSettingTest, testIntSetting)
+{
+	bump::Environment::setEnvironmentVariable("BUMP_TEST_SETTING", "42");
+	bump::IntSetting setting("BUMP_TEST_SETTING", 3, "A test setting", 0, 100);
+	EXPECT_EQ(42, setting.value());
+	EXPECT_TRUE(setting.isSet());
+
+	// Values outside of the range fall back to the default
+	bump::Environment::setEnvironmentVariable("BUMP_TEST_SETTING", "101");
+	EXPECT_FALSE(setting.reload());
+	EXPECT_EQ(3, setting.value());
+	bump::Environment::setEnvironmentVariable("BUMP_TEST_SETTING", "4.5");
+	EXPECT_FALSE(setting.reload());
+	EXPECT_EQ(3, setting.value());
+}
+
+TEST_F(EnvironmentSettingTest, testEnumSetting)
+{
+	enum Mode { FAST, SAFE };
+	const bump::EnumSetting::Choice choices[] = { { "FAST", FAST }, { "SAFE", SAFE } };
+
+	bump::Environment::setEnvironmentVariable("BUMP_TEST_SETTING", "fast");
+	bump::EnumSetting setting("BUMP_TEST_SETTING", choices, 2, SAFE, "A test setting");
+	EXPECT_EQ(FAST, setting.value());
+	EXPECT_STREQ("FAST", setting.toString().c_str());
+	EXPECT_STREQ("SAFE", setting.defaultString().c_str());
+
+	bump::Environment::setEnvironmentVariable("BUMP_TEST_SETTING", "RECKLESS");
+	EXPECT_FALSE(setting.reload());
+	EXPECT_EQ(SAFE, setting.value());
+}
+
+TEST_F(EnvironmentSettingTest, testDurationSetting)
+{
+	bump::DurationSetting setting("BUMP_TEST_SETTING", 2000000000ULL, "A test setting");
+	EXPECT_EQ(2000000000ULL, setting.nanoseconds());
+	EXPECT_DOUBLE_EQ(2.0, setting.seconds());
+	EXPECT_STREQ("2s", setting.defaultString().c_str());
+
+	// Each unit is matched whole
+	const char* texts[] = { "250ms", "1.5s", "3m", "2h", "100us", "7ns", "10", "5MS" };
+	const unsigned long long nanoseconds[] = { 250000000ULL, 1500000000ULL, 180000000000ULL, 7200000000000ULL,
+		100000ULL, 7ULL, 10000000000ULL, 5000000ULL };
+	for (unsigned int i = 0; i < sizeof(texts) / sizeof(texts[0]); ++i)
+	{
+		bump::Environment::setEnvironmentVariable("BUMP_TEST_SETTING", texts[i]);
+		EXPECT_TRUE(setting.reload()) << texts[i];
+		EXPECT_EQ(nanoseconds[i], setting.nanoseconds()) << texts[i];
+	}
+	EXPECT_STREQ("5ms", setting.toString().c_str());
+
+	// Invalid durations fall back to the default
+	const char* invalid[] = { "ms", "-1s", "5 s", "5sec", "1.2.3s" };
+	for (unsigned int i = 0; i < sizeof(invalid) / sizeof(invalid[0]); ++i)
+	{
+		bump::Environment::setEnvironmentVariable("BUMP_TEST_SETTING", invalid[i]);
+		EXPECT_FALSE(setting.reload()) << invalid[i];
+		EXPECT_EQ(2000000000ULL, setting.nanoseconds()) << invalid[i];
+	}
+}
+
+TEST_F(EnvironmentSettingTest, testSizeSetting)
+{
+	bump::SizeSetting setting("BUMP_TEST_SETTING", 65536, "A test setting");
+	EXPECT_EQ(65536, setting.bytes());
+	EXPECT_STREQ("64K", setting.defaultString().c_str());
+
+	const char* texts[] = { "512", "512B", "4k", "4KB", "4KiB", "1.5M", "2G", "1T" };
+	const unsigned long long bytes[] = { 512ULL, 512ULL, 4096ULL, 4096ULL, 4096ULL, 1572864ULL, 2147483648ULL, 1099511627776ULL };
+	for (unsigned int i = 0; i < sizeof(texts) / sizeof(texts[0]); ++i)
+	{
+		bump::Environment::setEnvironmentVariable("BUMP_TEST_SETTING", texts[i]);
+		EXPECT_TRUE(setting.reload()) << texts[i];
+		EXPECT_EQ(bytes[i], setting.bytes()) << texts[i];
+	}
+	EXPECT_STREQ("1T", setting.toString().c_str());
+
+	const char* invalid[] = { "K", "4X", "4BB", "99999999T" };
+	for (unsigned int i = 0; i < sizeof(invalid) / sizeof(invalid[0]); ++i)
+	{
+		bump::Environment::setEnvironmentVariable("BUMP_TEST_SETTING", invalid[i]);
+		EXPECT_FALSE(setting.reload()) << invalid[i];
+		EXPECT_EQ(65536, setting.bytes()) << invalid[i];
+	}
+}
+
+TEST_F(EnvironmentSettingTest, testDump)
+{
+	bump::Environment::setEnvironmentVariable("BUMP_TEST_SETTING", "7");
+	bump::IntSetting setting("BUMP_TEST_SETTING", 3, "A test setting");
+	{
+		// Settings are listed while they exist
+		bump::BoolSetting other("BUMP_TEST_OTHER_SETTING", false, "Another test setting");
+		const bump::String dump = bump::EnvironmentSetting::dump();
+		EXPECT_TRUE(dump.contains("BUMP_TEST_SETTING=7 (environment) - A test setting\n"));
+		EXPECT_TRUE(dump.contains("BUMP_TEST_OTHER_SETTING=false (default) - Another test setting\n"));
+	}
+	EXPECT_FALSE(bump::EnvironmentSetting::dump().contains("BUMP_TEST_OTHER_SETTING"));
+
+	// Reloading every setting picks up changed variables
+	bump::Environment::setEnvironmentVariable("BUMP_TEST_SETTING", "8");
+	EXPECT_EQ(7, setting.value());
+	EXPECT_TRUE(bump::EnvironmentSetting::reloadAll());
+	EXPECT_EQ(8, setting.value());
+}
+
+}	// End of bumpTest namespace
@@ -6,6 +6,13 @@
 //	Copyright (c) 2012 Christian Noon. All rights reserved.
 //
 
+// C++ headers
+#include <cstdlib>
+
+// Boost headers
+#include <boost/bind.hpp>
+#include <boost/thread/thread.hpp>
+
 // Bump headers
 #include <bump/Environment.h>
 #include <bump/String.h>
@@ -15,6 +22,19 @@
 
 namespace bumpTest {
 
+/** Reads the environment variable over and over while another thread changes it. */
+void readEnvironmentVariable(unsigned int* mismatches)
+{
+	for (unsigned int i = 0; i < 10000; ++i)
+	{
+		const boost::string_ref value = bump::Environment::environmentVariableView("BumpThreadTest");
+		if (value != "first" && value != "second")
+		{
+			++(*mismatches);
+		}
+	}
+}
+
 /**
  * This is our main environment testing class. The SetUp and TearDown methods are
  * executed before the test runs and after it completes. This is where we can
@@ -98,6 +118,73 @@ TEST_F(EnvironmentTest, testUnsetEnvironmentVariable)
 	EXPECT_STREQ("", actual_value.c_str());
 }
 
+TEST_F(EnvironmentTest, testEnvironmentVariableView)
+{
+	// Test the default environment variable
+	const boost::string_ref view = bump::Environment::environmentVariableView(_environmentVariable);
+	EXPECT_EQ(boost::string_ref(_expectedValue), view);
+
+	// The view outlives changes to the variable
+	const unsigned long long generation = bump::Environment::environmentGeneration();
+	bump::Environment::setEnvironmentVariable(_environmentVariable, "changed");
+	EXPECT_EQ(generation + 1, bump::Environment::environmentGeneration());
+	EXPECT_EQ(boost::string_ref(_expectedValue), view);
+	EXPECT_EQ("changed", bump::Environment::environmentVariableView(_environmentVariable));
+
+	// Unset variables have empty views
+	EXPECT_TRUE(bump::Environment::environmentVariableView("XYZ5674$$ABC").empty());
+
+	// Setting a variable to its current value is not a change
+	bump::Environment::setEnvironmentVariable(_environmentVariable, "changed");
+	EXPECT_EQ(generation + 1, bump::Environment::environmentGeneration());
+	// Views outlive the snapshots they were found in, which are freed as they are replaced
+	const boost::string_ref changed = bump::Environment::environmentVariableView(_environmentVariable);
+	bump::Environment::unsetEnvironmentVariable(_environmentVariable);
+	bump::Environment::reloadEnvironment();
+	EXPECT_EQ("changed", changed);
+	EXPECT_EQ(boost::string_ref(_expectedValue), view);
+}
+
+TEST_F(EnvironmentTest, testReloadEnvironment)
+{
+	// Changes made behind bump's back are only seen after reloading
+	setenv("BumpReloadTest", "outside", 1);
+	EXPECT_STREQ("", bump::Environment::environmentVariable("BumpReloadTest").c_str());
+	const unsigned long long generation = bump::Environment::environmentGeneration();
+	bump::Environment::reloadEnvironment();
+	EXPECT_LT(generation, bump::Environment::environmentGeneration());
+	EXPECT_STREQ("outside", bump::Environment::environmentVariable("BumpReloadTest").c_str());
+	EXPECT_STREQ(_expectedValue.c_str(), bump::Environment::environmentVariable(_environmentVariable).c_str());
+
+	// Unsetting through bump updates both
+	EXPECT_TRUE(bump::Environment::unsetEnvironmentVariable("BumpReloadTest"));
+	EXPECT_TRUE(getenv("BumpReloadTest") == NULL);
+	EXPECT_STREQ("", bump::Environment::environmentVariable("BumpReloadTest").c_str());
+}
+
+TEST_F(EnvironmentTest, testThreads)
+{
+	// Readers always see a whole value while a writer keeps changing it
+	bump::Environment::setEnvironmentVariable("BumpThreadTest", "first");
+	unsigned int mismatches[4] = { 0, 0, 0, 0 };
+	boost::thread_group threads;
+	for (unsigned int i = 0; i < 4; ++i)
+	{
+		threads.create_thread(boost::bind(readEnvironmentVariable, &mismatches[i]));
+	}
+	for (unsigned int i = 0; i < 1000; ++i)
+	{
+		bump::Environment::setEnvironmentVariable("BumpThreadTest", i % 2 == 0 ? "second" : "first");
+	}
+	threads.join_all();
+	bump::Environment::unsetEnvironmentVariable("BumpThreadTest");
+
+	for (unsigned int i = 0; i < 4; ++i)
+	{
+		EXPECT_EQ(0, mismatches[i]);
+	}
+}
+
 TEST_F(EnvironmentTest, testCurrentUsername)
 {
 	EXPECT_FALSE(bump::Environment::currentUsername().isEmpty());
@@ -0,0 +1,112 @@
+//
+//	ExceptionTest.cpp
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+// Bump headers
+#include <bump/InvalidArgumentError.h>
+#include <bump/String.h>
+#include <bump/TypeCastError.h>
+
+// bumpTest headers
+#include "../bumpTest/BaseTest.h"
+
+namespace bumpTest {
+
+/** An error whose class name is built at runtime rather than being a string literal. */
+class NamedError : public bump::RuntimeError
+{
+public:
+
+	NamedError(const bump::String& className, const bump::String& description) :
+		bump::RuntimeError(className, description, bump::String("Location"))
+	{
+		;
+	}
+};
+
+/**
+ * This is our main exception testing class. The SetUp and TearDown methods are
+ * executed before the test runs and after it completes. This is where we can
+ * add any custom set up for each test without having to add this to "every"
+ * test individually.
+ */
+class ExceptionTest : public BaseTest
+{
+protected:
+
+	/** Run immediately before a test starts. Starts the timer. */
+	void SetUp()
+	{
+		// Call the parent setup method
+		BaseTest::SetUp();
+
+		// Any custom setup we may need
+	}
+
+	/** Invoked immediately after a test finishes. Stops the timer. */
+	void TearDown()
+	{
+		// Call the parent tear down method
+		BaseTest::TearDown();
+
+		// Any custom teardown you may need
+	}
+};
+
+TEST_F(ExceptionTest, testSourceLocation)
+{
+	// Locations only hold the compiler's strings until they are described
+	const int line = __LINE__; const bump::SourceLocation location = BUMP_LOCATION;
+	EXPECT_EQ(line, location.line());
+	EXPECT_TRUE(bump::String(location.file()).endsWith("ExceptionTest.cpp"));
+	EXPECT_TRUE(bump::String(location.function()).contains("testSourceLocation"));
+	EXPECT_EQ(bump::String("Function: ") + location.function() + " File: " + location.file() + " Line: " + bump::String(line),
+		location.description());
+
+	// Preformatted locations are described as they are
+	const bump::SourceLocation preformatted(bump::String("Somewhere"));
+	EXPECT_TRUE(preformatted.function() == NULL);
+	EXPECT_EQ(0, preformatted.line());
+	EXPECT_EQ("Somewhere", preformatted.description());
+}
+
+TEST_F(ExceptionTest, testDescription)
+{
+	try
+	{
+		bump::String("not a number").toInt();
+		FAIL() << "No exception was thrown";
+	}
+	catch (bump::TypeCastError& e)
+	{
+		const bump::String description = e.description();
+		EXPECT_TRUE(description.startsWith("bump::TypeCastError: \"Cannot convert string to int\" Function: "));
+		EXPECT_TRUE(description.contains(" File: "));
+		EXPECT_TRUE(description.contains(" Line: "));
+		EXPECT_FALSE(description.contains("\n"));
+
+		// Extended descriptions are added on new lines
+		e.extendDescription("Rethrown", "Here");
+		EXPECT_EQ(description + "\nbump::TypeCastError: \"Rethrown\" Here", e.description());
+	}
+
+	// Locations can still be passed as strings
+	const bump::InvalidArgumentError error("Bad argument", bump::String("Location"));
+	EXPECT_EQ("bump::InvalidArgumentError: \"Bad argument\" Location", error.description());
+
+	// Class names that are not literals are kept after the string they came from is destroyed
+	NamedError* named = NULL;
+	{
+		bump::String className("bumpTest::");
+		className += "NamedError";
+		named = new NamedError(className, "Named");
+	}
+	EXPECT_EQ("bumpTest::NamedError: \"Named\" Location", named->description());
+	delete named;
+}
+
+}	// End of bumpTest namespace
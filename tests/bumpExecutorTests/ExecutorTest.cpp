@@ -0,0 +1,210 @@
+//
+//	ExecutorTest.cpp
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+// C++ headers
+#include <vector>
+
+// Boost headers
+#include <boost/atomic.hpp>
+#include <boost/bind.hpp>
+
+// Bump headers
+#include <bump/Executor.h>
+#include <bump/InvalidArgumentError.h>
+
+// bumpTest headers
+#include "../bumpTest/BaseTest.h"
+
+namespace bumpTest {
+
+/** Adds one to the counter. */
+void incrementCounter(boost::atomic<unsigned int>* counter)
+{
+	counter->fetch_add(1, boost::memory_order_relaxed);
+}
+
+/** Returns twice the value. */
+int doubleValue(int value)
+{
+	return value * 2;
+}
+
+/** Throws an invalid argument error. */
+int throwInvalidArgument()
+{
+	throw bump::InvalidArgumentError("The argument is invalid", BUMP_LOCATION);
+}
+
+/** Returns whether the calling thread is a worker of the executor. */
+bool isWorkerThread(const bump::Executor* executor)
+{
+	return executor->isWorkerThread();
+}
+
+/** Counts the times each index is visited. */
+void visitIndex(std::vector<boost::atomic<unsigned int>*>* visits, std::size_t index)
+{
+	(*visits)[index]->fetch_add(1, boost::memory_order_relaxed);
+}
+
+/** Throws at one of the indices. */
+void throwAtIndex(std::size_t index)
+{
+	if (index == 500)
+	{
+		throw bump::InvalidArgumentError("Index 500 is invalid", BUMP_LOCATION);
+	}
+}
+
+/** Spends longer on the higher indices, and runs a nested loop from inside the executor. */
+void unevenIndex(bump::Executor* executor, boost::atomic<unsigned int>* counter, std::size_t index)
+{
+	if (index % 8 == 0)
+	{
+		executor->parallelFor(0, 100, boost::bind(&incrementCounter, counter));
+	}
+
+	volatile double sum = 0.0;
+	for (std::size_t i = 0; i < index * 100; ++i)
+	{
+		sum += i * 0.5;
+	}
+}
+
+/** Queues tasks on the calling worker, then keeps the worker busy until other workers steal them. */
+void postAndWait(bump::Executor* executor, boost::atomic<unsigned int>* counter)
+{
+	for (unsigned int i = 0; i < 10; ++i)
+	{
+		executor->post(boost::bind(&incrementCounter, counter));
+	}
+
+	while (counter->load() < 10)
+	{
+		boost::this_thread::yield();
+	}
+}
+
+/**
+ * This is our main executor testing class. The SetUp and TearDown methods are
+ * executed before the test runs and after it completes. This is where we can
+ * add any custom set up for each test without having to add this to "every"
+ * test individually.
+ */
+class ExecutorTest : public BaseTest
+{
+protected:
+
+	/** Run immediately before a test starts. Starts the timer. */
+	void SetUp()
+	{
+		// Call the parent setup method
+		BaseTest::SetUp();
+	}
+
+	/** Invoked immediately after a test finishes. Stops the timer. */
+	void TearDown()
+	{
+		// Call the parent tear down method
+		BaseTest::TearDown();
+	}
+};
+
+TEST_F(ExecutorTest, testPost)
+{
+	// The destructor runs every task that is still queued
+	boost::atomic<unsigned int> counter(0);
+	{
+		bump::Executor executor(3);
+		EXPECT_EQ(3, executor.threadCount());
+		for (unsigned int i = 0; i < 1000; ++i)
+		{
+			executor.post(boost::bind(&incrementCounter, &counter));
+		}
+	}
+	EXPECT_EQ(1000, counter.load());
+
+	// The shared executor has at least one worker
+	EXPECT_LT(0, bump::Executor::instance()->threadCount());
+}
+
+TEST_F(ExecutorTest, testSubmit)
+{
+	bump::Executor executor(2);
+
+	// Results come back through the future
+	boost::shared_future<int> result = executor.submit<int>(boost::bind(&doubleValue, 21));
+	EXPECT_EQ(42, result.get());
+
+	// Tasks run on the workers
+	EXPECT_FALSE(executor.isWorkerThread());
+	EXPECT_TRUE(executor.submit<bool>(boost::bind(&isWorkerThread, &executor)).get());
+
+	// Exceptions are rethrown by the future
+	boost::shared_future<int> failure = executor.submit<int>(&throwInvalidArgument);
+	EXPECT_THROW(failure.get(), bump::InvalidArgumentError);
+
+	// Functions without results just complete
+	boost::atomic<unsigned int> counter(0);
+	executor.submit<void>(boost::bind(&incrementCounter, &counter)).get();
+	EXPECT_EQ(1, counter.load());
+}
+
+TEST_F(ExecutorTest, testParallelFor)
+{
+	bump::Executor executor(4);
+
+	// Every index runs exactly once, whatever the grain size
+	const std::size_t grainSizes[] = { 1, 7, 1000, 100000 };
+	for (unsigned int grain = 0; grain < sizeof(grainSizes) / sizeof(grainSizes[0]); ++grain)
+	{
+		std::vector<boost::atomic<unsigned int>*> visits;
+		for (unsigned int i = 0; i < 10000; ++i)
+		{
+			visits.push_back(new boost::atomic<unsigned int>(0));
+		}
+
+		executor.parallelFor(0, visits.size(), boost::bind(&visitIndex, &visits, _1), grainSizes[grain]);
+
+		unsigned int wrong = 0;
+		for (unsigned int i = 0; i < visits.size(); ++i)
+		{
+			wrong += visits[i]->load() == 1 ? 0 : 1;
+			delete visits[i];
+		}
+		EXPECT_EQ(0, wrong) << grainSizes[grain];
+	}
+
+	// Empty ranges do nothing
+	executor.parallelFor(5, 5, &throwAtIndex);
+
+	// The first exception is rethrown once the loop finishes
+	EXPECT_THROW(executor.parallelFor(0, 1000, &throwAtIndex), bump::InvalidArgumentError);
+}
+
+TEST_F(ExecutorTest, testWorkStealing)
+{
+	// Tasks queued by a busy worker are stolen by the idle one
+	bump::Executor executor(2);
+	boost::atomic<unsigned int> counter(0);
+	executor.submit<void>(boost::bind(&postAndWait, &executor, &counter)).get();
+	EXPECT_EQ(10, counter.load());
+	EXPECT_EQ(10, executor.stolenTasks());
+
+	// Nested loops run from inside the workers without deadlocking
+	bump::Executor nested(4);
+	counter = 0;
+	nested.parallelFor(0, 256, boost::bind(&unevenIndex, &nested, &counter, _1));
+	EXPECT_EQ(3200, counter.load());
+
+	// Pinning the workers to cores still runs the tasks
+	bump::Executor pinned(2, true);
+	EXPECT_EQ(42, pinned.submit<int>(boost::bind(&doubleValue, 21)).get());
+}
+
+}	// End of bumpTest namespace
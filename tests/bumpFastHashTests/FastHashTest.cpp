@@ -0,0 +1,243 @@
+//
+//	FastHashTest.cpp
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+// C++ headers
+#include <vector>
+
+// Boost headers
+#include <boost/config.hpp>
+
+#ifndef BOOST_NO_CXX11_HDR_UNORDERED_SET
+#include <unordered_set>
+#endif
+
+// Bump headers
+#include <bump/FastHash.h>
+#include <bump/String.h>
+#include <bump/Uuid.h>
+
+// bumpTest headers
+#include "../bumpTest/BaseTest.h"
+
+namespace bumpTest {
+
+/**
+ * A reference hash generated by the reference xxHash library.
+ */
+struct FastHashVector
+{
+	unsigned int length;
+	unsigned long long seed;
+	unsigned long long hash64;
+	unsigned long long hash128Low;
+	unsigned long long hash128High;
+};
+
+/**
+ * Reference hashes of the pattern data for lengths covering every size class of the algorithm.
+ */
+const FastHashVector gVectors[] =
+{
+		{ 0u, 0x0000000000000000ULL, 0x2d06800538d394c2ULL, 0x6001c324468d497fULL, 0x99aa06d3014798d8ULL },
+		{ 1u, 0x0000000000000000ULL, 0x4c5cca45d0f4811fULL, 0x4c5cca45d0f4811fULL, 0x495b62073ef70ca4ULL },
+		{ 2u, 0x0000000000000000ULL, 0xa7e250c97710ff27ULL, 0xa7e250c97710ff27ULL, 0x12b2847aa0de5aaaULL },
+		{ 3u, 0x0000000000000000ULL, 0x15f7093b173d005cULL, 0x15f7093b173d005cULL, 0x46f66cb935381565ULL },
+		{ 4u, 0x0000000000000000ULL, 0xdca012f95811b6b9ULL, 0xb987ca5d9241572aULL, 0x7fefeeffb4d0eab3ULL },
+		{ 5u, 0x0000000000000000ULL, 0xb290cafc7b254345ULL, 0x752a86982353f4f3ULL, 0x2fbb16712b4bf1d5ULL },
+		{ 8u, 0x0000000000000000ULL, 0xdec6a9a43575982eULL, 0x56bb836ceb6d4baaULL, 0x803c675a846cc6c2ULL },
+		{ 9u, 0x0000000000000000ULL, 0xcbe393399f17ffbdULL, 0x4376673580310154ULL, 0xd46556872d230f22ULL },
+		{ 16u, 0x0000000000000000ULL, 0x7e484c18d74895d0ULL, 0xf853dd94614dfa07ULL, 0x650fe308c566747dULL },
+		{ 17u, 0x0000000000000000ULL, 0x208bde5ee2bed407ULL, 0x78c349fe81b2f26cULL, 0x18217300b5132d5aULL },
+		{ 32u, 0x0000000000000000ULL, 0x03df0ac5255d1446ULL, 0x5726e079716c6a62ULL, 0x3220ff5fe507b3c0ULL },
+		{ 33u, 0x0000000000000000ULL, 0x199a362122d71f46ULL, 0x3b25275300c8b44eULL, 0x91a4c56ad1b91d88ULL },
+		{ 64u, 0x0000000000000000ULL, 0xdd30702ab46b3745ULL, 0x36c5f7e547426bc4ULL, 0xf9bfa77da0891a96ULL },
+		{ 65u, 0x0000000000000000ULL, 0xfab36b851b94ce20ULL, 0xd0d1d7884590a330ULL, 0x5642c5d38e6e787dULL },
+		{ 96u, 0x0000000000000000ULL, 0xd245cd2541582982ULL, 0x63451be079edd707ULL, 0x59861d1adb3e51a2ULL },
+		{ 97u, 0x0000000000000000ULL, 0x60e3e1d0d43785b3ULL, 0xfa4138b7dc44e45bULL, 0x0912f66857975b13ULL },
+		{ 128u, 0x0000000000000000ULL, 0xf92b70eaa21a6288ULL, 0x1e04fad9f0cacb4dULL, 0xb4f87b99d2db8a51ULL },
+		{ 129u, 0x0000000000000000ULL, 0xf8f76713f2bb60faULL, 0xc51bc887976aef63ULL, 0x6881633650cd8924ULL },
+		{ 160u, 0x0000000000000000ULL, 0xc90911ffcef461e2ULL, 0xf661814e66697391ULL, 0xc000b788df6dbbc4ULL },
+		{ 200u, 0x0000000000000000ULL, 0x12fdb864685f344dULL, 0x60ea018811f9a437ULL, 0x8d8629a1aef9ef90ULL },
+		{ 240u, 0x0000000000000000ULL, 0xccc7375172c41f03ULL, 0x93e173833f75ab66ULL, 0xde57aab31e77a2ffULL },
+		{ 241u, 0x0000000000000000ULL, 0x0b3b630948ce4a00ULL, 0x0b3b630948ce4a00ULL, 0x92b991a7192f3f08ULL },
+		{ 255u, 0x0000000000000000ULL, 0x89932170686cdd9aULL, 0x89932170686cdd9aULL, 0x3e68b7e415ce7e5cULL },
+		{ 256u, 0x0000000000000000ULL, 0xec85b75bafe6ca74ULL, 0xec85b75bafe6ca74ULL, 0x24ee30633ca52c6aULL },
+		{ 257u, 0x0000000000000000ULL, 0x12ef0ff633841459ULL, 0x12ef0ff633841459ULL, 0x0f849a4f3e33b6c2ULL },
+		{ 1024u, 0x0000000000000000ULL, 0x23bc880ebf0d29c6ULL, 0x23bc880ebf0d29c6ULL, 0x4c17271c906df792ULL },
+		{ 1025u, 0x0000000000000000ULL, 0xc09fdfbc398c7d82ULL, 0xc09fdfbc398c7d82ULL, 0x70a4eb1b9691d77fULL },
+		{ 2048u, 0x0000000000000000ULL, 0x19f6f9c987331373ULL, 0x19f6f9c987331373ULL, 0xb318976b177a38c7ULL },
+		{ 4109u, 0x0000000000000000ULL, 0xc97b08c83ccba052ULL, 0xc97b08c83ccba052ULL, 0xa2a4fad3b74bf188ULL },
+		{ 100000u, 0x0000000000000000ULL, 0xccf90df7e7e37036ULL, 0xccf90df7e7e37036ULL, 0x8ce7a24d31cd94b1ULL },
+		{ 0u, 0x9e3779b97f4a7c15ULL, 0x602b0e2cd6662c8bULL, 0x4ca5176998171787ULL, 0xd142977a2cca554bULL },
+		{ 1u, 0x9e3779b97f4a7c15ULL, 0x2f3acd3805f81de3ULL, 0x2f3acd3805f81de3ULL, 0x00a711eb5a736b26ULL },
+		{ 2u, 0x9e3779b97f4a7c15ULL, 0xae890deb5ef9a522ULL, 0xae890deb5ef9a522ULL, 0x954e5e6bd54ba0caULL },
+		{ 3u, 0x9e3779b97f4a7c15ULL, 0x079dd5d54d89480aULL, 0x079dd5d54d89480aULL, 0xbf6c84df5f76651dULL },
+		{ 4u, 0x9e3779b97f4a7c15ULL, 0x1a246e2efb9c9b2eULL, 0x64e9e646b51d20e4ULL, 0xb51a3f0020dfa57eULL },
+		{ 5u, 0x9e3779b97f4a7c15ULL, 0xf35f0dfbb65fe08fULL, 0x5e9d5339b098317eULL, 0x84a390e0ad91cedcULL },
+		{ 8u, 0x9e3779b97f4a7c15ULL, 0x19ef7d3919108affULL, 0x3edb070ecf3a9343ULL, 0xc3612dc11470e721ULL },
+		{ 9u, 0x9e3779b97f4a7c15ULL, 0x9c98d3e24dc54d34ULL, 0x2d1266ad8e2a983eULL, 0xd073a967e56faabbULL },
+		{ 16u, 0x9e3779b97f4a7c15ULL, 0xa106510078b0a252ULL, 0x4e683254a04c377fULL, 0xbe0f27bac4d1f58fULL },
+		{ 17u, 0x9e3779b97f4a7c15ULL, 0x0b2caf8bf9648effULL, 0xec6d60966729df8dULL, 0x81d87d7004dc4f98ULL },
+		{ 32u, 0x9e3779b97f4a7c15ULL, 0x3acbfdfb7e9f9668ULL, 0xec314f4c5eb3f3edULL, 0x2f9dc286862d200eULL },
+		{ 33u, 0x9e3779b97f4a7c15ULL, 0x913b37d6b8df6d23ULL, 0x8fe6a0e9b9ce486bULL, 0xa7da9f4c0aa58376ULL },
+		{ 64u, 0x9e3779b97f4a7c15ULL, 0x4490c19c7048a1a1ULL, 0x617a30ca442d6de3ULL, 0x6d4d5c56cd67f9f0ULL },
+		{ 65u, 0x9e3779b97f4a7c15ULL, 0xe6c2315ab5f5c409ULL, 0xdf39c73784fd230dULL, 0x2e9cfc23f941730aULL },
+		{ 96u, 0x9e3779b97f4a7c15ULL, 0xb0d250df3fab2308ULL, 0x612bf585220b1288ULL, 0x0442aede343ab5f1ULL },
+		{ 97u, 0x9e3779b97f4a7c15ULL, 0x9e127e846b5494c9ULL, 0xdeacc0186ad90436ULL, 0xb00709f5e31608ceULL },
+		{ 128u, 0x9e3779b97f4a7c15ULL, 0x95425530beb89fe8ULL, 0x8dd13adf89d20a39ULL, 0xf1355c6816c0b724ULL },
+		{ 129u, 0x9e3779b97f4a7c15ULL, 0x29fa850b97ed9666ULL, 0xa1c74215b3db7ab4ULL, 0xb8c736db70349640ULL },
+		{ 160u, 0x9e3779b97f4a7c15ULL, 0xbe673734bbe06200ULL, 0x70b6fa168ebbb801ULL, 0x0252b97b7cffdac2ULL },
+		{ 200u, 0x9e3779b97f4a7c15ULL, 0x49dff623641b01b4ULL, 0x2bd1eb5d960e73f4ULL, 0x8511e8a53f70bfbfULL },
+		{ 240u, 0x9e3779b97f4a7c15ULL, 0x2d882e7899ff64ccULL, 0xde896b7f1ae3bc6fULL, 0x5b131678a4a9b8f4ULL },
+		{ 241u, 0x9e3779b97f4a7c15ULL, 0x422e82e8913e49e0ULL, 0x422e82e8913e49e0ULL, 0xc39cbfb460caf47eULL },
+		{ 255u, 0x9e3779b97f4a7c15ULL, 0x8f2f859ce5068ddfULL, 0x8f2f859ce5068ddfULL, 0xa83ad8ee2d42c86fULL },
+		{ 256u, 0x9e3779b97f4a7c15ULL, 0xb4dbe810e81c3d97ULL, 0xb4dbe810e81c3d97ULL, 0xba6635ddc89f0599ULL },
+		{ 257u, 0x9e3779b97f4a7c15ULL, 0xb87fedcb6c4cd0d3ULL, 0xb87fedcb6c4cd0d3ULL, 0x7eb7dcc911d97a4eULL },
+		{ 1024u, 0x9e3779b97f4a7c15ULL, 0x7e249adc60e1f9b4ULL, 0x7e249adc60e1f9b4ULL, 0x927c8d2b50d33f53ULL },
+		{ 1025u, 0x9e3779b97f4a7c15ULL, 0x16cfe055154ff1ddULL, 0x16cfe055154ff1ddULL, 0x0d225711ec9bb344ULL },
+		{ 2048u, 0x9e3779b97f4a7c15ULL, 0x060600a6317839f9ULL, 0x060600a6317839f9ULL, 0x51a684c4afa32172ULL },
+		{ 4109u, 0x9e3779b97f4a7c15ULL, 0xd852bc11b0a452abULL, 0xd852bc11b0a452abULL, 0x5baa69ad236d99aaULL },
+		{ 100000u, 0x9e3779b97f4a7c15ULL, 0x72b33bdf88b29062ULL, 0x72b33bdf88b29062ULL, 0x2abc43450128ff74ULL }
+};
+
+/**
+ * This is our main fast hash testing class. The SetUp and TearDown methods are
+ * executed before the test runs and after it completes. This is where we can
+ * add any custom set up for each test without having to add this to "every"
+ * test individually.
+ */
+class FastHashTest : public BaseTest
+{
+protected:
+
+	/** Run immediately before a test starts. Builds the pattern data. */
+	void SetUp()
+	{
+		// Call the parent setup method
+		BaseTest::SetUp();
+
+		// The data each reference hash was generated from
+		_data.resize(100000);
+		for (unsigned int i = 0; i < _data.size(); ++i)
+		{
+			_data[i] = static_cast<char>((i * 31 + 7) & 0xff);
+		}
+	}
+
+	/** Invoked immediately after a test finishes. Stops the timer. */
+	void TearDown()
+	{
+		// Call the parent tear down method
+		BaseTest::TearDown();
+
+		// Any custom teardown you may need
+	}
+
+	/** Returns the number of reference hashes. */
+	unsigned int vectorCount() const
+	{
+		return sizeof(gVectors) / sizeof(gVectors[0]);
+	}
+
+	// Instance member variables
+	std::vector<char> _data;
+};
+
+TEST_F(FastHashTest, testHash64)
+{
+	for (unsigned int i = 0; i < vectorCount(); ++i)
+	{
+		const FastHashVector& vector = gVectors[i];
+		EXPECT_EQ(vector.hash64, bump::FastHash::hash64(&_data[0], vector.length, vector.seed)) << "length " << vector.length;
+	}
+
+	// Textual data
+	bump::String data = "This is a simple string that I'm going to hash";
+	EXPECT_EQ(bump::FastHash::hash64(data.c_str(), data.size()), bump::FastHash::hash64(data));
+	EXPECT_NE(bump::FastHash::hash64(data), bump::FastHash::hash64(data, 1));
+}
+
+TEST_F(FastHashTest, testHash128)
+{
+	for (unsigned int i = 0; i < vectorCount(); ++i)
+	{
+		const FastHashVector& vector = gVectors[i];
+		bump::Hash128 hash = bump::FastHash::hash128(&_data[0], vector.length, vector.seed);
+		EXPECT_EQ(vector.hash128Low, hash.low) << "length " << vector.length;
+		EXPECT_EQ(vector.hash128High, hash.high) << "length " << vector.length;
+	}
+
+	// Comparison operators
+	bump::Hash128 first = bump::FastHash::hash128("first", 5);
+	bump::Hash128 second = bump::FastHash::hash128("second", 6);
+	EXPECT_TRUE(first == bump::FastHash::hash128(bump::String("first")));
+	EXPECT_TRUE(first != second);
+	EXPECT_TRUE(first < second || second < first);
+}
+
+TEST_F(FastHashTest, testStreaming)
+{
+	// Feed the data in chunk sizes that straddle the internal buffer and block boundaries
+	const unsigned int chunkSizes[] = { 1, 7, 64, 100, 255, 256, 257, 1000, 5000 };
+	for (unsigned int chunk = 0; chunk < sizeof(chunkSizes) / sizeof(chunkSizes[0]); ++chunk)
+	{
+		for (unsigned int i = 0; i < vectorCount(); ++i)
+		{
+			const FastHashVector& vector = gVectors[i];
+			bump::FastHash hash(vector.seed);
+			for (unsigned int offset = 0; offset < vector.length; offset += chunkSizes[chunk])
+			{
+				const unsigned int remaining = vector.length - offset;
+				hash.update(&_data[offset], remaining < chunkSizes[chunk] ? remaining : chunkSizes[chunk]);
+			}
+			EXPECT_EQ(vector.hash64, hash.result64()) << "length " << vector.length << " chunk " << chunkSizes[chunk];
+			EXPECT_EQ(vector.hash128Low, hash.result128().low) << "length " << vector.length << " chunk " << chunkSizes[chunk];
+			EXPECT_EQ(vector.hash128High, hash.result128().high) << "length " << vector.length << " chunk " << chunkSizes[chunk];
+		}
+	}
+
+	// Reset starts a new hash with the new seed
+	bump::FastHash hash;
+	hash.update(&_data[0], 5000);
+	hash.reset(gVectors[vectorCount() - 1].seed);
+	hash.update(&_data[0], gVectors[vectorCount() - 1].length);
+	EXPECT_EQ(gVectors[vectorCount() - 1].hash64, hash.result64());
+
+	// Results can be taken while more data is still being added
+	hash.reset();
+	hash.update(bump::String("split "));
+	unsigned long long partial = hash.result64();
+	hash.update(bump::String("string"));
+	EXPECT_EQ(bump::FastHash::hash64(bump::String("split ")), partial);
+	EXPECT_EQ(bump::FastHash::hash64(bump::String("split string")), hash.result64());
+}
+
+#ifndef BOOST_NO_CXX11_HDR_UNORDERED_SET
+TEST_F(FastHashTest, testStdHash)
+{
+	// Strings
+	std::unordered_set<bump::String> strings;
+	strings.insert("one");
+	strings.insert("two");
+	strings.insert("one");
+	EXPECT_EQ(2, strings.size());
+	EXPECT_EQ(1, strings.count("two"));
+	EXPECT_EQ(bump::FastHash::hash64(bump::String("one")), std::hash<bump::String>()("one"));
+
+	// Uuids
+	std::unordered_set<bump::Uuid> uuids;
+	bump::Uuid uuid = bump::Uuid::fromString("4605d211-2d5b-4ab4-8feb-d7c38e4e38c3");
+	uuids.insert(uuid);
+	uuids.insert(bump::Uuid());
+	uuids.insert(uuid);
+	EXPECT_EQ(2, uuids.size());
+	EXPECT_EQ(1, uuids.count(uuid));
+}
+#endif
+
+}	// End of bumpTest namespace
@@ -988,4 +988,31 @@ TEST_F(FileInfoTest, testModifiedDate)
 	EXPECT_EQ(time, modified_date);
 }
 
+
+TEST_F(FileInfoTest, testTryMethods)
+{
+	// Files report their size, emptiness and modified date
+	bump::Expected<unsigned long long> size = bump::FileInfo("unittest/files/info.xml").tryFileSize();
+	ASSERT_TRUE(size.hasValue());
+	EXPECT_EQ(bump::FileInfo("unittest/files/info.xml").fileSize(), size.value());
+	EXPECT_FALSE(bump::FileInfo("unittest/files/info.xml").tryIsEmpty().value());
+	EXPECT_TRUE(bump::FileInfo("unittest/files/output.txt").tryIsEmpty().value());
+	EXPECT_TRUE(bump::FileInfo("unittest/files").tryModifiedDate().hasValue());
+
+	// Directories have no size
+	size = bump::FileInfo("unittest/files").tryFileSize();
+	EXPECT_FALSE(size.hasValue());
+	EXPECT_EQ(bump::Result::FILE_SYSTEM_ERROR, size.result().type());
+	EXPECT_EQ(boost::system::errc::is_a_directory, size.result().code());
+
+	// Invalid paths report why instead of throwing
+	const bump::FileInfo missing("unittest/files/nope_output.txt");
+	size = missing.tryFileSize();
+	EXPECT_EQ(boost::system::errc::no_such_file_or_directory, size.result().code());
+	EXPECT_EQ(42, size.valueOr(42));
+	EXPECT_THROW(size.value(), bump::FileSystemError);
+	EXPECT_FALSE(missing.tryIsEmpty().hasValue());
+	EXPECT_FALSE(missing.tryModifiedDate().hasValue());
+	EXPECT_TRUE(missing.tryModifiedDate().result().message().startsWith("Could not read the modified date: "));
+}
 }	// End of bumpTest namespace
@@ -10,6 +10,7 @@
 #include <boost/foreach.hpp>
 
 // Bump headers
+#include <bump/Arena.h>
 #include <bump/FileSystem.h>
 #include <bump/FileSystemError.h>
 
@@ -769,6 +770,24 @@ TEST_F(FileSystemTest, testDirectoryList)
 	EXPECT_EQ(2, symlink_dir_list.size());
 	EXPECT_STREQ("unittest/symlink_directory/help.pdf", symlink_dir_list.at(0).c_str());
 	EXPECT_STREQ("unittest/symlink_directory/paper.doc", symlink_dir_list.at(1).c_str());
+
+	// The arena list matches the regular list, and is allocated from the arena
+	bump::MonotonicArena arena;
+	bump::ArenaStringList arena_list = bump::FileSystem::directoryList("unittest", &arena);
+	EXPECT_EQ(&arena, arena_list.get_allocator().resource());
+	EXPECT_EQ(unittest_list.size(), arena_list.size());
+	for (unsigned int i = 0; i < arena_list.size() && i < unittest_list.size(); ++i)
+	{
+		EXPECT_STREQ(unittest_list.at(i).c_str(), arena_list.at(i).c_str());
+		EXPECT_EQ(&arena, arena_list.at(i).get_allocator().resource());
+	}
+	EXPECT_THROW(bump::FileSystem::directoryList("unittest/not_a_directory", &arena), bump::FileSystemError);
+
+	// The table matches the regular list too
+	EXPECT_EQ(unittest_list, bump::FileSystem::directoryTable("unittest").toStringList());
+	EXPECT_EQ(files_list, bump::FileSystem::directoryTable("unittest/files").toStringList());
+	EXPECT_TRUE(bump::FileSystem::directoryTable("unittest/empty_dir1").empty());
+	EXPECT_THROW(bump::FileSystem::directoryTable("unittest/not_a_directory"), bump::FileSystemError);
 }
 
 TEST_F(FileSystemTest, testDirectoryInfoList)
@@ -999,6 +1018,39 @@ TEST_F(FileSystemTest, testRenameFile)
 	EXPECT_TRUE(bump::FileSystem::renameFile(source, destination));
 }
 
+TEST_F(FileSystemTest, testTryFileMethods)
+{
+	// Successful results have no error code
+	bump::Result result = bump::FileSystem::tryCopyFile("unittest/files/output.txt", "unittest/files/output_copy.txt");
+	EXPECT_TRUE(result.isSuccess());
+	EXPECT_FALSE(result.code());
+	EXPECT_TRUE(result.message().empty());
+
+	// Failures carry the cause
+	result = bump::FileSystem::tryCopyFile("unittest/files/output.txt", "unittest/files/output_copy.txt");
+	EXPECT_TRUE(result.isError());
+	EXPECT_EQ(bump::Result::FILE_SYSTEM_ERROR, result.type());
+	EXPECT_EQ(boost::system::errc::file_exists, result.code());
+	EXPECT_TRUE(result.message().startsWith("Could not copy the file: "));
+	result = bump::FileSystem::tryRenameFile("unittest/I do not exist/file4.txt", "unittest/files/file4.txt");
+	EXPECT_EQ(boost::system::errc::no_such_file_or_directory, result.code());
+	result = bump::FileSystem::tryRemoveFile("unittest/files");
+	EXPECT_EQ(boost::system::errc::is_a_directory, result.code());
+	EXPECT_STREQ("The path is not a file", result.description());
+	result = bump::FileSystem::tryCreateFile("unittest/files/output.txt");
+	EXPECT_EQ(boost::system::errc::file_exists, result.code());
+
+	// Directories report their causes too
+	EXPECT_TRUE(bump::FileSystem::tryCreateDirectory("unittest/files/testing").isSuccess());
+	result = bump::FileSystem::tryCreateDirectory("unittest/files/testing");
+	EXPECT_EQ(boost::system::errc::file_exists, result.code());
+	result = bump::FileSystem::tryRemoveDirectory("unittest/files/output.txt");
+	EXPECT_EQ(boost::system::errc::not_a_directory, result.code());
+	result = bump::FileSystem::tryRemoveDirectory("unittest/files");
+	EXPECT_EQ(boost::system::errc::directory_not_empty, result.code());
+	EXPECT_TRUE(bump::FileSystem::tryRemoveDirectoryAndContents("unittest/files").isSuccess());
+}
+
 TEST_F(FileSystemTest, testCreateDirectorySymbolicLink)
 {
 	// Create a valid relative path directory symlink
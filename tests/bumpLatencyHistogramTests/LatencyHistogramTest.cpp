@@ -0,0 +1,218 @@
+//
+//	LatencyHistogramTest.cpp
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+// C++ headers
+#include <new>
+#include <sstream>
+
+// Boost headers
+#include <boost/bind.hpp>
+#include <boost/thread.hpp>
+#include <boost/type_traits/aligned_storage.hpp>
+
+// Bump headers
+#include <bump/AutoTimer.h>
+#include <bump/LatencyHistogram.h>
+#include <bump/Log.h>
+
+// bumpTest headers
+#include "../bumpTest/BaseTest.h"
+
+namespace bumpTest {
+
+/** Records the values 1 to count into the histogram. */
+void recordSequence(bump::LatencyHistogram* histogram, unsigned int count)
+{
+	for (unsigned int i = 1; i <= count; ++i)
+	{
+		histogram->record(i);
+	}
+}
+
+/**
+ * This is our main latency histogram testing class. The SetUp and TearDown methods are
+ * executed before the test runs and after it completes. This is where we can
+ * add any custom set up for each test without having to add this to "every"
+ * test individually.
+ */
+class LatencyHistogramTest : public BaseTest
+{
+protected:
+
+	/** Run immediately before a test starts. Starts the timer. */
+	void SetUp()
+	{
+		// Call the parent setup method
+		BaseTest::SetUp();
+
+		// Any custom setup we may need
+	}
+
+	/** Invoked immediately after a test finishes. Stops the timer. */
+	void TearDown()
+	{
+		// Call the parent tear down method
+		BaseTest::TearDown();
+
+		// Any custom teardown you may need
+	}
+};
+
+TEST_F(LatencyHistogramTest, testEmpty)
+{
+	bump::LatencyHistogram histogram("empty");
+	EXPECT_EQ("empty", histogram.name());
+	EXPECT_EQ(0, histogram.count());
+	EXPECT_EQ(0, histogram.min());
+	EXPECT_EQ(0, histogram.max());
+	EXPECT_EQ(0.0, histogram.mean());
+	EXPECT_EQ(0, histogram.percentile(50.0));
+}
+
+TEST_F(LatencyHistogramTest, testPercentiles)
+{
+	// Record the values 1 to 100000
+	bump::LatencyHistogram histogram;
+	recordSequence(&histogram, 100000);
+	EXPECT_EQ(100000, histogram.count());
+	EXPECT_EQ(1, histogram.min());
+	EXPECT_EQ(100000, histogram.max());
+	EXPECT_DOUBLE_EQ(50000.5, histogram.mean());
+
+	// Small values are exact and large values are within the bucket precision
+	EXPECT_EQ(1, histogram.percentile(0.0));
+	EXPECT_EQ(50, histogram.percentile(0.05));
+	EXPECT_NEAR(50000.0, (double) histogram.percentile(50.0), 50000 * 0.016);
+	EXPECT_NEAR(99000.0, (double) histogram.percentile(99.0), 99000 * 0.016);
+	EXPECT_NEAR(99900.0, (double) histogram.percentile(99.9), 99900 * 0.016);
+	EXPECT_EQ(100000, histogram.percentile(100.0));
+
+	// Percentiles never go backwards
+	unsigned long long previous = 0;
+	for (double percentile = 0.0; percentile <= 100.0; percentile += 0.5)
+	{
+		const unsigned long long value = histogram.percentile(percentile);
+		EXPECT_LE(previous, value);
+		previous = value;
+	}
+
+	// Huge values are counted too
+	histogram.record(~0ULL);
+	EXPECT_EQ(~0ULL, histogram.max());
+	EXPECT_EQ(~0ULL, histogram.percentile(100.0));
+
+	// Resetting removes every sample
+	histogram.reset();
+	EXPECT_EQ(0, histogram.count());
+	EXPECT_EQ(0, histogram.max());
+}
+
+TEST_F(LatencyHistogramTest, testThreadsAndMerge)
+{
+	// Each thread records into its own shard, and the samples outlive the threads
+	bump::LatencyHistogram histogram;
+	boost::thread_group threads;
+	for (unsigned int i = 0; i < 4; ++i)
+	{
+		threads.create_thread(boost::bind(recordSequence, &histogram, 10000));
+	}
+	threads.join_all();
+	recordSequence(&histogram, 10000);
+	EXPECT_EQ(50000, histogram.count());
+	EXPECT_EQ(1, histogram.min());
+	EXPECT_EQ(10000, histogram.max());
+
+	// Merging adds every sample of the other histogram
+	bump::LatencyHistogram other;
+	other.record(20000);
+	histogram.merge(other);
+	EXPECT_EQ(50001, histogram.count());
+	EXPECT_EQ(20000, histogram.max());
+	EXPECT_EQ(1, other.count());
+}
+
+TEST_F(LatencyHistogramTest, testAddressReuseAndReset)
+{
+	// A histogram built where another was destroyed never records into the old one's shard
+	boost::aligned_storage<sizeof(bump::LatencyHistogram)>::type storage;
+	bump::LatencyHistogram* first = new (&storage) bump::LatencyHistogram();
+	first->record(10);
+	first->~LatencyHistogram();
+	bump::LatencyHistogram* second = new (&storage) bump::LatencyHistogram();
+	second->record(20);
+	EXPECT_EQ(1, second->count());
+	EXPECT_EQ(20, second->max());
+
+	// Resetting from another thread empties the shard, and the owner keeps recording into it
+	boost::thread resetThread(boost::bind(&bump::LatencyHistogram::reset, second));
+	resetThread.join();
+	EXPECT_EQ(0, second->count());
+	EXPECT_EQ(0, second->max());
+	second->record(30);
+	EXPECT_EQ(1, second->count());
+	EXPECT_EQ(30, second->min());
+	EXPECT_EQ(30, second->max());
+	second->~LatencyHistogram();
+}
+
+TEST_F(LatencyHistogramTest, testDestroyAfterThreadsExit)
+{
+	// Histograms erase their shards from the maps of threads that have already exited
+	bump::LatencyHistogram* histogram = new bump::LatencyHistogram();
+	boost::thread recordThread(boost::bind(recordSequence, histogram, 100));
+	recordThread.join();
+	recordSequence(histogram, 100);
+	EXPECT_EQ(200, histogram->count());
+	delete histogram;
+
+	// Many short-lived histograms on the same thread each leave nothing behind
+	for (unsigned int i = 0; i < 1000; ++i)
+	{
+		bump::LatencyHistogram shortLived;
+		shortLived.record(i + 1);
+		EXPECT_EQ(1, shortLived.count());
+	}
+}
+
+TEST_F(LatencyHistogramTest, testRegistryAndAutoTimer)
+{
+	// Names always map to the same histogram
+	bump::LatencyHistogram* histogram = bump::LatencyHistogram::named("LatencyHistogramTest.autoTimer");
+	EXPECT_EQ(histogram, bump::LatencyHistogram::named("LatencyHistogramTest.autoTimer"));
+	EXPECT_NE(histogram, bump::LatencyHistogram::named("LatencyHistogramTest.other"));
+	histogram->reset();
+
+	// AutoTimers record into the histogram rather than printing
+	{
+		bump::AutoTimer timer(*histogram);
+		boost::this_thread::sleep_for(boost::chrono::milliseconds(5));
+	}
+	{
+		bump::AutoTimer timer("LatencyHistogramTest.autoTimer");
+	}
+	EXPECT_EQ(2, histogram->count());
+	EXPECT_LE(5000000ULL * 63 / 64, histogram->max());
+
+	// Logging the histograms writes their summaries
+	std::stringstream stream;
+	bump::Log::instance()->setIsLogEnabled(true);
+	bump::Log::LogLevel previousLogLevel = bump::Log::instance()->logLevel();
+	bump::Log::instance()->setLogLevel(bump::Log::INFO_LVL);
+	bump::Log::instance()->setLogStream(stream);
+	bump::LatencyHistogram::logAll();
+	bump::Log::instance()->setLogStream(std::cout);
+	bump::Log::instance()->setLogLevel(previousLogLevel);
+
+	EXPECT_NE(std::string::npos, stream.str().find("LatencyHistogramTest.autoTimer count=2 "));
+	EXPECT_EQ(std::string::npos, stream.str().find("LatencyHistogramTest.other"));
+
+	// The periodic logging thread is left running, and the registry stops it before exiting
+	bump::LatencyHistogram::startPeriodicLogging(3600);
+}
+
+}	// End of bumpTest namespace
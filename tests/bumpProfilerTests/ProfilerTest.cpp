@@ -0,0 +1,271 @@
+//
+//	ProfilerTest.cpp
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+// C++ headers
+#include <vector>
+
+// Boost headers
+#include <boost/atomic.hpp>
+#include <boost/bind.hpp>
+#include <boost/thread/thread.hpp>
+
+// Bump headers
+#include <bump/Profiler.h>
+
+// bumpTest headers
+#include "../bumpTest/BaseTest.h"
+
+namespace bumpTest {
+
+/** Spins for roughly the given number of microseconds so scopes have measurable times. */
+void spin(unsigned int microseconds)
+{
+	bump::Timer timer;
+	while (timer.microsecondsElapsed() < microseconds)
+	{
+		;
+	}
+}
+
+/** A small call tree with a scope that is reached through two different paths. */
+void tokenize()
+{
+	BUMP_PROFILE_SCOPE("tokenize");
+	spin(50);
+}
+
+void parse()
+{
+	BUMP_PROFILE_SCOPE("parse");
+	spin(50);
+	for (unsigned int i = 0; i < 3; ++i)
+	{
+		tokenize();
+	}
+}
+
+void compile()
+{
+	BUMP_PROFILE_SCOPE("compile");
+	parse();
+	tokenize();
+}
+
+/** Enters the same scopes many times from several threads. */
+void profileThread()
+{
+	for (unsigned int i = 0; i < 1000; ++i)
+	{
+		BUMP_PROFILE_SCOPE("work");
+		BUMP_PROFILE_SCOPE("step");
+	}
+}
+
+/** Enters the same scope until told to stop, counting the scopes it finished. */
+void profileUntilStopped(const boost::atomic<bool>* stop, boost::atomic<unsigned int>* finished)
+{
+	while (!stop->load())
+	{
+		{
+			BUMP_PROFILE_SCOPE("busy");
+		}
+		finished->fetch_add(1);
+	}
+}
+
+/** Returns the entry with the given name and depth, or NULL. */
+const bump::Profiler::Entry* findEntry(const std::vector<bump::Profiler::Entry>& entries, const bump::String& name, unsigned int depth)
+{
+	for (unsigned int i = 0; i < entries.size(); ++i)
+	{
+		if (entries[i].name == name && entries[i].depth == depth)
+		{
+			return &entries[i];
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * This is our main profiler testing class. The SetUp and TearDown methods are
+ * executed before the test runs and after it completes. This is where we can
+ * add any custom set up for each test without having to add this to "every"
+ * test individually.
+ */
+class ProfilerTest : public BaseTest
+{
+protected:
+
+	/** Run immediately before a test starts. Starts the timer. */
+	void SetUp()
+	{
+		// Call the parent setup method
+		BaseTest::SetUp();
+
+		// Start every test without any measurements
+		bump::Profiler::reset();
+	}
+
+	/** Invoked immediately after a test finishes. Stops the timer. */
+	void TearDown()
+	{
+		// Call the parent tear down method
+		BaseTest::TearDown();
+
+		// Any custom teardown you may need
+	}
+};
+
+TEST_F(ProfilerTest, testCallTree)
+{
+	EXPECT_TRUE(bump::Profiler::entries().empty());
+	EXPECT_TRUE(bump::Profiler::report().empty());
+
+	compile();
+	compile();
+
+	// The scopes are reported depth-first with the slowest children first
+	const std::vector<bump::Profiler::Entry> entries = bump::Profiler::entries();
+	ASSERT_EQ(4, entries.size());
+	EXPECT_EQ("compile", entries[0].name);
+	EXPECT_EQ(0, entries[0].depth);
+	EXPECT_EQ("parse", entries[1].name);
+	EXPECT_EQ(1, entries[1].depth);
+	EXPECT_EQ("tokenize", entries[2].name);
+	EXPECT_EQ(2, entries[2].depth);
+	EXPECT_EQ("tokenize", entries[3].name);
+	EXPECT_EQ(1, entries[3].depth);
+
+	// Each call path counts its own calls
+	EXPECT_EQ(2, entries[0].calls);
+	EXPECT_EQ(2, entries[1].calls);
+	EXPECT_EQ(6, entries[2].calls);
+	EXPECT_EQ(2, entries[3].calls);
+
+	// Exclusive time excludes the nested scopes
+	EXPECT_GE(entries[0].inclusiveNanoseconds, entries[1].inclusiveNanoseconds + entries[3].inclusiveNanoseconds);
+	EXPECT_EQ(entries[0].inclusiveNanoseconds - entries[1].inclusiveNanoseconds - entries[3].inclusiveNanoseconds, entries[0].exclusiveNanoseconds);
+	EXPECT_EQ(entries[1].inclusiveNanoseconds - entries[2].inclusiveNanoseconds, entries[1].exclusiveNanoseconds);
+	EXPECT_EQ(entries[2].inclusiveNanoseconds, entries[2].exclusiveNanoseconds);
+	EXPECT_GE(entries[2].inclusiveNanoseconds, 6 * 50000ULL);
+
+	// Resetting clears the measurements
+	bump::Profiler::reset();
+	EXPECT_TRUE(bump::Profiler::entries().empty());
+}
+
+TEST_F(ProfilerTest, testOpenScopes)
+{
+	// Open scopes are reported when they enclose finished ones
+	BUMP_PROFILE_SCOPE("outer");
+	tokenize();
+
+	const std::vector<bump::Profiler::Entry> entries = bump::Profiler::entries();
+	ASSERT_EQ(2, entries.size());
+	EXPECT_EQ("outer", entries[0].name);
+	EXPECT_EQ(0, entries[0].calls);
+	EXPECT_EQ(0, entries[0].inclusiveNanoseconds);
+	EXPECT_EQ(1, entries[1].calls);
+}
+
+TEST_F(ProfilerTest, testThreads)
+{
+	// The call trees of every thread are merged by name
+	boost::thread_group threads;
+	for (unsigned int i = 0; i < 4; ++i)
+	{
+		threads.create_thread(profileThread);
+	}
+	profileThread();
+	threads.join_all();
+
+	const std::vector<bump::Profiler::Entry> entries = bump::Profiler::entries();
+	const bump::Profiler::Entry* work = findEntry(entries, "work", 0);
+	const bump::Profiler::Entry* step = findEntry(entries, "step", 1);
+	ASSERT_TRUE(work != NULL);
+	ASSERT_TRUE(step != NULL);
+	EXPECT_EQ(5000, work->calls);
+	EXPECT_EQ(5000, step->calls);
+	EXPECT_GE(work->inclusiveNanoseconds, step->inclusiveNanoseconds);
+}
+
+TEST_F(ProfilerTest, testExitedThreads)
+{
+	// The trees of exited threads are merged into the retired samples and freed
+	for (unsigned int i = 0; i < 50; ++i)
+	{
+		boost::thread thread(profileThread);
+		thread.join();
+	}
+
+	const std::vector<bump::Profiler::Entry> entries = bump::Profiler::entries();
+	const bump::Profiler::Entry* work = findEntry(entries, "work", 0);
+	const bump::Profiler::Entry* step = findEntry(entries, "step", 1);
+	ASSERT_TRUE(work != NULL);
+	ASSERT_TRUE(step != NULL);
+	EXPECT_EQ(50000, work->calls);
+	EXPECT_EQ(50000, step->calls);
+
+	// Resetting clears the retired samples too
+	bump::Profiler::reset();
+	EXPECT_TRUE(bump::Profiler::entries().empty());
+}
+
+TEST_F(ProfilerTest, testResetWhileRecording)
+{
+	// Reset over and over while other threads keep recording
+	boost::atomic<bool> stop(false);
+	boost::atomic<unsigned int> finished(0);
+	boost::thread_group threads;
+	for (unsigned int i = 0; i < 2; ++i)
+	{
+		threads.create_thread(boost::bind(profileUntilStopped, &stop, &finished));
+	}
+	for (unsigned int i = 0; i < 100; ++i)
+	{
+		bump::Profiler::reset();
+		boost::this_thread::yield();
+	}
+
+	// A reset is never undone by a thread that was recording during it
+	bump::Profiler::reset();
+	EXPECT_TRUE(findEntry(bump::Profiler::entries(), "busy", 0) == NULL);
+	const unsigned int before = finished.load();
+	while (finished.load() < before + 10)
+	{
+		boost::this_thread::yield();
+	}
+	stop.store(true);
+	threads.join_all();
+
+	const bump::Profiler::Entry* busy = findEntry(bump::Profiler::entries(), "busy", 0);
+	ASSERT_TRUE(busy != NULL);
+	EXPECT_LE(busy->calls, (unsigned long long) (finished.load() - before + 2));
+
+	bump::Profiler::reset();
+	EXPECT_TRUE(bump::Profiler::entries().empty());
+}
+
+TEST_F(ProfilerTest, testReport)
+{
+	compile();
+
+	// The report has a header and an indented line per scope
+	const bump::StringList lines = bump::Profiler::report().split("\n");
+	ASSERT_EQ(5, lines.size());
+	EXPECT_TRUE(lines[0].contains("Inclusive (ms)"));
+	EXPECT_TRUE(lines[1].endsWith("  compile"));
+	EXPECT_TRUE(lines[2].endsWith("    parse"));
+	EXPECT_TRUE(lines[3].endsWith("      tokenize"));
+	EXPECT_TRUE(lines[4].endsWith("    tokenize"));
+
+	bump::Profiler::log();
+}
+
+}	// End of bumpTest namespace
@@ -0,0 +1,238 @@
+//
+//	SchedulerTest.cpp
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+// C++ headers
+#include <cstdlib>
+#include <vector>
+
+// Boost headers
+#include <boost/bind.hpp>
+#include <boost/thread/thread.hpp>
+
+// Bump headers
+#include <bump/InvalidArgumentError.h>
+#include <bump/NotificationCenter.h>
+#include <bump/Scheduler.h>
+#include <bump/Timeline.h>
+
+// bumpTest headers
+#include "../bumpTest/BaseTest.h"
+
+namespace bumpTest {
+
+/** Records the scheduler time each callback runs at. */
+struct CallbackRecorder
+{
+	CallbackRecorder(bump::Scheduler& scheduler) : scheduler(scheduler), times(), notifications(0) {}
+
+	void record()
+	{
+		times.push_back(scheduler.time());
+	}
+
+	void recordAndCancel(bump::Scheduler::Id* id)
+	{
+		record();
+		if (times.size() == 3)
+		{
+			EXPECT_TRUE(scheduler.cancel(*id));
+		}
+	}
+
+	void recordAndSchedule()
+	{
+		record();
+		scheduler.schedule(0.0, boost::bind(&CallbackRecorder::record, this));
+	}
+
+	void notified()
+	{
+		++notifications;
+	}
+
+	void finished(bump::Timeline& /*timeline*/)
+	{
+		POST_NOTIFICATION("SchedulerTimelineFinished");
+	}
+
+	bump::Scheduler& scheduler;
+	std::vector<double> times;
+	unsigned int notifications;
+};
+
+/**
+ * This is our main scheduler testing class. The SetUp and TearDown methods are
+ * executed before the test runs and after it completes. This is where we can
+ * add any custom set up for each test without having to add this to "every"
+ * test individually.
+ */
+class SchedulerTest : public BaseTest
+{
+protected:
+
+	/** Run immediately before a test starts. Starts the timer. */
+	void SetUp()
+	{
+		// Call the parent setup method
+		BaseTest::SetUp();
+
+		// Any custom setup we may need
+	}
+
+	/** Invoked immediately after a test finishes. Stops the timer. */
+	void TearDown()
+	{
+		// Call the parent tear down method
+		BaseTest::TearDown();
+
+		// Any custom teardown you may need
+	}
+};
+
+TEST_F(SchedulerTest, testSchedule)
+{
+	// One second ticks keep the real clock from moving the scheduler during the test
+	bump::Scheduler scheduler(1.0);
+	CallbackRecorder recorder(scheduler);
+	const bump::Scheduler::Id first = scheduler.schedule(2.0, boost::bind(&CallbackRecorder::record, &recorder));
+	const bump::Scheduler::Id second = scheduler.schedule(5.0, boost::bind(&CallbackRecorder::record, &recorder));
+	const bump::Scheduler::Id third = scheduler.schedule(3.0, boost::bind(&CallbackRecorder::record, &recorder));
+	EXPECT_NE(0, first);
+	EXPECT_NE(first, second);
+	EXPECT_EQ(3, scheduler.size());
+
+	// Callbacks run once they are due
+	EXPECT_EQ(0, scheduler.advance(1.0));
+	EXPECT_EQ(1, scheduler.advance(1.0));
+	EXPECT_EQ(1, recorder.times.size());
+	EXPECT_EQ(2, scheduler.size());
+
+	// Cancelled callbacks never run, and ids can only be cancelled while scheduled
+	EXPECT_TRUE(scheduler.cancel(third));
+	EXPECT_FALSE(scheduler.cancel(third));
+	EXPECT_FALSE(scheduler.cancel(first));
+	EXPECT_FALSE(scheduler.cancel(0));
+	EXPECT_EQ(1, scheduler.advance(10.0));
+	EXPECT_EQ(2, recorder.times.size());
+	EXPECT_EQ(0, scheduler.size());
+
+	// Reused nodes get new ids
+	const bump::Scheduler::Id fourth = scheduler.schedule(1.0, boost::bind(&CallbackRecorder::record, &recorder));
+	EXPECT_NE(first, fourth);
+	EXPECT_NE(second, fourth);
+	EXPECT_NE(third, fourth);
+	EXPECT_FALSE(scheduler.cancel(second));
+	EXPECT_TRUE(scheduler.cancel(fourth));
+
+	// Callbacks scheduled by callbacks without a delay run on the next tick
+	scheduler.schedule(1.0, boost::bind(&CallbackRecorder::recordAndSchedule, &recorder));
+	EXPECT_EQ(1, scheduler.advance(1.0));
+	EXPECT_EQ(1, scheduler.size());
+	EXPECT_EQ(1, scheduler.advance(1.0));
+	EXPECT_EQ(4, recorder.times.size());
+
+	EXPECT_THROW(bump::Scheduler(0.0), bump::InvalidArgumentError);
+}
+
+TEST_F(SchedulerTest, testPeriodic)
+{
+	bump::Scheduler scheduler(1.0);
+	CallbackRecorder recorder(scheduler);
+	bump::Scheduler::Id id = scheduler.schedulePeriodic(2.0, boost::bind(&CallbackRecorder::recordAndCancel, &recorder, &id));
+
+	// Periodic callbacks run every interval
+	EXPECT_EQ(0, scheduler.advance(1.0));
+	EXPECT_EQ(1, scheduler.advance(1.0));
+	EXPECT_EQ(0, scheduler.advance(1.0));
+	EXPECT_EQ(1, scheduler.advance(1.0));
+	EXPECT_EQ(1, scheduler.size());
+
+	// Missed runs are skipped rather than run in a burst
+	EXPECT_EQ(1, scheduler.advance(9.0));
+	EXPECT_EQ(3, recorder.times.size());
+
+	// The callback cancelled itself on its third run
+	EXPECT_EQ(0, scheduler.size());
+	EXPECT_EQ(0, scheduler.advance(10.0));
+	EXPECT_FALSE(scheduler.cancel(id));
+}
+
+TEST_F(SchedulerTest, testWheels)
+{
+	// Spread callbacks across the first three wheels, plus a few due much later
+	bump::Scheduler scheduler(1.0);
+	CallbackRecorder recorder(scheduler);
+	std::srand(42);
+	std::vector<double> delays;
+	for (unsigned int i = 0; i < 2000; ++i)
+	{
+		delays.push_back(1 + (std::rand() % 40000));
+	}
+	delays.push_back(256.0);
+	delays.push_back(16384.0);
+	delays.push_back(16385.0);
+	for (unsigned int i = 0; i < delays.size(); ++i)
+	{
+		scheduler.schedule(delays[i], boost::bind(&CallbackRecorder::record, &recorder));
+	}
+
+	// Every callback runs on exactly the tick it is due in
+	std::vector<unsigned int> dueCounts(40001, 0);
+	for (unsigned int i = 0; i < delays.size(); ++i)
+	{
+		++dueCounts[static_cast<unsigned int>(delays[i])];
+	}
+	for (unsigned int tick = 1; tick <= 40000; ++tick)
+	{
+		ASSERT_EQ(dueCounts[tick], scheduler.advance(1.0));
+	}
+	EXPECT_EQ(delays.size(), recorder.times.size());
+	EXPECT_EQ(0, scheduler.size());
+
+	// Callbacks in the coarsest wheel and beyond it cascade down to the right tick
+	const double farDelays[] = {70000.0, 5.0e6, 2.0e8, 1.0e10};
+	for (unsigned int i = 0; i < sizeof(farDelays) / sizeof(farDelays[0]); ++i)
+	{
+		scheduler.schedule(farDelays[i], boost::bind(&CallbackRecorder::record, &recorder));
+		EXPECT_EQ(0, scheduler.advance(farDelays[i] - 1.0));
+		EXPECT_EQ(1, scheduler.advance(1.0));
+	}
+}
+
+TEST_F(SchedulerTest, testThread)
+{
+	bump::Scheduler scheduler;
+	CallbackRecorder recorder(scheduler);
+	bump::Observer* observer = new bump::KeyObserver<CallbackRecorder>(&recorder, &CallbackRecorder::notified, "SchedulerTimelineFinished");
+	ADD_OBSERVER(observer);
+
+	// The thread runs the timeline updates and posts the notification when it finishes
+	bump::Timeline timeline(0.05);
+	timeline.setFinishedCallback(boost::bind(&CallbackRecorder::finished, &recorder, _1));
+	timeline.start();
+	scheduler.start();
+	EXPECT_TRUE(scheduler.isRunning());
+	scheduler.scheduleTimeline(timeline, 0.005);
+	scheduler.scheduleNotification(0.01, "SchedulerTimelineFinished");
+
+	for (unsigned int i = 0; i < 200 && scheduler.size() > 0; ++i)
+	{
+		boost::this_thread::sleep_for(boost::chrono::milliseconds(10));
+	}
+
+	scheduler.stop();
+	EXPECT_FALSE(scheduler.isRunning());
+	EXPECT_EQ(0, scheduler.size());
+	EXPECT_EQ(2, recorder.notifications);
+	EXPECT_EQ(bump::Timeline::FINISHED, timeline.state());
+	EXPECT_EQ(100.0, timeline.stepValue());
+
+	REMOVE_OBSERVER(&recorder);
+}
+
+}	// End of bumpTest namespace
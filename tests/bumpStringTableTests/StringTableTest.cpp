@@ -0,0 +1,180 @@
+//
+//	StringTableTest.cpp
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+// Bump headers
+#include <bump/OutOfRangeError.h>
+#include <bump/StringTable.h>
+
+// bumpTest headers
+#include "../bumpTest/BaseTest.h"
+
+namespace bumpTest {
+
+/**
+ * This is our main string table testing class. The SetUp and TearDown methods are
+ * executed before the test runs and after it completes. This is where we can
+ * add any custom set up for each test without having to add this to "every"
+ * test individually.
+ */
+class StringTableTest : public BaseTest
+{
+protected:
+
+	/** Run immediately before a test starts. Starts the timer. */
+	void SetUp()
+	{
+		// Call the parent setup method
+		BaseTest::SetUp();
+	}
+
+	/** Invoked immediately after a test finishes. Stops the timer. */
+	void TearDown()
+	{
+		// Call the parent tear down method
+		BaseTest::TearDown();
+	}
+};
+
+TEST_F(StringTableTest, testAppend)
+{
+	// Empty tables
+	bump::StringTable table;
+	EXPECT_TRUE(table.empty());
+	EXPECT_EQ(0, table.size());
+	EXPECT_EQ(0, table.characterCount());
+	EXPECT_THROW(table.at(0), bump::OutOfRangeError);
+
+	// Strings come back exactly as they were appended, including empty ones
+	table.append("first");
+	table.append("");
+	table.append(bump::String("third"));
+	EXPECT_FALSE(table.empty());
+	EXPECT_EQ(3, table.size());
+	EXPECT_EQ(10, table.characterCount());
+	EXPECT_EQ("first", table.at(0));
+	EXPECT_EQ("", table.at(1));
+	EXPECT_EQ("third", table[2]);
+	EXPECT_STREQ("third", table.string(2).c_str());
+	EXPECT_THROW(table.at(3), bump::OutOfRangeError);
+	EXPECT_THROW(table.string(3), bump::OutOfRangeError);
+
+	// Clearing empties the table
+	table.clear();
+	EXPECT_TRUE(table.empty());
+	EXPECT_EQ(0, table.characterCount());
+	table.append("again");
+	EXPECT_EQ("again", table.at(0));
+}
+
+TEST_F(StringTableTest, testStringList)
+{
+	// Converting to a table and back keeps every string in order
+	bump::StringList strings;
+	strings.push_back("one");
+	strings.push_back("two");
+	strings.push_back("");
+	strings.push_back("four");
+	bump::StringTable table(strings);
+	EXPECT_EQ(4, table.size());
+	bump::StringList converted = table.toStringList();
+	EXPECT_EQ(strings, converted);
+
+	// Equality compares every string in order
+	bump::StringTable same(strings);
+	EXPECT_TRUE(table == same);
+	same.append("five");
+	EXPECT_TRUE(table != same);
+
+	// Moving characters between neighboring strings makes a different table
+	bump::StringTable ab;
+	ab.append("ab");
+	ab.append("c");
+	bump::StringTable a;
+	a.append("a");
+	a.append("bc");
+	EXPECT_TRUE(ab != a);
+}
+
+TEST_F(StringTableTest, testSortAndDedupe)
+{
+	bump::StringTable table;
+	const char* strings[] = { "pear", "apple", "fig", "apple", "", "pear", "banana", "fig", "" };
+	for (unsigned int i = 0; i < sizeof(strings) / sizeof(strings[0]); ++i)
+	{
+		table.append(strings[i]);
+	}
+
+	// Sorting orders the strings character by character
+	table.sort();
+	EXPECT_EQ(9, table.size());
+	EXPECT_EQ("", table.at(0));
+	EXPECT_EQ("", table.at(1));
+	EXPECT_EQ("apple", table.at(2));
+	EXPECT_EQ("apple", table.at(3));
+	EXPECT_EQ("banana", table.at(4));
+	EXPECT_EQ("fig", table.at(5));
+	EXPECT_EQ("fig", table.at(6));
+	EXPECT_EQ("pear", table.at(7));
+	EXPECT_EQ("pear", table.at(8));
+
+	// Deduping a sorted table leaves one of each string
+	table.dedupe();
+	EXPECT_EQ(5, table.size());
+	EXPECT_EQ(18, table.characterCount());
+	EXPECT_EQ("", table.at(0));
+	EXPECT_EQ("apple", table.at(1));
+	EXPECT_EQ("banana", table.at(2));
+	EXPECT_EQ("fig", table.at(3));
+	EXPECT_EQ("pear", table.at(4));
+
+	// Deduping an unsorted table only removes neighbors
+	bump::StringTable unsorted;
+	unsorted.append("b");
+	unsorted.append("b");
+	unsorted.append("a");
+	unsorted.append("b");
+	unsorted.dedupe();
+	EXPECT_EQ(3, unsorted.size());
+	EXPECT_EQ("b", unsorted.at(0));
+	EXPECT_EQ("a", unsorted.at(1));
+	EXPECT_EQ("b", unsorted.at(2));
+
+	// Empty tables sort and dedupe to nothing
+	bump::StringTable empty;
+	empty.sort();
+	empty.dedupe();
+	EXPECT_TRUE(empty.empty());
+}
+
+TEST_F(StringTableTest, testBinarySearch)
+{
+	bump::StringTable table;
+	EXPECT_EQ(bump::StringTable::npos, table.binarySearch("anything"));
+
+	table.append("delta");
+	table.append("alpha");
+	table.append("charlie");
+	table.append("bravo");
+	table.append("");
+	table.sort();
+
+	// Every string is found at its sorted index
+	EXPECT_EQ(0, table.binarySearch(""));
+	EXPECT_EQ(1, table.binarySearch("alpha"));
+	EXPECT_EQ(2, table.binarySearch("bravo"));
+	EXPECT_EQ(3, table.binarySearch("charlie"));
+	EXPECT_EQ(4, table.binarySearch("delta"));
+
+	// Strings that are not in the table, including prefixes and ones past either end
+	EXPECT_EQ(bump::StringTable::npos, table.binarySearch("alph"));
+	EXPECT_EQ(bump::StringTable::npos, table.binarySearch("alphabet"));
+	EXPECT_EQ(bump::StringTable::npos, table.binarySearch("echo"));
+	EXPECT_EQ(bump::StringTable::npos, table.binarySearch("Alpha"));
+}
+
+}	// End of bumpTest namespace
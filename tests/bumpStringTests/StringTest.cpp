@@ -7,14 +7,19 @@
 //
 
 // C++ headers
+#include <clocale>
 #include <limits>
+#include <locale>
 
 // Bump headers
+#include <bump/Arena.h>
 #include <bump/InvalidArgumentError.h>
 #include <bump/OutOfRangeError.h>
 #include <bump/String.h>
 #include <bump/StringSearchError.h>
+#include <bump/StringTable.h>
 #include <bump/TypeCastError.h>
+#include <bump/Uuid.h>
 
 // bumpTest headers
 #include "../bumpTest/BaseTest.h"
@@ -560,6 +565,68 @@ TEST_F(StringTest, testArg9)
 	EXPECT_THROW(str.arg(1, 2, 3, 4, 5, 6, 7, 8, 9), bump::StringSearchError);
 }
 
+#ifndef BOOST_NO_CXX11_VARIADIC_TEMPLATES
+TEST_F(StringTest, testFormat)
+{
+	// Each type is formatted exactly as its String constructor formats it
+	EXPECT_STREQ("1, 0.987, 29, test, true, false, 19.087", bump::String::format("%1, %2, %3, %4, %5, %6, %7",
+		1, 0.987, 29, "test", true, false, 19.087).c_str());
+	EXPECT_EQ(bump::String(std::numeric_limits<long long>::min()), bump::String::format("%1", std::numeric_limits<long long>::min()));
+	EXPECT_EQ(bump::String(std::numeric_limits<unsigned long long>::max()), bump::String::format("%1", std::numeric_limits<unsigned long long>::max()));
+	EXPECT_EQ(bump::String((short)-42), bump::String::format("%1", (short)-42));
+	EXPECT_EQ(bump::String((unsigned char)200), bump::String::format("%1", (unsigned char)200));
+	EXPECT_EQ(bump::String('A'), bump::String::format("%1", 'A'));
+	EXPECT_EQ(bump::String(0), bump::String::format("%1", 0));
+	EXPECT_EQ(bump::String(0.1f), bump::String::format("%1", 0.1f));
+	EXPECT_EQ(bump::String(3.14159265358979), bump::String::format("%1", 3.14159265358979));
+	EXPECT_EQ(bump::String(1.0e-20), bump::String::format("%1", 1.0e-20));
+	EXPECT_EQ(bump::String(-2.5e300), bump::String::format("%1", -2.5e300));
+
+	// Strings, views and uuids
+	const bump::Uuid uuid = bump::Uuid::generateRandom();
+	const std::string stdString("std");
+	EXPECT_EQ(bump::String("String std view ") + uuid.toString(), bump::String::format("%1 %2 %3 %4",
+		bump::String("String"), stdString, boost::string_ref("view and more", 4), uuid));
+
+	// Markers may repeat, appear in any order and go past %9
+	EXPECT_STREQ("b a b", bump::String::format("%2 %1 %2", "a", "b").c_str());
+	EXPECT_STREQ("1 2 3 4 5 6 7 8 9 10 11 1", bump::String::format("%1 %2 %3 %4 %5 %6 %7 %8 %9 %10 %11 %1",
+		1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11).c_str());
+
+	// Percent signs that are not markers are left alone, and arguments are never searched for markers
+	EXPECT_STREQ("100% of %0 %x 50%", bump::String::format("%1% of %0 %x 50%", 100).c_str());
+	EXPECT_STREQ("%2 then done", bump::String::format("%1 then %2", "%2", "done").c_str());
+
+	// Markers without arguments and arguments without markers
+	EXPECT_THROW(bump::String::format("%1 and %2", 1), bump::StringSearchError);
+	EXPECT_THROW(bump::String::format("%1", 1, 2), bump::StringSearchError);
+	EXPECT_THROW(bump::String::format("No markers", 1), bump::StringSearchError);
+}
+
+#ifndef BOOST_NO_CXX11_CONSTEXPR
+TEST_F(StringTest, testFormatMacro)
+{
+	// The macro formats exactly like format()
+	const int count = 10;
+	const bump::String path("test.txt");
+	EXPECT_STREQ("Copying file 3 of 10: test.txt", BUMP_FORMAT("Copying file %1 of %2: %3", 3, count, path).c_str());
+	EXPECT_STREQ("100%", BUMP_FORMAT("%1%", 100).c_str());
+
+	// The checks it runs when compiling
+	static_assert(bump::StringFormat::matchesArguments("%1 %2", 2), "");
+	static_assert(bump::StringFormat::matchesArguments("%2 %1 %2", 2), "");
+	static_assert(bump::StringFormat::matchesArguments("%1 %2 %3 %4 %5 %6 %7 %8 %9 %10", 10), "");
+	static_assert(bump::StringFormat::matchesArguments("100% %1", 1), "");
+	static_assert(!bump::StringFormat::matchesArguments("%1 %2", 1), "");
+	static_assert(!bump::StringFormat::matchesArguments("%1", 2), "");
+	static_assert(!bump::StringFormat::matchesArguments("%1 %3", 3), "");
+	static_assert(!bump::StringFormat::matchesArguments("%10", 1), "");
+	static_assert(!bump::StringFormat::matchesArguments("No markers", 1), "");
+}
+#endif
+
+#endif
+
 TEST_F(StringTest, testAt)
 {
 	// Test all the characters
@@ -1721,6 +1788,50 @@ TEST_F(StringTest, testSplit)
 	EXPECT_STREQ("And Again", result.at(2).c_str());
 }
 
+TEST_F(StringTest, testSplitArena)
+{
+	// The arena split matches the regular split, including the empty pieces at either end
+	const char* strings[] = { "Split By Space", "", " ", "NoSeparators", "  leading", "trailing  ", " both ends ",
+		"I amXyZThis isXyZAnd Again", "a,b;;c,;d" };
+	const char* separators[] = { " ", " ", " ", " ", " ", " ", " ", "XyZ", ",;" };
+	bump::MonotonicArena arena;
+	for (unsigned int i = 0; i < sizeof(strings) / sizeof(strings[0]); ++i)
+	{
+		bump::String str(strings[i]);
+		bump::StringList expected = str.split(separators[i]);
+		bump::ArenaStringList result = str.split(separators[i], &arena);
+		EXPECT_EQ(expected.size(), result.size()) << strings[i];
+		for (unsigned int j = 0; j < result.size() && j < expected.size(); ++j)
+		{
+			EXPECT_STREQ(expected.at(j).c_str(), result.at(j).c_str()) << strings[i];
+		}
+	}
+
+	// Both the list and the strings come from the arena
+	bump::ArenaStringList result = bump::String("Split By Space").split(" ", &arena);
+	EXPECT_EQ(&arena, result.get_allocator().resource());
+	EXPECT_EQ(&arena, result.at(0).get_allocator().resource());
+
+	// Pooled arenas work the same way
+	bump::PoolArena pool;
+	bump::ArenaStringList pooled = bump::String("Split By Space").split(" ", &pool);
+	EXPECT_EQ(&pool, pooled.get_allocator().resource());
+	EXPECT_EQ(3, pooled.size());
+	EXPECT_STREQ("Space", pooled.at(2).c_str());
+}
+
+TEST_F(StringTest, testSplitTable)
+{
+	// The table split matches the regular split, including the empty pieces at either end
+	const char* strings[] = { "Split By Space", "", " ", "  leading", "trailing  ", "I amXyZThis isXyZAnd Again" };
+	const char* separators[] = { " ", " ", " ", " ", " ", "XyZ" };
+	for (unsigned int i = 0; i < sizeof(strings) / sizeof(strings[0]); ++i)
+	{
+		bump::String str(strings[i]);
+		EXPECT_EQ(str.split(separators[i]), str.splitTable(separators[i]).toStringList()) << strings[i];
+	}
+}
+
 TEST_F(StringTest, testStartsWithString)
 {
 	// Test regular strings
@@ -1912,6 +2023,132 @@ TEST_F(StringTest, testToLongLong)
 	EXPECT_THROW(str.toLongLong(), bump::TypeCastError);
 }
 
+TEST_F(StringTest, testTryConversions)
+{
+	// Valid conversions have values
+	EXPECT_EQ(-9909, bump::String("-9909").tryToInt().value());
+	EXPECT_EQ(65535, bump::String("65535").tryToUShort().value());
+	EXPECT_DOUBLE_EQ(400.980, bump::String("400.980").tryToDouble().value());
+	EXPECT_TRUE(bump::String("TRUE").tryToBool().value());
+	EXPECT_FALSE(bump::String("false").tryToBool().value());
+
+	// Invalid conversions report why instead of throwing
+	bump::Expected<int> integer = bump::String("400.980").tryToInt();
+	EXPECT_FALSE(integer.hasValue());
+	EXPECT_EQ(bump::Result::TYPE_CAST_ERROR, integer.result().type());
+	EXPECT_EQ(boost::system::errc::invalid_argument, integer.result().code());
+	EXPECT_EQ(-1, integer.valueOr(-1));
+	EXPECT_THROW(integer.value(), bump::TypeCastError);
+	EXPECT_FALSE(bump::String("").tryToInt().hasValue());
+	EXPECT_FALSE(bump::String(" 12").tryToInt().hasValue());
+	EXPECT_FALSE(bump::String("yes").tryToBool().hasValue());
+
+	// Values out of range are reported as such
+	EXPECT_EQ(boost::system::errc::result_out_of_range, bump::String("65536").tryToUShort().result().code());
+	EXPECT_EQ(boost::system::errc::result_out_of_range, bump::String("1e999").tryToDouble().result().code());
+
+	// Negative numbers are not unsigned
+	EXPECT_FALSE(bump::String("-1").tryToUInt().hasValue());
+	EXPECT_THROW(bump::String("-1").toUInt(), bump::TypeCastError);
+
+	// The limits of each type convert exactly
+	EXPECT_EQ(std::numeric_limits<long long>::min(), bump::String("-9223372036854775808").tryToLongLong().value());
+	EXPECT_EQ(std::numeric_limits<unsigned long long>::max(), bump::String("18446744073709551615").tryToULongLong().value());
+	EXPECT_EQ(boost::system::errc::result_out_of_range, bump::String("-9223372036854775809").tryToLongLong().result().code());
+	EXPECT_EQ(boost::system::errc::result_out_of_range, bump::String("18446744073709551616").tryToULongLong().result().code());
+	EXPECT_EQ(-32768, bump::String("-32768").tryToShort().value());
+	EXPECT_EQ(boost::system::errc::result_out_of_range, bump::String("-32769").tryToShort().result().code());
+	EXPECT_EQ(boost::system::errc::invalid_argument, bump::String("-").tryToInt().result().code());
+}
+
+TEST_F(StringTest, testTryConversionsRejectNonDecimalForms)
+{
+	// Hexadecimal numbers, whitespace and partial words do not convert, unlike with strtod
+	EXPECT_FALSE(bump::String("0x10").tryToDouble().hasValue());
+	EXPECT_FALSE(bump::String("0x10").tryToInt().hasValue());
+	EXPECT_FALSE(bump::String("infin").tryToDouble().hasValue());
+	EXPECT_FALSE(bump::String(" inf").tryToDouble().hasValue());
+	EXPECT_FALSE(bump::String("nan(").tryToDouble().hasValue());
+	EXPECT_FALSE(bump::String(" 1.5").tryToDouble().hasValue());
+	EXPECT_FALSE(bump::String("1.5e").tryToDouble().hasValue());
+	EXPECT_FALSE(bump::String(".").tryToDouble().hasValue());
+
+	// The infinity and nan forms lexical_cast accepted still convert, ignoring case
+	EXPECT_EQ(std::numeric_limits<double>::infinity(), bump::String("inf").toDouble());
+	EXPECT_EQ(-std::numeric_limits<double>::infinity(), bump::String("-INF").toDouble());
+	EXPECT_EQ(std::numeric_limits<double>::infinity(), bump::String("+Infinity").tryToDouble().value());
+	EXPECT_EQ(-std::numeric_limits<float>::infinity(), bump::String("-infinity").toFloat());
+	const double nan = bump::String("nan").toDouble();
+	EXPECT_TRUE(nan != nan);
+	const float nanFloat = bump::String("NaN(123)").toFloat();
+	EXPECT_TRUE(nanFloat != nanFloat);
+
+	// Every part of a decimal number is optional except its digits
+	EXPECT_DOUBLE_EQ(0.5, bump::String(".5").tryToDouble().value());
+	EXPECT_DOUBLE_EQ(5.0, bump::String("5.").tryToDouble().value());
+	EXPECT_DOUBLE_EQ(-1500.0, bump::String("-1.5E+3").tryToDouble().value());
+	EXPECT_FLOAT_EQ(2.5f, bump::String("+2.5").tryToFloat().value());
+}
+
+TEST_F(StringTest, testTryConversionsIgnoreLocale)
+{
+	// Switch to a locale that writes decimal points as commas, where one is installed
+	const std::string previous = std::setlocale(LC_NUMERIC, NULL);
+	const char* locales[] = { "de_DE.UTF-8", "de_DE.utf8", "de_DE", "German_Germany.1252" };
+	for (unsigned int i = 0; i < sizeof(locales) / sizeof(locales[0]); ++i)
+	{
+		if (std::setlocale(LC_NUMERIC, locales[i]) != NULL)
+		{
+			break;
+		}
+	}
+
+	// Numbers are always written with '.' no matter the global C locale
+	EXPECT_DOUBLE_EQ(1.5, bump::String("1.5").tryToDouble().value());
+	EXPECT_FLOAT_EQ(-0.25f, bump::String("-2.5e-1").tryToFloat().value());
+	EXPECT_FALSE(bump::String("1,5").tryToDouble().hasValue());
+	EXPECT_EQ(1234, bump::String("1234").tryToInt().value());
+	EXPECT_EQ(boost::system::errc::result_out_of_range, bump::String("1e999").tryToDouble().result().code());
+#ifndef BOOST_NO_CXX11_VARIADIC_TEMPLATES
+	EXPECT_STREQ("1.5 -0.25", bump::String::format("%1 %2", 1.5, -0.25f).c_str());
+#endif
+	std::setlocale(LC_NUMERIC, previous.c_str());
+}
+
+#ifndef BOOST_NO_CXX11_VARIADIC_TEMPLATES
+
+/** Writes decimal points as commas, like the de_DE locale, without needing it to be installed. */
+class CommaNumpunct : public std::numpunct<char>
+{
+protected:
+
+	char do_decimal_point() const { return ','; }
+};
+
+TEST_F(StringTest, testFormatIgnoresLocale)
+{
+	// Neither the global C++ locale nor the global C locale changes the decimal point
+	const std::locale previous = std::locale::global(std::locale(std::locale::classic(), new CommaNumpunct()));
+	EXPECT_STREQ("1.5 0.987", bump::String::format("%1 %2", 1.5, 0.987f).c_str());
+	std::locale::global(previous);
+}
+
+#endif
+
+TEST_F(StringTest, testTryArg)
+{
+	// Markers are replaced
+	bump::Expected<bump::String> str = bump::String("Hello %1").tryArg("world");
+	ASSERT_TRUE(str.hasValue());
+	EXPECT_STREQ("Hello world", str.value().c_str());
+
+	// Missing markers are reported instead of thrown
+	str = bump::String("Hello").tryArg("world");
+	EXPECT_FALSE(str.hasValue());
+	EXPECT_EQ(bump::Result::STRING_SEARCH_ERROR, str.result().type());
+	EXPECT_THROW(str.value(), bump::StringSearchError);
+}
+
 TEST_F(StringTest, testToLowerCase)
 {
 	// Regular usage tests
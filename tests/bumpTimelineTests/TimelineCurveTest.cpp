@@ -0,0 +1,244 @@
+//
+//	TimelineCurveTest.cpp
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+// C++ headers
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+// Boost headers
+#include <boost/shared_ptr.hpp>
+
+// Bump headers
+#include <bump/InvalidArgumentError.h>
+#include <bump/Timeline.h>
+#include <bump/TimelineCurve.h>
+#include <bump/TimelineGroup.h>
+
+// bumpTest headers
+#include "../bumpTest/BaseTest.h"
+
+namespace bumpTest {
+
+/**
+ * This is our main timeline curve testing class. The SetUp and TearDown methods are
+ * executed before the test runs and after it completes. This is where we can
+ * add any custom set up for each test without having to add this to "every"
+ * test individually.
+ */
+class TimelineCurveTest : public BaseTest
+{
+protected:
+
+	/** Run immediately before a test starts. Starts the timer. */
+	void SetUp()
+	{
+		// Call the parent setup method
+		BaseTest::SetUp();
+
+		// Any custom setup we may need
+	}
+
+	/** Invoked immediately after a test finishes. Stops the timer. */
+	void TearDown()
+	{
+		// Call the parent tear down method
+		BaseTest::TearDown();
+
+		// Any custom teardown you may need
+	}
+};
+
+TEST_F(TimelineCurveTest, testCubicBezierCurve)
+{
+	// Control points on the diagonal make a straight line
+	bump::CubicBezierCurve linear(0.25, 0.25, 0.75, 0.75);
+	for (unsigned int i = 0; i <= 10; ++i)
+	{
+		EXPECT_NEAR(i / 10.0, linear.evaluate(i / 10.0), 1e-7);
+	}
+
+	// The CSS ease curve is symmetric about its midpoint when its control points are
+	bump::CubicBezierCurve easeInOut(0.42, 0.0, 0.58, 1.0);
+	EXPECT_EQ(0.0, easeInOut.evaluate(0.0));
+	EXPECT_EQ(1.0, easeInOut.evaluate(1.0));
+	EXPECT_NEAR(0.5, easeInOut.evaluate(0.5), 1e-7);
+	EXPECT_NEAR(1.0, easeInOut.evaluate(0.2) + easeInOut.evaluate(0.8), 1e-7);
+	EXPECT_LT(easeInOut.evaluate(0.2), 0.2);
+
+	// Flat slopes at the ends fall back to bisection
+	bump::CubicBezierCurve flat(1.0, 0.0, 0.0, 1.0);
+	EXPECT_NEAR(0.5, flat.evaluate(0.5), 1e-7);
+	EXPECT_NEAR(1.0, flat.evaluate(0.001) + flat.evaluate(0.999), 1e-7);
+
+	// Control points may overshoot the output but not the progress
+	bump::CubicBezierCurve overshoot(0.3, -0.5, 0.7, 1.5);
+	EXPECT_LT(overshoot.evaluate(0.1), 0.0);
+	EXPECT_THROW(bump::CubicBezierCurve(1.5, 0.0, 0.5, 1.0), bump::InvalidArgumentError);
+	EXPECT_THROW(bump::CubicBezierCurve(0.5, 0.0, -0.1, 1.0), bump::InvalidArgumentError);
+}
+
+TEST_F(TimelineCurveTest, testSpringCurve)
+{
+	// Underdamped springs overshoot before settling on the end
+	bump::SpringCurve bouncy(0.3, 20.0);
+	EXPECT_NEAR(0.0, bouncy.evaluate(0.0), 1e-12);
+	double peak = 0.0;
+	for (unsigned int i = 0; i <= 100; ++i)
+	{
+		peak = std::max(peak, bouncy.evaluate(i / 100.0));
+	}
+	EXPECT_GT(peak, 1.1);
+	EXPECT_NEAR(1.0, bouncy.evaluate(1.0), 0.01);
+
+	// Critically damped and overdamped springs never overshoot
+	bump::SpringCurve critical(1.0, 20.0);
+	bump::SpringCurve overdamped(2.0, 20.0);
+	double previousCritical = 0.0;
+	double previousOverdamped = 0.0;
+	for (unsigned int i = 1; i <= 100; ++i)
+	{
+		const double criticalValue = critical.evaluate(i / 100.0);
+		const double overdampedValue = overdamped.evaluate(i / 100.0);
+		EXPECT_GT(criticalValue, previousCritical);
+		EXPECT_GT(overdampedValue, previousOverdamped);
+		EXPECT_LT(criticalValue, 1.0);
+		EXPECT_LT(overdampedValue, criticalValue);
+		previousCritical = criticalValue;
+		previousOverdamped = overdampedValue;
+	}
+
+	EXPECT_THROW(bump::SpringCurve(-0.1, 20.0), bump::InvalidArgumentError);
+	EXPECT_THROW(bump::SpringCurve(0.5, 0.0), bump::InvalidArgumentError);
+}
+
+TEST_F(TimelineCurveTest, testStepCurve)
+{
+	bump::StepCurve curve(4);
+	EXPECT_EQ(0.0, curve.evaluate(0.0));
+	EXPECT_EQ(0.0, curve.evaluate(0.24));
+	EXPECT_EQ(0.25, curve.evaluate(0.25));
+	EXPECT_EQ(0.75, curve.evaluate(0.99));
+	EXPECT_EQ(1.0, curve.evaluate(1.0));
+	EXPECT_EQ(1.0, curve.evaluate(2.0));
+	EXPECT_THROW(bump::StepCurve(0), bump::InvalidArgumentError);
+}
+
+TEST_F(TimelineCurveTest, testPiecewiseLinearCurve)
+{
+	// Ramp to half quickly, hold, then finish
+	std::vector<bump::PiecewiseLinearCurve::Point> points;
+	points.push_back(bump::PiecewiseLinearCurve::Point(0.0, 0.0));
+	points.push_back(bump::PiecewiseLinearCurve::Point(0.2, 0.5));
+	points.push_back(bump::PiecewiseLinearCurve::Point(0.8, 0.5));
+	points.push_back(bump::PiecewiseLinearCurve::Point(0.8, 0.6));
+	points.push_back(bump::PiecewiseLinearCurve::Point(1.0, 1.0));
+	bump::PiecewiseLinearCurve curve(points);
+
+	EXPECT_DOUBLE_EQ(0.0, curve.evaluate(0.0));
+	EXPECT_DOUBLE_EQ(0.25, curve.evaluate(0.1));
+	EXPECT_DOUBLE_EQ(0.5, curve.evaluate(0.5));
+	EXPECT_DOUBLE_EQ(0.6, curve.evaluate(0.8));
+	EXPECT_DOUBLE_EQ(0.8, curve.evaluate(0.9));
+	EXPECT_DOUBLE_EQ(1.0, curve.evaluate(1.0));
+
+	// Progress outside the points holds the end values
+	EXPECT_DOUBLE_EQ(0.0, curve.evaluate(-1.0));
+	EXPECT_DOUBLE_EQ(1.0, curve.evaluate(2.0));
+
+	// Points must exist and be sorted
+	EXPECT_THROW(bump::PiecewiseLinearCurve(std::vector<bump::PiecewiseLinearCurve::Point>()), bump::InvalidArgumentError);
+	points.push_back(bump::PiecewiseLinearCurve::Point(0.5, 1.0));
+	EXPECT_THROW(bump::PiecewiseLinearCurve unsorted(points), bump::InvalidArgumentError);
+}
+
+TEST_F(TimelineCurveTest, testLookupTableCurve)
+{
+	// The table matches the curve at its samples and stays close in between
+	bump::CubicBezierCurve bezier(0.25, 0.1, 0.25, 1.0);
+	bump::LookupTableCurve table(bezier, 257);
+	EXPECT_EQ(257, table.samples());
+	EXPECT_EQ(0.0, table.evaluate(0.0));
+	EXPECT_EQ(1.0, table.evaluate(1.0));
+	EXPECT_DOUBLE_EQ(bezier.evaluate(0.5), table.evaluate(0.5));
+	for (unsigned int i = 0; i <= 1000; ++i)
+	{
+		EXPECT_NEAR(bezier.evaluate(i / 1000.0), table.evaluate(i / 1000.0), 1e-4);
+	}
+
+	// Progress outside 0 to 1 is clamped
+	EXPECT_EQ(0.0, table.evaluate(-0.5));
+	EXPECT_EQ(1.0, table.evaluate(1.5));
+
+	// NaN progress is treated as the start of the curve
+	EXPECT_EQ(0.0, table.evaluate(std::numeric_limits<double>::quiet_NaN()));
+
+	// Two samples make a straight line between the ends of the curve
+	bump::LookupTableCurve line(bump::SpringCurve(2.0, 20.0), 2);
+	EXPECT_NEAR(0.5 * bump::SpringCurve(2.0, 20.0).evaluate(1.0), line.evaluate(0.5), 1e-12);
+	EXPECT_THROW(bump::LookupTableCurve(bezier, 1), bump::InvalidArgumentError);
+}
+
+TEST_F(TimelineCurveTest, testTimelineCurves)
+{
+	boost::shared_ptr<const bump::TimelineCurve> curve(new bump::StepCurve(4));
+
+	// Timelines follow their curve in both directions
+	bump::Timeline forwards(2.0);
+	forwards.setOutputRange(10.0, 50.0);
+	forwards.setCurve(curve);
+	EXPECT_EQ(bump::Timeline::CUSTOM_CURVE, forwards.curveShape());
+	EXPECT_EQ(curve, forwards.curve());
+	forwards.start();
+	forwards.advance(0.6);
+	EXPECT_DOUBLE_EQ(20.0, forwards.stepValue());
+	forwards.advance(0.6);
+	EXPECT_DOUBLE_EQ(30.0, forwards.stepValue());
+	EXPECT_DOUBLE_EQ(10.0, forwards.stepIncrement());
+	forwards.advance(1.0);
+	EXPECT_EQ(50.0, forwards.stepValue());
+
+	bump::Timeline backwards(2.0, bump::Timeline::BACKWARDS);
+	backwards.setOutputRange(10.0, 50.0);
+	backwards.setCurve(curve);
+	backwards.start();
+	backwards.advance(0.6);
+	EXPECT_DOUBLE_EQ(40.0, backwards.stepValue());
+	backwards.advance(2.0);
+	EXPECT_EQ(10.0, backwards.stepValue());
+
+	// Group timelines follow the same curve
+	bump::TimelineGroup group;
+	bump::TimelineGroup::Id forwardsId = group.add(2.0, bump::Timeline::FORWARDS, curve);
+	bump::TimelineGroup::Id backwardsId = group.add(2.0, bump::Timeline::BACKWARDS, curve);
+	bump::TimelineGroup::Id linearId = group.add(2.0, bump::Timeline::FORWARDS, bump::Timeline::CUSTOM_CURVE);
+	group.setOutputRange(forwardsId, 10.0, 50.0);
+	group.setOutputRange(backwardsId, 10.0, 50.0);
+	group.start(forwardsId);
+	group.start(backwardsId);
+	group.start(linearId);
+	group.update(1.2);
+	EXPECT_DOUBLE_EQ(30.0, group.stepValue(forwardsId));
+	EXPECT_DOUBLE_EQ(30.0, group.stepValue(backwardsId));
+	EXPECT_DOUBLE_EQ(60.0, group.stepValue(linearId));
+
+	// Paused custom timelines resume on their curve
+	group.pause(forwardsId);
+	group.update(1.5);
+	group.unpause(forwardsId);
+	group.update(1.8);
+	EXPECT_DOUBLE_EQ(40.0, group.stepValue(forwardsId));
+	group.update(2.0);
+	EXPECT_EQ(10.0, group.stepValue(backwardsId));
+	group.update(3.0);
+	EXPECT_EQ(50.0, group.stepValue(forwardsId));
+	EXPECT_EQ(0, group.runningCount());
+}
+
+}	// End of bumpTest namespace
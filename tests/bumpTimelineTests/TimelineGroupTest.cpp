@@ -0,0 +1,225 @@
+//
+//	TimelineGroupTest.cpp
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+// C++ headers
+#include <algorithm>
+#include <vector>
+
+// Bump headers
+#include <bump/OutOfRangeError.h>
+#include <bump/TimelineGroup.h>
+
+// bumpTest headers
+#include "../bumpTest/BaseTest.h"
+
+namespace bumpTest {
+
+/** Computes the expected step value of a timeline the same way Timeline::generateStep() does. */
+double expectedStepValue(double runTime, double duration, bump::Timeline::Direction direction,
+						 bump::Timeline::CurveShape curveShape, double startOutput, double endOutput)
+{
+	if (runTime >= duration)
+	{
+		return direction == bump::Timeline::FORWARDS ? endOutput : startOutput;
+	}
+
+	const double range = endOutput - startOutput;
+	const double remaining = duration - runTime;
+	double covered;
+	if (curveShape == bump::Timeline::EASE_IN_CURVE)
+	{
+		covered = range * runTime * runTime / (duration * duration);
+	}
+	else if (curveShape == bump::Timeline::EASE_OUT_CURVE)
+	{
+		covered = range - range * remaining * remaining / (duration * duration);
+	}
+	else if (curveShape == bump::Timeline::EASE_IN_AND_OUT_CURVE)
+	{
+		const double halfDuration = duration / 2.0;
+		if (runTime < halfDuration)
+		{
+			covered = range * runTime * runTime / (2.0 * halfDuration * halfDuration);
+		}
+		else
+		{
+			covered = range - range * remaining * remaining / (2.0 * halfDuration * halfDuration);
+		}
+	}
+	else // LINEAR_CURVE
+	{
+		covered = range * runTime / duration;
+	}
+
+	return direction == bump::Timeline::FORWARDS ? startOutput + covered : endOutput - covered;
+}
+
+/**
+ * This is our main timeline group testing class. The SetUp and TearDown methods are
+ * executed before the test runs and after it completes. This is where we can
+ * add any custom set up for each test without having to add this to "every"
+ * test individually.
+ */
+class TimelineGroupTest : public BaseTest
+{
+protected:
+
+	/** Run immediately before a test starts. Starts the timer. */
+	void SetUp()
+	{
+		// Call the parent setup method
+		BaseTest::SetUp();
+
+		// Any custom setup we may need
+	}
+
+	/** Invoked immediately after a test finishes. Stops the timer. */
+	void TearDown()
+	{
+		// Call the parent tear down method
+		BaseTest::TearDown();
+
+		// Any custom teardown you may need
+	}
+};
+
+TEST_F(TimelineGroupTest, testCurves)
+{
+	// Add a timeline for every curve shape and direction, with several of each so both the
+	// SIMD and scalar paths are exercised
+	bump::TimelineGroup group;
+	std::vector<bump::TimelineGroup::Id> ids;
+	for (unsigned int copy = 0; copy < 3; ++copy)
+	{
+		for (int shape = 0; shape < 4; ++shape)
+		{
+			for (int direction = 0; direction < 2; ++direction)
+			{
+				bump::TimelineGroup::Id id = group.add(2.0, (bump::Timeline::Direction) direction, (bump::Timeline::CurveShape) shape);
+				group.setOutputRange(id, 10.0, 50.0);
+				group.start(id);
+				ids.push_back(id);
+			}
+		}
+	}
+	EXPECT_EQ(24, group.size());
+	EXPECT_EQ(24, group.runningCount());
+
+	// Every timeline should follow its curve
+	double previousValues[24] = {0.0};
+	const double times[] = {0.25, 0.5, 0.99, 1.0, 1.5, 1.999};
+	for (unsigned int t = 0; t < sizeof(times) / sizeof(times[0]); ++t)
+	{
+		group.update(times[t]);
+		EXPECT_TRUE(group.finished().empty());
+		for (unsigned int i = 0; i < ids.size(); ++i)
+		{
+			const bump::Timeline::Direction direction = (bump::Timeline::Direction) (i % 2);
+			const bump::Timeline::CurveShape shape = (bump::Timeline::CurveShape) ((i / 2) % 4);
+			const double expected = expectedStepValue(times[t], 2.0, direction, shape, 10.0, 50.0);
+			EXPECT_NEAR(expected, group.stepValue(ids[i]), 1e-9);
+			EXPECT_NEAR(expected - previousValues[i], group.stepIncrement(ids[i]), 1e-9);
+			EXPECT_EQ(bump::Timeline::RUNNING, group.state(ids[i]));
+			previousValues[i] = expected;
+		}
+	}
+
+	// Every timeline should finish on exactly its end value
+	group.update(2.0);
+	EXPECT_EQ(24, group.finished().size());
+	EXPECT_EQ(0, group.runningCount());
+	for (unsigned int i = 0; i < ids.size(); ++i)
+	{
+		const double expected = i % 2 == 0 ? 50.0 : 10.0;
+		EXPECT_EQ(bump::Timeline::FINISHED, group.state(ids[i]));
+		EXPECT_EQ(expected, group.stepValue(ids[i]));
+		EXPECT_NEAR(expected - previousValues[i], group.stepIncrement(ids[i]), 1e-9);
+	}
+
+	// The finished list only covers the last update
+	group.update(3.0);
+	EXPECT_TRUE(group.finished().empty());
+}
+
+TEST_F(TimelineGroupTest, testStates)
+{
+	bump::TimelineGroup group;
+	bump::TimelineGroup::Id first = group.add(1.0);
+	bump::TimelineGroup::Id second = group.add(4.0);
+	EXPECT_EQ(bump::Timeline::NOT_RUNNING, group.state(first));
+
+	// Timelines start at the time of the last update
+	group.update(10.0);
+	group.start(first);
+	group.start(second);
+	group.update(10.5);
+	EXPECT_NEAR(50.0, group.stepValue(first), 1e-9);
+	EXPECT_NEAR(12.5, group.stepValue(second), 1e-9);
+
+	// A paused timeline keeps its value and resumes where it left off
+	group.pause(second);
+	EXPECT_EQ(bump::Timeline::PAUSED, group.state(second));
+	group.update(12.0);
+	EXPECT_NEAR(12.5, group.stepValue(second), 1e-9);
+	group.unpause(second);
+	group.update(13.0);
+	EXPECT_NEAR(37.5, group.stepValue(second), 1e-9);
+
+	// The first timeline finished during the update to 12 seconds
+	EXPECT_EQ(bump::Timeline::FINISHED, group.state(first));
+	EXPECT_EQ(100.0, group.stepValue(first));
+
+	// Restarting runs a finished timeline again
+	group.restart(first);
+	group.update(13.25);
+	EXPECT_NEAR(25.0, group.stepValue(first), 1e-9);
+
+	// Stopping removes a timeline from the updates
+	group.stop(second);
+	EXPECT_EQ(bump::Timeline::NOT_RUNNING, group.state(second));
+	EXPECT_EQ(1, group.runningCount());
+
+	// Removed ids are reused and can no longer be queried
+	group.remove(first);
+	EXPECT_EQ(1, group.size());
+	EXPECT_EQ(0, group.runningCount());
+	EXPECT_THROW(group.state(first), bump::OutOfRangeError);
+	EXPECT_THROW(group.start(42), bump::OutOfRangeError);
+	EXPECT_EQ(first, group.add(1.0));
+
+	// Clearing removes everything
+	group.clear();
+	EXPECT_EQ(0, group.size());
+	EXPECT_THROW(group.stepValue(second), bump::OutOfRangeError);
+}
+
+TEST_F(TimelineGroupTest, testManyTimelines)
+{
+	// Start timelines with staggered durations so they finish over several updates
+	bump::TimelineGroup group;
+	for (unsigned int i = 0; i < 1000; ++i)
+	{
+		bump::TimelineGroup::Id id = group.add(1.0 + (i % 10), bump::Timeline::FORWARDS, (bump::Timeline::CurveShape) (i % 4));
+		group.start(id);
+	}
+
+	std::vector<bump::TimelineGroup::Id> finished;
+	for (unsigned int second = 1; second <= 10; ++second)
+	{
+		group.update(second);
+		EXPECT_EQ(100, group.finished().size());
+		finished.insert(finished.end(), group.finished().begin(), group.finished().end());
+	}
+
+	// Every timeline should finish exactly once
+	std::sort(finished.begin(), finished.end());
+	EXPECT_EQ(1000, std::unique(finished.begin(), finished.end()) - finished.begin());
+	EXPECT_EQ(0, group.runningCount());
+}
+
+}	// End of bumpTest namespace
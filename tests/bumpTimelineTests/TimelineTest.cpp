@@ -0,0 +1,178 @@
+//
+//	TimelineTest.cpp
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+// Boost headers
+#include <boost/bind.hpp>
+
+// Bump headers
+#include <bump/Timeline.h>
+
+// bumpTest headers
+#include "../bumpTest/BaseTest.h"
+
+namespace bumpTest {
+
+/** Counts the finished callbacks and optionally restarts the timeline. */
+struct FinishedCounter
+{
+	FinishedCounter() : count(0), restart(false) {}
+
+	void finished(bump::Timeline& timeline)
+	{
+		++count;
+		EXPECT_EQ(bump::Timeline::FINISHED, timeline.state());
+		if (restart)
+		{
+			restart = false;
+			timeline.restart();
+		}
+	}
+
+	unsigned int count;
+	bool restart;
+};
+
+/**
+ * This is our main timeline testing class. The SetUp and TearDown methods are
+ * executed before the test runs and after it completes. This is where we can
+ * add any custom set up for each test without having to add this to "every"
+ * test individually.
+ */
+class TimelineTest : public BaseTest
+{
+protected:
+
+	/** Run immediately before a test starts. Starts the timer. */
+	void SetUp()
+	{
+		// Call the parent setup method
+		BaseTest::SetUp();
+
+		// Any custom setup we may need
+	}
+
+	/** Invoked immediately after a test finishes. Stops the timer. */
+	void TearDown()
+	{
+		// Call the parent tear down method
+		BaseTest::TearDown();
+
+		// Any custom teardown you may need
+	}
+};
+
+TEST_F(TimelineTest, testAdvance)
+{
+	// Fixed steps should produce exactly the same values every run
+	bump::Timeline timeline(2.0, bump::Timeline::FORWARDS, bump::Timeline::EASE_IN_CURVE);
+	timeline.setOutputRange(0.0, 100.0);
+	timeline.start();
+	timeline.advance(0.5);
+	EXPECT_DOUBLE_EQ(6.25, timeline.stepValue());
+	timeline.advance(0.5);
+	EXPECT_DOUBLE_EQ(25.0, timeline.stepValue());
+	EXPECT_DOUBLE_EQ(18.75, timeline.stepIncrement());
+
+	// Paused timelines do not advance
+	timeline.pause();
+	timeline.advance(0.5);
+	EXPECT_DOUBLE_EQ(25.0, timeline.stepValue());
+	timeline.unpause();
+
+	// Passing the duration finishes on exactly the end value
+	timeline.advance(5.0);
+	EXPECT_EQ(bump::Timeline::FINISHED, timeline.state());
+	EXPECT_EQ(100.0, timeline.stepValue());
+	EXPECT_DOUBLE_EQ(75.0, timeline.stepIncrement());
+
+	// Finished timelines ignore updates
+	timeline.advance(1.0);
+	timeline.update();
+	EXPECT_EQ(100.0, timeline.stepValue());
+
+	// Restarting resets the run time
+	timeline.restart();
+	timeline.advance(1.0);
+	EXPECT_DOUBLE_EQ(25.0, timeline.stepValue());
+}
+
+TEST_F(TimelineTest, testUpdateWithClock)
+{
+	bump::Timeline timeline(1.0, bump::Timeline::BACKWARDS, bump::Timeline::LINEAR_CURVE);
+	timeline.setOutputRange(0.0, 10.0);
+
+	// Updates before starting only track the clock
+	timeline.update(100.0);
+	EXPECT_EQ(bump::Timeline::NOT_RUNNING, timeline.state());
+
+	// The first update after starting sets the reference time
+	timeline.start();
+	timeline.update(100.0);
+	EXPECT_DOUBLE_EQ(10.0, timeline.stepValue());
+	timeline.update(100.25);
+	EXPECT_DOUBLE_EQ(7.5, timeline.stepValue());
+
+	// Time that passes while paused is skipped, and the first update after unpausing sets the reference time
+	timeline.pause();
+	timeline.update(105.0);
+	timeline.unpause();
+	timeline.update(105.25);
+	EXPECT_DOUBLE_EQ(7.5, timeline.stepValue());
+	timeline.update(105.5);
+	EXPECT_DOUBLE_EQ(5.0, timeline.stepValue());
+
+	// The same holds when no updates happen while paused
+	timeline.pause();
+	timeline.unpause();
+	timeline.update(200.0);
+	EXPECT_DOUBLE_EQ(5.0, timeline.stepValue());
+	EXPECT_EQ(bump::Timeline::RUNNING, timeline.state());
+	timeline.update(200.25);
+	EXPECT_DOUBLE_EQ(2.5, timeline.stepValue());
+
+	// A clock that runs backwards does not move the timeline
+	timeline.update(199.0);
+	EXPECT_DOUBLE_EQ(2.5, timeline.stepValue());
+
+	timeline.update(210.0);
+	EXPECT_EQ(bump::Timeline::FINISHED, timeline.state());
+	EXPECT_EQ(0.0, timeline.stepValue());
+}
+
+TEST_F(TimelineTest, testFinishedCallback)
+{
+	FinishedCounter counter;
+	bump::Timeline timeline(1.0);
+	timeline.setFinishedCallback(boost::bind(&FinishedCounter::finished, &counter, _1));
+
+	// The callback runs once when the timeline finishes
+	timeline.start();
+	timeline.advance(0.5);
+	EXPECT_EQ(0, counter.count);
+	timeline.advance(0.5);
+	EXPECT_EQ(1, counter.count);
+	timeline.advance(0.5);
+	EXPECT_EQ(1, counter.count);
+
+	// The callback may restart the timeline
+	counter.restart = true;
+	timeline.restart();
+	timeline.advance(2.0);
+	EXPECT_EQ(2, counter.count);
+	EXPECT_EQ(bump::Timeline::RUNNING, timeline.state());
+	timeline.advance(0.5);
+	EXPECT_DOUBLE_EQ(50.0, timeline.stepValue());
+
+	// Removing the callback stops the notifications
+	timeline.setFinishedCallback(bump::Timeline::FinishedCallback());
+	timeline.advance(1.0);
+	EXPECT_EQ(2, counter.count);
+	EXPECT_EQ(bump::Timeline::FINISHED, timeline.state());
+}
+
+}	// End of bumpTest namespace
@@ -0,0 +1,134 @@
+//
+//	TimerTest.cpp
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+// Boost headers
+#include <boost/chrono.hpp>
+#include <boost/thread.hpp>
+
+// Bump headers
+#include <bump/Timer.h>
+
+// bumpTest headers
+#include "../bumpTest/BaseTest.h"
+
+namespace bumpTest {
+
+/** Sleeps the current thread for the given number of milliseconds. */
+void sleepMilliseconds(unsigned int milliseconds)
+{
+	boost::this_thread::sleep_for(boost::chrono::milliseconds(milliseconds));
+}
+
+/**
+ * This is our main timer testing class. The SetUp and TearDown methods are
+ * executed before the test runs and after it completes. This is where we can
+ * add any custom set up for each test without having to add this to "every"
+ * test individually.
+ */
+class TimerTest : public BaseTest
+{
+protected:
+
+	/** Run immediately before a test starts. Starts the timer. */
+	void SetUp()
+	{
+		// Call the parent setup method
+		BaseTest::SetUp();
+
+		// Any custom setup we may need
+	}
+
+	/** Invoked immediately after a test finishes. Stops the timer. */
+	void TearDown()
+	{
+		// Call the parent tear down method
+		BaseTest::TearDown();
+
+		// Any custom teardown you may need
+	}
+};
+
+TEST_F(TimerTest, testElapsed)
+{
+	// The timer starts running when it is constructed
+	bump::Timer timer;
+	sleepMilliseconds(20);
+	const unsigned long long nanoseconds = timer.elapsedNanoseconds();
+	EXPECT_LE(20000000ULL, nanoseconds);
+	EXPECT_GT(2000000000ULL, nanoseconds);
+
+	// All the units should agree
+	const double seconds = timer.secondsElapsed();
+	EXPECT_LE(0.02, seconds);
+	EXPECT_LE(seconds * 1e3, timer.millisecondsElapsed());
+	EXPECT_LE(seconds * 1e6, timer.microsecondsElapsed());
+	EXPECT_LE(seconds * 1e9, timer.nanosecondsElapsed());
+
+	// Readings should never go backwards
+	unsigned long long previous = timer.elapsedNanoseconds();
+	for (unsigned int i = 0; i < 10000; ++i)
+	{
+		const unsigned long long current = timer.elapsedNanoseconds();
+		EXPECT_LE(previous, current);
+		previous = current;
+	}
+
+	// Restarting should reset the elapsed time
+	timer.restart();
+	EXPECT_GT(20000000ULL, timer.elapsedNanoseconds());
+}
+
+TEST_F(TimerTest, testPause)
+{
+	bump::Timer timer;
+	sleepMilliseconds(10);
+
+	// A paused timer should not advance
+	timer.pause();
+	const unsigned long long paused = timer.elapsedNanoseconds();
+	EXPECT_LE(10000000ULL, paused);
+	sleepMilliseconds(30);
+	EXPECT_EQ(paused, timer.elapsedNanoseconds());
+
+	// Pausing twice should not lose time
+	timer.pause();
+	EXPECT_EQ(paused, timer.elapsedNanoseconds());
+
+	// An unpaused timer should continue from where it was paused
+	timer.unpause();
+	sleepMilliseconds(10);
+	const unsigned long long unpaused = timer.elapsedNanoseconds();
+	EXPECT_LE(paused + 10000000ULL, unpaused);
+	EXPECT_GT(paused + 30000000ULL, unpaused);
+
+	// Starting should reset a paused timer
+	timer.pause();
+	timer.start();
+	EXPECT_GT(paused, timer.elapsedNanoseconds());
+}
+
+TEST_F(TimerTest, testTimeStampCounter)
+{
+	bump::Timer timer(bump::Timer::TIME_STAMP_COUNTER);
+	if (!bump::Timer::isTimeStampCounterAvailable())
+	{
+		EXPECT_EQ(bump::Timer::STEADY_CLOCK, timer.clock());
+		return;
+	}
+
+	// The calibrated counter should agree with the steady clock
+	EXPECT_EQ(bump::Timer::TIME_STAMP_COUNTER, timer.clock());
+	bump::Timer steadyTimer;
+	timer.restart();
+	sleepMilliseconds(50);
+	const double counterNanoseconds = timer.nanosecondsElapsed();
+	const double steadyNanoseconds = steadyTimer.nanosecondsElapsed();
+	EXPECT_NEAR(steadyNanoseconds, counterNanoseconds, steadyNanoseconds * 0.05);
+}
+
+}	// End of bumpTest namespace
@@ -0,0 +1,208 @@
+//
+//	TracerTest.cpp
+//	Bump
+//
+//	Created by Christian Noon on 10/17/26.
+//	Copyright (c) 2026 Christian Noon. All rights reserved.
+//
+
+// C++ headers
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+// Boost headers
+#include <boost/thread/thread.hpp>
+
+// Bump headers
+#include <bump/AutoTimer.h>
+#include <bump/FileSystem.h>
+#include <bump/Tracer.h>
+
+// bumpTest headers
+#include "../bumpTest/BaseTest.h"
+
+namespace bumpTest {
+
+/** Reads the lines of the trace file. */
+bump::StringList readTrace(const bump::String& path)
+{
+	std::ifstream file(path.c_str());
+	std::stringstream contents;
+	contents << file.rdbuf();
+	return bump::String(contents.str()).split("\n");
+}
+
+/** Returns the number of lines containing all of the given text. */
+unsigned int countLines(const bump::StringList& lines, const bump::String& text, const bump::String& otherText = "")
+{
+	unsigned int count = 0;
+	for (unsigned int i = 0; i < lines.size(); ++i)
+	{
+		if (lines[i].contains(text) && lines[i].contains(otherText))
+		{
+			++count;
+		}
+	}
+
+	return count;
+}
+
+/** Traces a few nested scopes on a named thread. */
+void traceThread()
+{
+	bump::Tracer::setThreadName("worker");
+	for (unsigned int i = 0; i < 100; ++i)
+	{
+		BUMP_TRACE_SCOPE("test", "work");
+		BUMP_TRACE_SCOPE_WITH_ARGUMENT("test", "step", "index", i);
+	}
+}
+
+/**
+ * This is our main tracer testing class. The SetUp and TearDown methods are
+ * executed before the test runs and after it completes. This is where we can
+ * add any custom set up for each test without having to add this to "every"
+ * test individually.
+ */
+class TracerTest : public BaseTest
+{
+protected:
+
+	/** Run immediately before a test starts. Starts the timer. */
+	void SetUp()
+	{
+		// Call the parent setup method
+		BaseTest::SetUp();
+
+		// Start every test with an empty trace file
+		_tracePath = bump::FileSystem::join(bump::FileSystem::temporaryPath(), "bumpTracerTest.json");
+		bump::Tracer::setTraceFile(_tracePath);
+		bump::Tracer::setSampleInterval(1);
+		bump::Tracer::setEnabled(true);
+		bump::Tracer::flush();
+	}
+
+	/** Invoked immediately after a test finishes. Stops the timer. */
+	void TearDown()
+	{
+		// Call the parent tear down method
+		BaseTest::TearDown();
+
+		// Don't leave the trace behind
+		bump::Tracer::setEnabled(false);
+		bump::Tracer::flush();
+		bump::Tracer::setTraceFile("");
+		bump::FileSystem::removeFile(_tracePath);
+	}
+
+	// Instance member variables
+	bump::String _tracePath;
+};
+
+TEST_F(TracerTest, testScopes)
+{
+	{
+		BUMP_TRACE_SCOPE("test", "outer");
+		BUMP_TRACE_SCOPE_WITH_ARGUMENT("test", "inner", "bytes", 1024);
+		bump::Tracer::instantEvent("test", "marker");
+	}
+	EXPECT_TRUE(bump::Tracer::flush());
+
+	// The file is a JSON array with one event per line
+	bump::StringList lines = readTrace(_tracePath);
+	ASSERT_EQ(7, lines.size());
+	EXPECT_EQ("[", lines[0]);
+	EXPECT_TRUE(lines[1].contains("\"name\":\"outer\",\"cat\":\"test\",\"ph\":\"B\""));
+	EXPECT_TRUE(lines[2].contains("\"name\":\"inner\",\"cat\":\"test\",\"ph\":\"B\""));
+	EXPECT_TRUE(lines[2].contains("\"args\":{\"bytes\":1024}"));
+	EXPECT_TRUE(lines[3].contains("\"name\":\"marker\",\"cat\":\"test\",\"ph\":\"i\""));
+	EXPECT_TRUE(lines[4].contains("\"name\":\"inner\",\"cat\":\"test\",\"ph\":\"E\""));
+	EXPECT_TRUE(lines[5].contains("\"name\":\"outer\",\"cat\":\"test\",\"ph\":\"E\""));
+	EXPECT_TRUE(lines[5].endsWith("},"));
+	EXPECT_TRUE(lines[6].empty());
+
+	// Flushing again appends only the new events
+	bump::Tracer::instantEvent("test", "quote\"d");
+	EXPECT_TRUE(bump::Tracer::flush());
+	lines = readTrace(_tracePath);
+	ASSERT_EQ(8, lines.size());
+	EXPECT_TRUE(lines[6].contains("\"name\":\"quote\\\"d\""));
+
+	// Arguments JSON cannot hold are written as null
+	bump::Tracer::instantEvent("test", "nan", "value", std::numeric_limits<double>::quiet_NaN());
+	bump::Tracer::instantEvent("test", "infinity", "value", -std::numeric_limits<double>::infinity());
+	EXPECT_TRUE(bump::Tracer::flush());
+	lines = readTrace(_tracePath);
+	EXPECT_EQ(1, countLines(lines, "\"name\":\"nan\"", "\"args\":{\"value\":null}"));
+	EXPECT_EQ(1, countLines(lines, "\"name\":\"infinity\"", "\"args\":{\"value\":null}"));
+
+	// Nothing is recorded while tracing is disabled
+	bump::Tracer::setEnabled(false);
+	{
+		BUMP_TRACE_SCOPE("test", "disabled");
+	}
+	EXPECT_TRUE(bump::Tracer::flush());
+	EXPECT_EQ(0, countLines(readTrace(_tracePath), "disabled"));
+}
+
+TEST_F(TracerTest, testThreads)
+{
+	boost::thread_group threads;
+	for (unsigned int i = 0; i < 4; ++i)
+	{
+		threads.create_thread(traceThread);
+	}
+	threads.join_all();
+	EXPECT_TRUE(bump::Tracer::flush());
+
+	// Each thread's events carry its own id, and the threads are named
+	const bump::StringList lines = readTrace(_tracePath);
+	EXPECT_EQ(1600, countLines(lines, "\"cat\":\"test\""));
+	EXPECT_EQ(4, countLines(lines, "\"thread_name\"", "\"name\":\"worker\""));
+	EXPECT_EQ(0, bump::Tracer::droppedEvents());
+}
+
+TEST_F(TracerTest, testAutoTimer)
+{
+	// An auto timer created with a trace name traces its scope instead of printing
+	{
+		bump::AutoTimer timer("test", "timed");
+	}
+	EXPECT_TRUE(bump::Tracer::flush());
+
+	bump::StringList lines = readTrace(_tracePath);
+	EXPECT_EQ(1, countLines(lines, "\"name\":\"timed\"", "\"ph\":\"B\""));
+	EXPECT_EQ(1, countLines(lines, "\"name\":\"timed\"", "\"ph\":\"E\""));
+
+	// Nothing is traced while tracing is disabled
+	bump::Tracer::setEnabled(false);
+	{
+		bump::AutoTimer timer("test", "untimed");
+	}
+	EXPECT_TRUE(bump::Tracer::flush());
+	EXPECT_EQ(0, countLines(readTrace(_tracePath), "\"untimed\""));
+}
+
+TEST_F(TracerTest, testSampling)
+{
+	// Only one of every ten scopes is traced, and sampled scopes are always balanced
+	bump::Tracer::setSampleInterval(10);
+	EXPECT_EQ(10, bump::Tracer::sampleInterval());
+	for (unsigned int i = 0; i < 100; ++i)
+	{
+		BUMP_TRACE_SCOPE("test", "sampled");
+	}
+	EXPECT_TRUE(bump::Tracer::flush());
+
+	const bump::StringList lines = readTrace(_tracePath);
+	EXPECT_EQ(10, countLines(lines, "\"sampled\"", "\"ph\":\"B\""));
+	EXPECT_EQ(10, countLines(lines, "\"sampled\"", "\"ph\":\"E\""));
+
+	// Flushing without a trace file fails
+	bump::Tracer::setTraceFile("");
+	EXPECT_FALSE(bump::Tracer::flush());
+	bump::Tracer::setTraceFile(_tracePath);
+}
+
+}	// End of bumpTest namespace
@@ -6,19 +6,37 @@
 //	Copyright (c) 2012 Christian Noon. All rights reserved.
 //
 
+// C++ headers
+#include <cstring>
+#include <set>
+#include <vector>
+
 // Boost headers
+#include <boost/chrono.hpp>
+#include <boost/functional/hash.hpp>
+#include <boost/thread.hpp>
 #include <boost/uuid/uuid_io.hpp>
 
 // Bump headers
 #include <bump/String.h>
 #include <bump/TypeCastError.h>
 #include <bump/Uuid.h>
+#include <bump/UuidHashTable.h>
 
 // bumpTest headers
 #include "../bumpTest/BaseTest.h"
 
 namespace bumpTest {
 
+/** Fills the uuids with time ordered uuids. */
+void fillTimeOrdered(std::vector<bump::Uuid>* uuids)
+{
+	for (unsigned int i = 0; i < uuids->size(); ++i)
+	{
+		(*uuids)[i] = bump::Uuid::generateTimeOrdered();
+	}
+}
+
 /**
  * This is our main uuid testing class. The SetUp and TearDown methods are
  * executed before the test runs and after it completes. This is where we can
@@ -117,6 +135,76 @@ TEST_F(UuidTest, testGenerateRandom)
 	}
 }
 
+TEST_F(UuidTest, testGenerateRandomBatch)
+{
+	// Generate batches with both generators and make sure every uuid is a unique version 4 uuid
+	bump::Uuid::Generator generators[] = { bump::Uuid::SECURE, bump::Uuid::FAST };
+	for (unsigned int g = 0; g < 2; ++g)
+	{
+		std::vector<bump::Uuid> uuids(1000);
+		bump::Uuid::generateRandomBatch(uuids.size(), &uuids[0], generators[g]);
+		uuids.push_back(bump::Uuid::generateRandom(generators[g]));
+
+		std::set<boost::uuids::uuid> unique_uuids;
+		for (unsigned int i = 0; i < uuids.size(); ++i)
+		{
+			EXPECT_EQ(boost::uuids::uuid::version_random_number_based, uuids[i].version());
+			EXPECT_EQ(boost::uuids::uuid::variant_rfc_4122, uuids[i].variant());
+			unique_uuids.insert(uuids[i]);
+		}
+		EXPECT_EQ(uuids.size(), unique_uuids.size());
+	}
+
+	// Each thread seeds its own generators, so threads must not repeat each other
+	std::vector<bump::Uuid> first(500);
+	std::vector<bump::Uuid> second(500);
+	boost::thread first_thread(&bump::Uuid::generateRandomBatch, 500u, &first[0], bump::Uuid::FAST);
+	boost::thread second_thread(&bump::Uuid::generateRandomBatch, 500u, &second[0], bump::Uuid::FAST);
+	first_thread.join();
+	second_thread.join();
+	std::set<boost::uuids::uuid> unique_uuids(first.begin(), first.end());
+	unique_uuids.insert(second.begin(), second.end());
+	EXPECT_EQ(1000, (int)unique_uuids.size());
+}
+
+TEST_F(UuidTest, testGenerateTimeOrdered)
+{
+	// Generate a burst of uuids and make sure each one sorts after the previous one
+	const unsigned long long start = boost::chrono::duration_cast<boost::chrono::milliseconds>(
+		boost::chrono::system_clock::now().time_since_epoch()).count();
+	std::vector<bump::Uuid> uuids;
+	for (unsigned int i = 0; i < 100000; ++i)
+	{
+		uuids.push_back(bump::Uuid::generateTimeOrdered());
+	}
+	for (unsigned int i = 1; i < uuids.size(); ++i)
+	{
+		EXPECT_TRUE(uuids[i - 1] < uuids[i]);
+		EXPECT_TRUE(uuids[i].toString() > uuids[i - 1].toString());
+	}
+
+	// Check the version, variant and timestamp
+	const bump::Uuid& uuid = uuids.front();
+	EXPECT_EQ(7, uuid.data[6] >> 4);
+	EXPECT_EQ(boost::uuids::uuid::variant_rfc_4122, uuid.variant());
+	EXPECT_GE(uuid.timestamp(), start);
+	EXPECT_LT(uuid.timestamp(), start + 60000);
+
+	// Random uuids have no timestamp
+	EXPECT_EQ(0, bump::Uuid::generateRandom().timestamp());
+
+	// Uuids generated on several threads are all unique
+	std::vector<bump::Uuid> first(10000);
+	std::vector<bump::Uuid> second(10000);
+	boost::thread first_thread(&fillTimeOrdered, &first);
+	boost::thread second_thread(&fillTimeOrdered, &second);
+	first_thread.join();
+	second_thread.join();
+	std::set<boost::uuids::uuid> unique_uuids(first.begin(), first.end());
+	unique_uuids.insert(second.begin(), second.end());
+	EXPECT_EQ(20000, (int)unique_uuids.size());
+}
+
 TEST_F(UuidTest, testFromString)
 {
 	// Create a null uuid from a string
@@ -132,8 +220,228 @@ TEST_F(UuidTest, testFromString)
 	EXPECT_STREQ("4605d211-2d5b-4ab4-8feb-d7c38e4e38c3", uuid.toString().c_str());
 	EXPECT_FALSE(uuid.isNull());
 
+	// Try with uppercase digits and without dashes
+	uuid = bump::Uuid::fromString("4605D211-2D5B-4AB4-8FEB-D7C38E4E38C3");
+	EXPECT_STREQ("4605d211-2d5b-4ab4-8feb-d7c38e4e38c3", uuid.toString().c_str());
+	uuid = bump::Uuid::fromString("4605d2112d5b4ab48febd7c38e4e38c3");
+	EXPECT_STREQ("4605d211-2d5b-4ab4-8feb-d7c38e4e38c3", uuid.toString().c_str());
+
 	// Test an invalid string
 	EXPECT_THROW(bump::Uuid::fromString("this is NOT valid"), bump::TypeCastError);
+	EXPECT_THROW(bump::Uuid::fromString("4605d211-2d5b-4ab4-8feb-d7c38e4e38cg"), bump::TypeCastError);
+}
+
+TEST_F(UuidTest, testTryFromString)
+{
+	// Canonical, braced and dashless forms
+	bump::Uuid uuid;
+	EXPECT_TRUE(bump::Uuid::tryFromString("4605d211-2d5b-4ab4-8feb-d7c38e4e38c3", uuid));
+	EXPECT_STREQ("4605d211-2d5b-4ab4-8feb-d7c38e4e38c3", uuid.toString().c_str());
+	uuid = bump::Uuid();
+	EXPECT_TRUE(bump::Uuid::tryFromString("{4605D211-2D5B-4AB4-8FEB-D7C38E4E38C3}", uuid));
+	EXPECT_STREQ("4605d211-2d5b-4ab4-8feb-d7c38e4e38c3", uuid.toString().c_str());
+	uuid = bump::Uuid();
+	EXPECT_TRUE(bump::Uuid::tryFromString("4605d2112d5b4ab48febd7c38e4e38c3", uuid));
+	EXPECT_STREQ("4605d211-2d5b-4ab4-8feb-d7c38e4e38c3", uuid.toString().c_str());
+
+	// Characters that are not null terminated
+	const char* line = "c9226c75-2e16-4bad-bd27-f4b782869dfb,next";
+	EXPECT_TRUE(bump::Uuid::tryFromString(line, 36, uuid));
+	EXPECT_STREQ("c9226c75-2e16-4bad-bd27-f4b782869dfb", uuid.toString().c_str());
+
+	// Invalid strings leave the uuid unchanged
+	const char* invalid[] =
+	{
+		"",
+		"this is NOT valid",
+		"4605d211-2d5b-4ab4-8feb-d7c38e4e38c",
+		"4605d211-2d5b-4ab4-8feb-d7c38e4e38c3a",
+		"4605d211x2d5b-4ab4-8feb-d7c38e4e38c3",
+		"4605d211-2d5b-4ab4-8feb-d7c38e4e38g3",
+		"{4605d211-2d5b-4ab4-8feb-d7c38e4e38c3",
+		"4605d2112d5b4ab48febd7c38e4e38c-"
+	};
+	for (unsigned int i = 0; i < sizeof(invalid) / sizeof(invalid[0]); ++i)
+	{
+		EXPECT_FALSE(bump::Uuid::tryFromString(invalid[i], uuid)) << invalid[i];
+		EXPECT_STREQ("c9226c75-2e16-4bad-bd27-f4b782869dfb", uuid.toString().c_str());
+	}
+
+	// Strings can also be converted to an expected uuid
+	bump::Expected<bump::Uuid> expected = bump::Uuid::tryFromString("4605d211-2d5b-4ab4-8feb-d7c38e4e38c3");
+	ASSERT_TRUE(expected.hasValue());
+	EXPECT_STREQ("4605d211-2d5b-4ab4-8feb-d7c38e4e38c3", expected.value().toString().c_str());
+	expected = bump::Uuid::tryFromString("this is NOT valid");
+	EXPECT_FALSE(expected.hasValue());
+	EXPECT_EQ(bump::Result::TYPE_CAST_ERROR, expected.result().type());
+	EXPECT_THROW(expected.value(), bump::TypeCastError);
+}
+
+TEST_F(UuidTest, testToChars)
+{
+	// Write into the middle of a larger buffer and make sure nothing else is touched
+	bump::Uuid uuid = bump::Uuid::fromString("4605d211-2d5b-4ab4-8feb-d7c38e4e38c3");
+	char buffer[40];
+	std::memset(buffer, '#', sizeof(buffer));
+	uuid.toChars(buffer + 2);
+	EXPECT_EQ("##4605d211-2d5b-4ab4-8feb-d7c38e4e38c3##", std::string(buffer, sizeof(buffer)));
+
+	// Round trip random uuids through both directions
+	for (unsigned int i = 0; i < 100; ++i)
+	{
+		uuid = bump::Uuid::generateRandom();
+		uuid.toChars(buffer);
+		bump::Uuid parsed;
+		EXPECT_TRUE(bump::Uuid::tryFromString(buffer, 36, parsed));
+		EXPECT_TRUE(uuid == parsed);
+		EXPECT_EQ(boost::uuids::to_string(uuid), std::string(buffer, 36));
+	}
+}
+
+TEST_F(UuidTest, testHashValue)
+{
+	// Equal uuids hash the same through every interface
+	bump::Uuid uuid1 = bump::Uuid::fromString("4605d211-2d5b-4ab4-8feb-d7c38e4e38c3");
+	bump::Uuid uuid2 = bump::Uuid::fromString("4605d211-2d5b-4ab4-8feb-d7c38e4e38c3");
+	EXPECT_EQ(bump::hash_value(uuid1), bump::hash_value(uuid2));
+	EXPECT_EQ(bump::hash_value(uuid1), boost::hash<bump::Uuid>()(uuid2));
+	EXPECT_EQ(bump::hash_value(uuid1), std::hash<bump::Uuid>()(uuid2));
+
+	// Random uuids should essentially never collide
+	std::set<std::size_t> hashes;
+	for (unsigned int i = 0; i < 1000; ++i)
+	{
+		hashes.insert(bump::hash_value(bump::Uuid::generateRandom(bump::Uuid::FAST)));
+	}
+	EXPECT_EQ(1000, hashes.size());
+}
+
+TEST_F(UuidTest, testUuidHashMap)
+{
+	// Test an empty map
+	bump::UuidHashMap<int> map;
+	EXPECT_TRUE(map.empty());
+	EXPECT_EQ(0, map.capacity());
+	EXPECT_TRUE(map.begin() == map.end());
+	EXPECT_FALSE(map.contains(bump::Uuid()));
+	EXPECT_EQ(0, map.erase(bump::Uuid()));
+
+	// Insert enough uuids to grow the map several times
+	std::vector<bump::Uuid> uuids(5000);
+	bump::Uuid::generateRandomBatch(uuids.size(), &uuids[0], bump::Uuid::FAST);
+	for (unsigned int i = 0; i < uuids.size(); ++i)
+	{
+		EXPECT_TRUE(map.insert(uuids[i], i).second);
+	}
+	EXPECT_EQ(uuids.size(), map.size());
+	EXPECT_FALSE(map.insert(uuids[0], 42).second);
+	EXPECT_EQ(0, map[uuids[0]]);
+
+	// Every uuid should be found with its value
+	for (unsigned int i = 0; i < uuids.size(); ++i)
+	{
+		bump::UuidHashMap<int>::iterator iter = map.find(uuids[i]);
+		ASSERT_TRUE(iter != map.end());
+		EXPECT_EQ(uuids[i], iter->first);
+		EXPECT_EQ((int) i, iter->second);
+	}
+	EXPECT_FALSE(map.contains(bump::Uuid::generateRandom()));
+
+	// Iteration should visit every element once
+	int sum = 0;
+	unsigned int count = 0;
+	for (bump::UuidHashMap<int>::const_iterator iter = map.begin(); iter != map.end(); ++iter)
+	{
+		sum += iter->second;
+		++count;
+	}
+	EXPECT_EQ(uuids.size(), count);
+	EXPECT_EQ((int) (uuids.size() * (uuids.size() - 1) / 2), sum);
+
+	// Erase every other uuid, by key and by iterator
+	for (unsigned int i = 0; i < uuids.size(); i += 2)
+	{
+		if (i % 4 == 0)
+		{
+			EXPECT_EQ(1, map.erase(uuids[i]));
+		}
+		else
+		{
+			map.erase(map.find(uuids[i]));
+		}
+	}
+	EXPECT_EQ(uuids.size() / 2, map.size());
+	for (unsigned int i = 0; i < uuids.size(); ++i)
+	{
+		EXPECT_EQ(i % 2 == 1, map.contains(uuids[i]));
+	}
+
+	// Churning inserts and erases must not keep growing the map
+	const std::size_t capacity = map.capacity();
+	for (unsigned int round = 0; round < 20; ++round)
+	{
+		for (unsigned int i = 0; i < uuids.size(); i += 2)
+		{
+			map[uuids[i]] = round;
+		}
+		for (unsigned int i = 0; i < uuids.size(); i += 2)
+		{
+			map.erase(uuids[i]);
+		}
+	}
+	EXPECT_EQ(capacity, map.capacity());
+	EXPECT_EQ(uuids.size() / 2, map.size());
+
+	// Copies are independent of the original
+	bump::UuidHashMap<int> copy(map);
+	copy[uuids[0]] = 7;
+	EXPECT_EQ(map.size() + 1, copy.size());
+	EXPECT_FALSE(map.contains(uuids[0]));
+	EXPECT_EQ(1, copy[uuids[1]]);
+	map = copy;
+	EXPECT_EQ(7, map[uuids[0]]);
+
+	// Clearing keeps the allocated slots
+	const std::size_t copiedCapacity = map.capacity();
+	map.clear();
+	EXPECT_TRUE(map.empty());
+	EXPECT_EQ(copiedCapacity, map.capacity());
+	EXPECT_TRUE(map.begin() == map.end());
+	EXPECT_FALSE(map.contains(uuids[1]));
+}
+
+TEST_F(UuidTest, testUuidHashSet)
+{
+	// Reserving should allocate enough slots up front
+	bump::UuidHashSet set;
+	set.reserve(1000);
+	const std::size_t capacity = set.capacity();
+	EXPECT_LE(1000, capacity);
+
+	// Insert time ordered uuids, which share their leading bytes
+	std::vector<bump::Uuid> uuids(1000);
+	fillTimeOrdered(&uuids);
+	for (unsigned int i = 0; i < uuids.size(); ++i)
+	{
+		EXPECT_TRUE(set.insert(uuids[i]).second);
+		EXPECT_FALSE(set.insert(uuids[i]).second);
+	}
+	EXPECT_EQ(uuids.size(), set.size());
+	EXPECT_EQ(capacity, set.capacity());
+
+	// Test contains and count
+	for (unsigned int i = 0; i < uuids.size(); ++i)
+	{
+		EXPECT_TRUE(set.contains(uuids[i]));
+		EXPECT_EQ(1, set.count(uuids[i]));
+	}
+	EXPECT_EQ(0, set.count(bump::Uuid()));
+
+	// The null uuid is a valid key
+	EXPECT_TRUE(set.insert(bump::Uuid()).second);
+	EXPECT_TRUE(set.contains(bump::Uuid()));
+	EXPECT_EQ(1, set.erase(bump::Uuid()));
+	EXPECT_FALSE(set.contains(bump::Uuid()));
 }
 
 TEST_F(UuidTest, testIsNull)